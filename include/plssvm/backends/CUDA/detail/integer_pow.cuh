@@ -0,0 +1,41 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the power function with an integer exponent used in the polynomial kernel function on the device.
+ */
+
+#pragma once
+
+namespace plssvm::cuda::detail {
+
+/**
+ * @brief Calculate @p base to the power of @p degree.
+ * @details If @p unrolled_degree isn't `0`, the power is unrolled into multiplications at compile-time and @p degree is ignored. Otherwise, `pow` is used.
+ * @tparam unrolled_degree the degree known at compile-time or `0` to use the runtime @p degree
+ * @tparam real_type the type of the data
+ * @param[in] base the base
+ * @param[in] degree the runtime degree
+ * @return \f$base^{degree}\f$
+ */
+template <int unrolled_degree, typename real_type>
+__device__ __forceinline__ real_type integer_pow(const real_type base, const int degree) {
+    if constexpr (unrolled_degree == 0) {
+        return pow(base, degree);
+    } else if constexpr (unrolled_degree == 1) {
+        return base;
+    } else {
+        const real_type half = integer_pow<unrolled_degree / 2>(base, degree);
+        if constexpr (unrolled_degree % 2 == 0) {
+            return half * half;
+        } else {
+            return half * half * base;
+        }
+    }
+}
+
+}  // namespace plssvm::cuda::detail
@@ -32,6 +32,7 @@ __global__ void device_kernel_w_linear(real_type *w_d, const real_type *data_d,
 /**
  * @brief Predicts the labels for data points using the polynomial kernel function.
  * @details Currently only single GPU execution is supported.
+ * @tparam unrolled_degree the degree of the polynomial kernel function unrolled into multiplications at compile-time or `0` to use the runtime @p degree
  * @tparam real_type the type of the data
  * @param[in] out_d the calculated predictions
  * @param[in] data_d the one-dimension support vector matrix
@@ -45,7 +46,7 @@ __global__ void device_kernel_w_linear(real_type *w_d, const real_type *data_d,
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
  */
-template <typename real_type>
+template <int unrolled_degree, typename real_type>
 __global__ void device_kernel_predict_poly(real_type *out_d, const real_type *data_d, const real_type *data_last_d, const real_type *alpha_d, const kernel_index_type num_data_points, const real_type *points, const kernel_index_type num_predict_points, const kernel_index_type num_features, const int degree, const real_type gamma, const real_type coef0);
 
 /**
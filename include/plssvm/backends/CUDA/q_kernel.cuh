@@ -31,6 +31,7 @@ __global__ void device_kernel_q_linear(real_type *q, const real_type *data_d, co
 /**
  * @brief Calculates the `q` vector using the polynomial C-SVM kernel.
  * @details Currently only single GPU execution is supported.
+ * @tparam unrolled_degree the degree of the polynomial kernel function unrolled into multiplications at compile-time or `0` to use the runtime @p degree
  * @tparam real_type the type of the data
  * @param[out] q the calculated `q` vector
  * @param[in] data_d the one-dimensional data matrix
@@ -41,7 +42,7 @@ __global__ void device_kernel_q_linear(real_type *q, const real_type *data_d, co
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
  */
-template <typename real_type>
+template <int unrolled_degree, typename real_type>
 __global__ void device_kernel_q_poly(real_type *q, const real_type *data_d, const real_type *data_last, const kernel_index_type num_rows, const kernel_index_type num_cols, const int degree, const real_type gamma, const real_type coef0);
 
 /**
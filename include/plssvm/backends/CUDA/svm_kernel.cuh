@@ -36,6 +36,7 @@ __global__ void device_kernel_linear(const real_type *q, real_type *ret, const r
 /**
  * @brief Calculates the C-SVM kernel using the polynomial kernel function.
  * @details Currently only single GPU execution is supported.
+ * @tparam unrolled_degree the degree of the polynomial kernel function unrolled into multiplications at compile-time or `0` to use the runtime @p degree
  * @tparam real_type the type of the data
  * @param[in] q the `q` vector
  * @param[out] ret the result vector
@@ -50,7 +51,7 @@ __global__ void device_kernel_linear(const real_type *q, real_type *ret, const r
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
  */
-template <typename real_type>
+template <int unrolled_degree, typename real_type>
 __global__ void device_kernel_poly(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0);
 
 /**
@@ -0,0 +1,39 @@
+/**
+* @file
+* @author Alexander Van Craen
+* @author Marcel Breyer
+* @copyright 2018-today The PLSSVM project - All Rights Reserved
+* @license This file is part of the PLSSVM project which is released under the MIT license.
+*          See the LICENSE.md file in the project root for full license information.
+*
+* @brief Defines the power function with an integer exponent used in the polynomial kernel function.
+* @details If the degree is baked into the program at JIT time using `PLSSVM_POLYNOMIAL_DEGREE`, the power is unrolled into multiplications.
+*/
+
+/**
+ * @brief Calculate @p base to the power of @p degree.
+ * @details If `PLSSVM_POLYNOMIAL_DEGREE` is defined, @p degree is ignored and the power is unrolled into multiplications. Otherwise, `pow` is used.
+ * @param[in] base the base
+ * @param[in] degree the runtime degree
+ * @return \f$base^{degree}\f$
+ */
+inline real_type integer_pow(const real_type base, const int degree) {
+#if PLSSVM_POLYNOMIAL_DEGREE == 1
+    return base;
+#elif PLSSVM_POLYNOMIAL_DEGREE == 2
+    return base * base;
+#elif PLSSVM_POLYNOMIAL_DEGREE == 3
+    return base * base * base;
+#elif PLSSVM_POLYNOMIAL_DEGREE == 4
+    const real_type square = base * base;
+    return square * square;
+#elif PLSSVM_POLYNOMIAL_DEGREE == 5
+    const real_type square = base * base;
+    return square * square * base;
+#elif PLSSVM_POLYNOMIAL_DEGREE == 6
+    const real_type cube = base * base * base;
+    return cube * cube;
+#else
+    return pow(base, (real_type) degree);
+#endif
+}
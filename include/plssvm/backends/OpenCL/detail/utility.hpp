@@ -84,11 +84,12 @@ void device_synchronize(const command_queue &queue);
  * @param[in] queues the used OpenCL command queues
  * @param[in] file the file containing the kernel
  * @param[in] kernel_name the name of the kernel to create
+ * @param[in] build_options additional options passed to the OpenCL compiler, e.g., preprocessor definitions baked into the kernel at JIT time
  * @throws plssvm::invalid_file_format_exception if the file couldn't be read using [`std::ifstream::read`](https://en.cppreference.com/w/cpp/io/basic_istream/read)
  * @return the kernel (`[[nodiscard]]`)
  */
 template <typename real_type>
-[[nodiscard]] std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, const std::string &file, const std::string &kernel_name);
+[[nodiscard]] std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, const std::string &file, const std::string &kernel_name, const std::string &build_options = "");
 
 /**
  * @brief Set all arguments in the parameter pack @p args for the kernel @p kernel.
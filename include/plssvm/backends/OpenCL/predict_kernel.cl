@@ -64,7 +64,7 @@ __kernel void device_kernel_predict_poly(__global real_type *out_d, __global con
             }
         }
 
-        temp = alpha_d[data_point_index] * pow(gamma * temp + coef0, degree);
+        temp = alpha_d[data_point_index] * integer_pow(gamma * temp + coef0, degree);
         atomicAdd(&out_d[predict_point_index], temp);
     }
 }
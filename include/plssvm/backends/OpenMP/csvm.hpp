@@ -11,9 +11,14 @@
 
 #pragma once
 
-#include "plssvm/csvm.hpp"  // plssvm::csvm
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::accumulation_strategy, plssvm::openmp::kernel_matrix
+#include "plssvm/backends/OpenMP/tile_cache.hpp"  // plssvm::openmp::tile_cache
+#include "plssvm/csvm.hpp"                        // plssvm::csvm
+#include "plssvm/matrix.hpp"                      // plssvm::aos_matrix
 
-#include <vector>  // std::vector
+#include <cstddef>  // std::size_t
+#include <memory>   // std::unique_ptr
+#include <vector>   // std::vector
 
 namespace plssvm {
 
@@ -39,12 +44,15 @@ class csvm : public ::plssvm::csvm<T> {
     using base_type::cost_;
     using base_type::data_ptr_;
     using base_type::degree_;
+    using base_type::fast_math_kernels_;
     using base_type::gamma_;
     using base_type::kernel_;
+    using base_type::mixed_precision_;
     using base_type::num_data_points_;
     using base_type::num_features_;
     using base_type::print_info_;
     using base_type::QA_cost_;
+    using base_type::solver_;
     using base_type::target_;
     using base_type::w_;
 
@@ -58,13 +66,11 @@ class csvm : public ::plssvm::csvm<T> {
      * @throws plssvm::csvm::csvm() exceptions
      * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the OpenMP tile size is 0
      */
     explicit csvm(const parameter<T> &params);
 
-    /**
-     * @copydoc plssvm::csvm::predict(const std::vector<std::vector<real_type>>&)
-     */
-    [[nodiscard]] std::vector<real_type> predict(const std::vector<std::vector<real_type>> &points) override;
+    using base_type::predict;
 
   protected:
     /**
@@ -80,21 +86,139 @@ class csvm : public ::plssvm::csvm<T> {
     /**
      * @copydoc plssvm::csvm::solver_CG
      */
-    std::vector<real_type> solver_CG(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &q) override;
+    std::vector<real_type> solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, std::size_t imax, real_type eps, const std::vector<real_type> &q) override;
+    /**
+     * @copydoc plssvm::csvm::solver_CG_cost_path
+     */
+    std::vector<std::vector<real_type>> solver_CG_cost_path(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &q, const std::vector<real_type> &costs) override;
+    /**
+     * @copydoc plssvm::csvm::solver_CG_block
+     */
+    std::vector<std::vector<real_type>> solver_CG_block(const std::vector<std::vector<real_type>> &B, std::size_t imax, real_type eps, const std::vector<real_type> &q, const std::vector<std::size_t> &folds) override;
     /**
      * @copydoc plssvm::csvm::update_w
      */
     void update_w() override;
+    /**
+     * @copydoc plssvm::csvm::predict(const aos_matrix<real_type>&)
+     */
+    [[nodiscard]] std::vector<real_type> predict(const aos_matrix<real_type> &points) override;
 
+    /// The type of a matrix-vector product with the least-squares matrix.
+    using matvec_type = typename base_type::matvec_type;
+    /// The type of a matrix-vector product with the least-squares matrix for multiple vectors at once.
+    using block_matvec_type = typename base_type::block_matvec_type;
+    /**
+     * @brief Prepare the matrix-vector products with the least-squares matrix used in the CG algorithm based on the value of @p kernel_.
+     * @details For the linear kernel, the matrix-vector product is calculated in the primal space. Otherwise, the kernel matrix is explicitly assembled or a tile cache is created (see setup_kernel_matrix()).
+     *          Must be followed by a call to release_matvec() after the CG algorithm has finished.
+     * @param[in] q the `q` vector; must outlive the returned function
+     * @return the function calculating the matrix-vector product (`[[nodiscard]]`)
+     */
+    [[nodiscard]] matvec_type setup_matvec(const std::vector<real_type> &q);
+    /**
+     * @brief Prepare the matrix-vector products with the least-squares matrix for multiple vectors at once used in the block CG algorithm based on the value of @p kernel_.
+     * @details Same as setup_matvec(), but each kernel matrix tile is calculated (or read) only once per product and used for all vectors.
+     *          Must be followed by a call to release_matvec() after the CG algorithm has finished.
+     * @param[in] q the `q` vector; must outlive the returned function
+     * @return the function calculating the matrix-vector products (`[[nodiscard]]`)
+     */
+    [[nodiscard]] block_matvec_type setup_block_matvec(const std::vector<real_type> &q);
+    /**
+     * @brief Release the explicitly assembled kernel matrix and the tile cache created in setup_matvec().
+     */
+    void release_matvec();
+    /**
+     * @brief Explicitly assemble the reduced kernel matrix used in all subsequent calls to run_device_kernel() based on the value of @p kernel_.
+     * @param[in] q the `q` vector
+     */
+    void assemble_kernel_matrix(const std::vector<real_type> &q);
     /**
      * @brief Select the correct kernel based on the value of @p kernel_ and run it on the CPU using OpenMP.
+     * @details If the kernel matrix has been explicitly assembled using assemble_kernel_matrix(), it is used instead of @p q and @p data.
+     *          Otherwise, if a tile cache has been created, the cached kernel matrix tiles are reused and only the cache misses are recalculated.
      * @param[in] q the `q` vector
      * @param[out] ret the result vector
      * @param[in] d the right-hand side of the equation
      * @param[in] data the data
      * @param[in] add denotes whether the values are added or subtracted from the result vector
+     * @param[in] strategy the strategy used to accumulate the results
+     * @return the used accumulation strategy
+     */
+    accumulation_strategy run_device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, real_type add, accumulation_strategy strategy = accumulation_strategy::automatic);
+    /**
+     * @brief Select the correct kernel based on the value of @p kernel_ and run it on the CPU using OpenMP for all right-hand sides @p d at once.
+     * @details Each kernel matrix tile is calculated (or read from the explicitly assembled kernel matrix or the tile cache) only once and used for all right-hand sides.
+     * @param[in] q the `q` vector
+     * @param[out] ret the result vectors, one for each right-hand side
+     * @param[in] d the right-hand sides of the equation
+     * @param[in] data the data
+     * @param[in] add denotes whether the values are added or subtracted from the result vectors
+     * @param[in] strategy the strategy used to accumulate the results
+     * @return the used accumulation strategy
+     */
+    accumulation_strategy run_device_kernel(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, real_type add, accumulation_strategy strategy = accumulation_strategy::automatic);
+    /**
+     * @brief Solve the system of linear equations using the mixed-precision CG algorithm, i.e., calculate the kernel matrix-vector products in single precision and iteratively refine the solution in double precision.
+     * @details Only used if #mixed_precision_ is `true` and #real_type is `double`.
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] x0 the initial guess
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] q subvector of the least-squares matrix equation
+     * @return the alpha values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> mixed_precision_solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, std::size_t imax, real_type eps, const std::vector<real_type> &q);
+
+    /**
+     * @brief Prepare the kernel matrix-vector products in the precision @p U: either explicitly assemble the reduced kernel matrix into @p matrix if it fits into the memory budget or,
+     *        if the kernel matrix is recomputed in every CG iteration, create a tile cache in @p cache if #cache_size_ is greater than `0`.
+     * @tparam U the type used in the kernel matrix-vector products
+     * @param[in] q the `q` vector
+     * @param[in] data the data
+     * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+     * @param[out] matrix the explicitly assembled reduced kernel matrix
+     * @param[out] cache the kernel matrix tile cache
+     */
+    template <typename U>
+    void setup_kernel_matrix(const std::vector<U> &q, const aos_matrix<U> &data, U QA_cost, kernel_matrix<U> &matrix, std::unique_ptr<tile_cache<U>> &cache);
+    /**
+     * @brief Explicitly assemble the reduced kernel matrix in the precision @p U based on the value of @p kernel_.
+     * @tparam U the type used in the kernel matrix
+     * @param[in] q the `q` vector
+     * @param[in] data the data
+     * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+     * @return the assembled kernel matrix (`[[nodiscard]]`)
+     */
+    template <typename U>
+    [[nodiscard]] kernel_matrix<U> assemble_kernel_matrix(const std::vector<U> &q, const aos_matrix<U> &data, U QA_cost) const;
+    /**
+     * @brief Select the correct kernel in the precision @p U based on the value of @p kernel_ and run it on the CPU using OpenMP.
+     * @details If @p matrix has been assembled, it is used instead of @p q and @p data. Otherwise, the tiles cached in @p cache (if any) are reused.
+     * @tparam U the type used in the kernel matrix-vector products
+     * @tparam Vector the type of the result and right-hand side: `std::vector<U>` for a single or `std::vector<std::vector<U>>` for multiple right-hand sides
+     * @param[in] matrix the explicitly assembled reduced kernel matrix
+     * @param[in,out] cache the kernel matrix tile cache; may be `nullptr`
+     * @param[in] q the `q` vector
+     * @param[out] ret the result vector(s)
+     * @param[in] d the right-hand side(s) of the equation
+     * @param[in] data the data
+     * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+     * @param[in] add denotes whether the values are added or subtracted from the result vector
+     * @param[in] strategy the strategy used to accumulate the results
+     * @return the used accumulation strategy
      */
-    void run_device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type add);
+    template <typename U, typename Vector>
+    accumulation_strategy run_device_kernel(const kernel_matrix<U> &matrix, tile_cache<U> *cache, const std::vector<U> &q, Vector &ret, const Vector &d, const aos_matrix<U> &data, U QA_cost, U add, accumulation_strategy strategy) const;
+
+    /// The size of the tiles the kernel matrix is split into.
+    const std::size_t tile_size_;
+    /// The explicitly assembled reduced kernel matrix if plssvm::solver_type::cg_explicit is used during solver_CG().
+    kernel_matrix<real_type> kernel_matrix_{};
+    /// The memory (in MiB) used to cache kernel matrix tiles if plssvm::solver_type::cg_implicit is used. If `0`, no cache is used.
+    const std::size_t cache_size_;
+    /// The kernel matrix tile cache used during solver_CG() if plssvm::solver_type::cg_implicit is used and #cache_size_ is greater than `0`.
+    std::unique_ptr<tile_cache<real_type>> tile_cache_{};
 };
 
 extern template class csvm<float>;
@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a minimal SIMD vector abstraction used in the register-blocked OpenMP kernels.
+ * @details The instruction set is selected at compile time: AVX-512 if `__AVX512F__` is defined, AVX2 if `__AVX2__` and `__FMA__` are defined,
+ *          and a portable scalar fallback otherwise.
+ */
+
+#pragma once
+
+#include "plssvm/constants.hpp"  // plssvm::kernel_index_type
+
+#include <cmath>  // std::fma
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+    #include <immintrin.h>  // AVX2 and AVX-512 intrinsics
+#endif
+
+namespace plssvm::openmp::detail::simd {
+
+/**
+ * @brief A SIMD vector containing `width` values of type @p T.
+ * @details Provides unaligned loads, FMA, and a horizontal reduction.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct vec;
+
+#if defined(__AVX512F__)
+
+/// The name of the used instruction set.
+inline constexpr const char *instruction_set = "AVX-512";
+/// The number of rows and columns of a register block, chosen such that the accumulators and operands fit into the 32 vector registers.
+inline constexpr kernel_index_type register_block_size = 4;
+
+template <>
+struct vec<float> {
+    /// The number of values in one SIMD vector.
+    static constexpr kernel_index_type width = 16;
+    /// The underlying SIMD register.
+    __m512 value;
+
+    [[nodiscard]] static vec zero() noexcept { return { _mm512_setzero_ps() }; }
+    [[nodiscard]] static vec load(const float *ptr) noexcept { return { _mm512_loadu_ps(ptr) }; }
+    [[nodiscard]] friend vec fma(const vec a, const vec b, const vec c) noexcept { return { _mm512_fmadd_ps(a.value, b.value, c.value) }; }
+    [[nodiscard]] friend float reduce_add(const vec a) noexcept {
+        // note: _mm512_reduce_add_ps triggers false-positive -Wmaybe-uninitialized warnings in some GCC versions
+        alignas(64) float values[width];
+        _mm512_store_ps(values, a.value);
+        float sum{ 0.0 };
+        for (const float val : values) {
+            sum += val;
+        }
+        return sum;
+    }
+};
+
+template <>
+struct vec<double> {
+    /// The number of values in one SIMD vector.
+    static constexpr kernel_index_type width = 8;
+    /// The underlying SIMD register.
+    __m512d value;
+
+    [[nodiscard]] static vec zero() noexcept { return { _mm512_setzero_pd() }; }
+    [[nodiscard]] static vec load(const double *ptr) noexcept { return { _mm512_loadu_pd(ptr) }; }
+    [[nodiscard]] friend vec fma(const vec a, const vec b, const vec c) noexcept { return { _mm512_fmadd_pd(a.value, b.value, c.value) }; }
+    [[nodiscard]] friend double reduce_add(const vec a) noexcept {
+        // note: _mm512_reduce_add_pd triggers false-positive -Wmaybe-uninitialized warnings in some GCC versions
+        alignas(64) double values[width];
+        _mm512_store_pd(values, a.value);
+        double sum{ 0.0 };
+        for (const double val : values) {
+            sum += val;
+        }
+        return sum;
+    }
+};
+
+#elif defined(__AVX2__) && defined(__FMA__)
+
+/// The name of the used instruction set.
+inline constexpr const char *instruction_set = "AVX2";
+/// The number of rows and columns of a register block, chosen such that the accumulators and operands fit into the 16 vector registers.
+inline constexpr kernel_index_type register_block_size = 3;
+
+template <>
+struct vec<float> {
+    /// The number of values in one SIMD vector.
+    static constexpr kernel_index_type width = 8;
+    /// The underlying SIMD register.
+    __m256 value;
+
+    [[nodiscard]] static vec zero() noexcept { return { _mm256_setzero_ps() }; }
+    [[nodiscard]] static vec load(const float *ptr) noexcept { return { _mm256_loadu_ps(ptr) }; }
+    [[nodiscard]] friend vec fma(const vec a, const vec b, const vec c) noexcept { return { _mm256_fmadd_ps(a.value, b.value, c.value) }; }
+    [[nodiscard]] friend float reduce_add(const vec a) noexcept {
+        __m128 sum = _mm_add_ps(_mm256_castps256_ps128(a.value), _mm256_extractf128_ps(a.value, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+        return _mm_cvtss_f32(sum);
+    }
+};
+
+template <>
+struct vec<double> {
+    /// The number of values in one SIMD vector.
+    static constexpr kernel_index_type width = 4;
+    /// The underlying SIMD register.
+    __m256d value;
+
+    [[nodiscard]] static vec zero() noexcept { return { _mm256_setzero_pd() }; }
+    [[nodiscard]] static vec load(const double *ptr) noexcept { return { _mm256_loadu_pd(ptr) }; }
+    [[nodiscard]] friend vec fma(const vec a, const vec b, const vec c) noexcept { return { _mm256_fmadd_pd(a.value, b.value, c.value) }; }
+    [[nodiscard]] friend double reduce_add(const vec a) noexcept {
+        const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(a.value), _mm256_extractf128_pd(a.value, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    }
+};
+
+#else
+
+/// The name of the used instruction set.
+inline constexpr const char *instruction_set = "scalar";
+/// The number of rows and columns of a register block.
+inline constexpr kernel_index_type register_block_size = 4;
+
+template <typename T>
+struct vec {
+    /// The number of values in one SIMD vector.
+    static constexpr kernel_index_type width = 1;
+    /// The underlying SIMD register.
+    T value;
+
+    [[nodiscard]] static vec zero() noexcept { return { T{ 0.0 } }; }
+    [[nodiscard]] static vec load(const T *ptr) noexcept { return { *ptr }; }
+    [[nodiscard]] friend vec fma(const vec a, const vec b, const vec c) noexcept { return { std::fma(a.value, b.value, c.value) }; }
+    [[nodiscard]] friend T reduce_add(const vec a) noexcept { return a.value; }
+};
+
+#endif
+
+}  // namespace plssvm::openmp::detail::simd
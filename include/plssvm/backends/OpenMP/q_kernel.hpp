@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "plssvm/matrix.hpp"  // plssvm::aos_matrix
+
 #include <vector>  // std::vector
 
 namespace plssvm::openmp {
@@ -22,7 +24,7 @@ namespace plssvm::openmp {
  * @param[in] data the two-dimensional data matrix
  */
 template <typename real_type>
-void device_kernel_q_linear(std::vector<real_type> &q, const std::vector<std::vector<real_type>> &data);
+void device_kernel_q_linear(std::vector<real_type> &q, const aos_matrix<real_type> &data);
 
 /**
  * @brief Calculates the `q` vector using the polynomial C-SVM kernel.
@@ -34,7 +36,7 @@ void device_kernel_q_linear(std::vector<real_type> &q, const std::vector<std::ve
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
  */
 template <typename real_type>
-void device_kernel_q_poly(std::vector<real_type> &q, const std::vector<std::vector<real_type>> &data, int degree, real_type gamma, real_type coef0);
+void device_kernel_q_poly(std::vector<real_type> &q, const aos_matrix<real_type> &data, int degree, real_type gamma, real_type coef0);
 
 /**
  * @brief Calculates the `q` vector using the radial basis functions C-SVM kernel.
@@ -42,8 +44,9 @@ void device_kernel_q_poly(std::vector<real_type> &q, const std::vector<std::vect
  * @param[out] q the calculated `q` vector
  * @param[in] data the two-dimensional data matrix
  * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] fast_exp if `true`, plssvm::detail::fast_exp is used instead of `std::exp`
  */
 template <typename real_type>
-void device_kernel_q_radial(std::vector<real_type> &q, const std::vector<std::vector<real_type>> &data, real_type gamma);
+void device_kernel_q_radial(std::vector<real_type> &q, const aos_matrix<real_type> &data, real_type gamma, bool fast_exp = false);
 
 }  // namespace plssvm::openmp
\ No newline at end of file
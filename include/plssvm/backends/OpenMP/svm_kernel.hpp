@@ -11,10 +11,163 @@
 
 #pragma once
 
-#include <vector>  // std::vector
+#include "plssvm/backends/OpenMP/tile_cache.hpp"  // plssvm::openmp::tile_cache
+#include "plssvm/matrix.hpp"                      // plssvm::aos_matrix
+
+#include <cstddef>  // std::size_t
+#include <iosfwd>   // forward declare std::ostream
+#include <memory>   // std::unique_ptr
+#include <utility>  // std::pair
+#include <vector>   // std::vector
 
 namespace plssvm::openmp {
 
+/**
+ * @brief Enum class for the different strategies to accumulate the contributions of the symmetric kernel matrix tiles into the result vector.
+ */
+enum class accumulation_strategy {
+    /** Select plssvm::openmp::accumulation_strategy::thread_private if the additional memory isn't too large, otherwise plssvm::openmp::accumulation_strategy::atomic. */
+    automatic,
+    /** Each thread accumulates into its own result vector, afterwards all vectors are reduced in parallel. No atomics are necessary. */
+    thread_private,
+    /** All threads directly accumulate into the shared result vector using atomic updates. Needs no additional memory. */
+    atomic
+};
+
+/**
+ * @brief Output the @p strategy to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the accumulation strategy to
+ * @param[in] strategy the accumulation strategy
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, accumulation_strategy strategy);
+
+/**
+ * @brief Round the requested @p tile_size up to a multiple of the register block size used in the OpenMP kernels.
+ * @param[in] tile_size the requested tile size
+ * @return the tile size actually used (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t round_tile_size(std::size_t tile_size);
+
+/**
+ * @brief Enumerate all tiles of size @p tile_size x @p tile_size on and below the diagonal of a @p dept x @p dept matrix.
+ * @details The tiles are ordered by decreasing cost, i.e., the number of matrix entries that must be calculated.
+ *          Scheduling them dynamically in this order balances the work between the threads.
+ * @param[in] dept the size of the matrix
+ * @param[in] tile_size the size of one tile
+ * @return the first row and first column of each tile (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<std::pair<std::size_t, std::size_t>> lower_triangular_tiles(std::size_t dept, std::size_t tile_size);
+
+/**
+ * @brief Resolve plssvm::openmp::accumulation_strategy::automatic to the concrete accumulation strategy used for @p dept data points and @p num_threads OpenMP threads.
+ * @tparam real_type the type of the data
+ * @param[in] strategy the requested accumulation strategy
+ * @param[in] dept the size of the result vector
+ * @param[in] num_threads the number of OpenMP threads
+ * @return the concrete accumulation strategy (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] accumulation_strategy resolve_accumulation_strategy(accumulation_strategy strategy, std::size_t dept, int num_threads);
+
+/**
+ * @brief The explicitly assembled lower triangular part of the symmetric reduced kernel matrix, including the `QA_cost`, `q`, and cost terms.
+ * @details The matrix is stored tile by tile in the order given by plssvm::openmp::lower_triangular_tiles, each tile as `tile_size * tile_size` row-major values.
+ *          Only the entries on and below the diagonal of the matrix are meaningful.
+ * @tparam real_type the type of the data
+ */
+template <typename real_type>
+struct kernel_matrix {
+    /// The size of the matrix.
+    std::size_t dept{ 0 };
+    /// The size of the tiles (a multiple of the register block size).
+    std::size_t tile_size{ 0 };
+    /// The first row and first column of each stored tile.
+    std::vector<std::pair<std::size_t, std::size_t>> tiles{};
+    /// The tiles stored consecutively; `nullptr` if no matrix has been assembled.
+    std::unique_ptr<real_type[]> data{};
+};
+
+/**
+ * @brief Calculate the number of bytes necessary to explicitly store the reduced kernel matrix of size @p dept x @p dept using tiles of size @p tile_size.
+ * @tparam real_type the type of the data
+ * @param[in] dept the size of the matrix
+ * @param[in] tile_size the size of the tiles (rounded up to a multiple of the register block size)
+ * @return the number of bytes (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::size_t kernel_matrix_size(std::size_t dept, std::size_t tile_size);
+
+/**
+ * @brief Explicitly assemble the reduced kernel matrix using the linear kernel function.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @return the assembled kernel matrix (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] kernel_matrix<real_type> assemble_kernel_matrix_linear(const std::vector<real_type> &q, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, std::size_t tile_size);
+
+/**
+ * @brief Explicitly assemble the reduced kernel matrix using the polynomial kernel function.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] degree the degree parameter used in the polynomial kernel function
+ * @param[in] gamma the gamma parameter used in the polynomial kernel function
+ * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @return the assembled kernel matrix (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] kernel_matrix<real_type> assemble_kernel_matrix_poly(const std::vector<real_type> &q, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, int degree, real_type gamma, real_type coef0, std::size_t tile_size);
+
+/**
+ * @brief Explicitly assemble the reduced kernel matrix using the radial basis function kernel function.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] fast_exp if `true`, plssvm::detail::fast_exp is used instead of `std::exp`
+ * @return the assembled kernel matrix (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] kernel_matrix<real_type> assemble_kernel_matrix_radial(const std::vector<real_type> &q, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type gamma, std::size_t tile_size, bool fast_exp = false);
+
+/**
+ * @brief Calculates the C-SVM kernel using the explicitly assembled @p matrix, i.e., a symmetric matrix-vector multiplication without any kernel function evaluations.
+ * @tparam real_type the type of the data
+ * @param[in] matrix the explicitly assembled reduced kernel matrix
+ * @param[in] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] strategy the strategy used to accumulate the results
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_explicit(const kernel_matrix<real_type> &matrix, std::vector<real_type> &ret, const std::vector<real_type> &d, real_type add, accumulation_strategy strategy = accumulation_strategy::automatic);
+
+/**
+ * @brief Calculates the C-SVM kernel for all right-hand sides @p d at once using the explicitly assembled @p matrix, i.e., each tile of the matrix is read only once and used for all right-hand sides.
+ * @tparam real_type the type of the data
+ * @param[in] matrix the explicitly assembled reduced kernel matrix
+ * @param[in,out] ret the result vectors, one for each right-hand side
+ * @param[in] d the right-hand sides of the equation
+ * @param[in] add denotes whether the values are added or subtracted from the result vectors
+ * @param[in] strategy the strategy used to accumulate the results
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_explicit(const kernel_matrix<real_type> &matrix, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, real_type add, accumulation_strategy strategy = accumulation_strategy::automatic);
+
 /**
  * @brief Calculates the C-SVM kernel using the linear kernel function.
  * @tparam real_type the type of the data
@@ -25,9 +178,31 @@ namespace plssvm::openmp {
  * @param[in] QA_cost he bottom right matrix entry multiplied by cost
  * @param[in] cost 1 / the cost parameter in the C-SVM
  * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @return the used accumulation strategy
  */
 template <typename real_type>
-void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add);
+accumulation_strategy device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type add, std::size_t tile_size, accumulation_strategy strategy = accumulation_strategy::automatic, tile_cache<real_type> *cache = nullptr);
+
+/**
+ * @brief Calculates the C-SVM kernel for all right-hand sides @p d at once using the linear kernel function, i.e., each kernel matrix entry is calculated only once and used for all right-hand sides.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[in,out] ret the result vectors, one for each right-hand side
+ * @param[in] d the right-hand sides of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vectors
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_linear(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type add, std::size_t tile_size, accumulation_strategy strategy = accumulation_strategy::automatic, tile_cache<real_type> *cache = nullptr);
 
 /**
  * @brief Calculates the C-SVM kernel using the polynomial kernel function.
@@ -42,9 +217,34 @@ void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type
  * @param[in] degree the degree parameter used in the polynomial kernel function
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_poly(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type add, int degree, real_type gamma, real_type coef0, std::size_t tile_size, accumulation_strategy strategy = accumulation_strategy::automatic, tile_cache<real_type> *cache = nullptr);
+
+/**
+ * @brief Calculates the C-SVM kernel for all right-hand sides @p d at once using the polynomial kernel function, i.e., each kernel matrix entry is calculated only once and used for all right-hand sides.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[in,out] ret the result vectors, one for each right-hand side
+ * @param[in] d the right-hand sides of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vectors
+ * @param[in] degree the degree parameter used in the polynomial kernel function
+ * @param[in] gamma the gamma parameter used in the polynomial kernel function
+ * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @return the used accumulation strategy
  */
 template <typename real_type>
-void device_kernel_poly(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, int degree, real_type gamma, real_type coef0);
+accumulation_strategy device_kernel_poly(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type add, int degree, real_type gamma, real_type coef0, std::size_t tile_size, accumulation_strategy strategy = accumulation_strategy::automatic, tile_cache<real_type> *cache = nullptr);
 
 /**
  * @brief Calculates the C-SVM kernel using the radial basis function kernel function.
@@ -57,8 +257,49 @@ void device_kernel_poly(const std::vector<real_type> &q, std::vector<real_type>
  * @param[in] cost 1 / the cost parameter in the C-SVM
  * @param[in] add denotes whether the values are added or subtracted from the result vector
  * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @param[in] fast_exp if `true`, plssvm::detail::fast_exp is used instead of `std::exp`
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_radial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type add, real_type gamma, std::size_t tile_size, accumulation_strategy strategy = accumulation_strategy::automatic, tile_cache<real_type> *cache = nullptr, bool fast_exp = false);
+
+/**
+ * @brief Calculates the C-SVM kernel for all right-hand sides @p d at once using the radial basis function kernel function, i.e., each kernel matrix entry is calculated only once and used for all right-hand sides.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[in,out] ret the result vectors, one for each right-hand side
+ * @param[in] d the right-hand sides of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vectors
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @param[in] fast_exp if `true`, plssvm::detail::fast_exp is used instead of `std::exp`
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_radial(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, real_type QA_cost, real_type cost, real_type add, real_type gamma, std::size_t tile_size, accumulation_strategy strategy = accumulation_strategy::automatic, tile_cache<real_type> *cache = nullptr, bool fast_exp = false);
+
+/**
+ * @brief Add the decision values of all @p points using the radial basis function kernel function to @p out.
+ * @details The squared euclidean distances are calculated as \f$\|x\|^2 + \|y\|^2 - 2 x^T y\f$ (small negative values due to cancellation are clamped to `0`),
+ *          i.e., the dot products between the points and the data points are calculated tile by tile like a matrix-matrix multiplication.
+ * @tparam real_type the type of the data
+ * @param[in,out] out the decision values, one for each point
+ * @param[in] data the data points of the model
+ * @param[in] alpha the weights of the data points
+ * @param[in] points the points to predict
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] tile_size the size of the tiles the points and data points are split into (rounded up to a multiple of the register block size)
+ * @param[in] fast_exp if `true`, plssvm::detail::fast_exp is used instead of `std::exp`
  */
 template <typename real_type>
-void device_kernel_radial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, real_type gamma);
+void device_kernel_predict_radial(std::vector<real_type> &out, const aos_matrix<real_type> &data, const std::vector<real_type> &alpha, const aos_matrix<real_type> &points, real_type gamma, std::size_t tile_size, bool fast_exp = false);
 
 }  // namespace plssvm::openmp
\ No newline at end of file
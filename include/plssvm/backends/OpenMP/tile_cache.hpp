@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a thread-safe, bounded least-recently-used cache for the tiles of the reduced kernel matrix used in the OpenMP backend.
+ */
+
+#pragma once
+
+#include <cstddef>      // std::size_t
+#include <list>         // std::list
+#include <memory>       // std::unique_ptr
+#include <mutex>        // std::mutex
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief A bounded least-recently-used (LRU) cache for the tiles of the reduced kernel matrix.
+ * @details The tiles are identified by their index in the list returned by plssvm::openmp::lower_triangular_tiles.
+ *          A tile returned by acquire() is pinned, i.e., it can't be evicted by other threads, until it is released again using release().
+ *
+ *          A matrix-vector multiplication visits every tile exactly once. Visiting the tiles always in the same order would evict each tile right
+ *          before it is needed again if not all tiles fit into the cache. Therefore, the order is reversed after each finished sweep such that the most
+ *          recently used tiles are visited first.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class tile_cache {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+
+    /**
+     * @brief The result of a cache lookup.
+     */
+    struct lookup_result {
+        /// Pointer to the cached tile; `nullptr` if all cache slots are currently pinned by other threads.
+        real_type *tile;
+        /// `true` if the tile is already cached, `false` if it must be calculated into #tile.
+        bool hit;
+    };
+
+    /**
+     * @brief Construct a cache for @p num_tiles tiles of size @p tile_size x @p tile_size using at most @p cache_size bytes.
+     * @param[in] num_tiles the total number of tiles of the kernel matrix
+     * @param[in] tile_size the size of one tile
+     * @param[in] cache_size the maximum memory used by the cached tiles in bytes
+     */
+    tile_cache(std::size_t num_tiles, std::size_t tile_size, std::size_t cache_size);
+
+    /**
+     * @brief Lookup the tile @p tile and pin it. On a cache miss, the least recently used unpinned tile is evicted.
+     * @param[in] tile the index of the tile
+     * @return the pinned cache slot and whether the tile has already been cached (`[[nodiscard]]`)
+     */
+    [[nodiscard]] lookup_result acquire(std::size_t tile);
+    /**
+     * @brief Unpin the tile @p tile previously returned by acquire().
+     * @param[in] tile the index of the tile
+     */
+    void release(std::size_t tile);
+    /**
+     * @brief Mark the end of a sweep over all tiles, i.e., reverse the order in which the tiles are visited.
+     */
+    void finish_sweep() noexcept { reversed_ = !reversed_; }
+    /**
+     * @brief Return the index of the tile visited at position @p pos in the current sweep.
+     * @param[in] pos the position in the current sweep
+     * @return the tile index (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t tile_at(const std::size_t pos) const noexcept { return reversed_ ? num_tiles_ - 1 - pos : pos; }
+
+    /**
+     * @brief Return the total number of tiles of the kernel matrix.
+     * @return the number of tiles (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_tiles() const noexcept { return num_tiles_; }
+    /**
+     * @brief Return the size of one tile.
+     * @return the tile size (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t tile_size() const noexcept { return tile_size_; }
+    /**
+     * @brief Return the maximum number of tiles that can be cached simultaneously.
+     * @return the number of cache slots (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept { return tile_of_slot_.size(); }
+    /**
+     * @brief Return the number of cache hits so far.
+     * @return the number of cache hits (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_hits() const noexcept { return num_hits_; }
+    /**
+     * @brief Return the number of cache misses so far.
+     * @return the number of cache misses (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_misses() const noexcept { return num_misses_; }
+
+  private:
+    /// The total number of tiles of the kernel matrix.
+    const std::size_t num_tiles_;
+    /// The size of one tile.
+    const std::size_t tile_size_;
+    /// If `true`, the tiles are visited in reversed order in the current sweep.
+    bool reversed_{ false };
+
+    /// Guards all cache bookkeeping.
+    std::mutex mutex_{};
+    /// The cache slot of each tile or `num_slots` if the tile isn't cached.
+    std::vector<std::size_t> slot_of_tile_{};
+    /// The tile stored in each cache slot or `num_tiles_` if the slot is unused.
+    std::vector<std::size_t> tile_of_slot_{};
+    /// The number of threads currently using each cache slot.
+    std::vector<unsigned int> pin_count_{};
+    /// The cache slots ordered from the most to the least recently used.
+    std::list<std::size_t> lru_list_{};
+    /// The position of each cache slot in #lru_list_.
+    std::vector<std::list<std::size_t>::iterator> lru_pos_{};
+    /// The cached tiles, each consisting of `tile_size * tile_size` values.
+    std::unique_ptr<real_type[]> data_{};
+
+    /// The number of cache hits.
+    std::size_t num_hits_{ 0 };
+    /// The number of cache misses.
+    std::size_t num_misses_{ 0 };
+};
+
+extern template class tile_cache<float>;
+extern template class tile_cache<double>;
+
+}  // namespace plssvm::openmp
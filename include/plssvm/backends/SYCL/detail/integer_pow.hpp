@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the power function with an integer exponent used in the polynomial kernel function on the device.
+ */
+
+#pragma once
+
+#include "plssvm/detail/integer_pow.hpp"  // plssvm::detail::integer_pow
+
+#include "sycl/sycl.hpp"  // sycl::pow
+
+namespace plssvm::sycl::detail {
+
+/**
+ * @brief Calculate @p base to the power of @p degree.
+ * @details If @p unrolled_degree isn't `0`, the power is unrolled into multiplications at compile-time and @p degree is ignored. Otherwise, `sycl::pow` is used.
+ * @tparam unrolled_degree the degree known at compile-time or `0` to use the runtime @p degree
+ * @tparam real_type the type of the data
+ * @param[in] base the base
+ * @param[in] degree the runtime degree
+ * @return \f$base^{degree}\f$ (`[[nodiscard]]`)
+ */
+template <int unrolled_degree, typename real_type>
+[[nodiscard]] inline real_type integer_pow(const real_type base, const int degree) {
+    if constexpr (unrolled_degree == 0) {
+        return ::sycl::pow(base, static_cast<real_type>(degree));
+    } else {
+        return ::plssvm::detail::integer_pow<unrolled_degree>(base);
+    }
+}
+
+}  // namespace plssvm::sycl::detail
@@ -11,8 +11,9 @@
 
 #pragma once
 
-#include "plssvm/backends/SYCL/detail/atomics.hpp"  // plssvm::sycl::atomic_op
-#include "plssvm/constants.hpp"                     // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/backends/SYCL/detail/atomics.hpp"      // plssvm::sycl::atomic_op
+#include "plssvm/backends/SYCL/detail/integer_pow.hpp"  // plssvm::sycl::detail::integer_pow
+#include "plssvm/constants.hpp"                         // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 
 #include "sycl/sycl.hpp"  // sycl::nd_item, sycl::range, sycl::pow, sycl::exp
 
@@ -72,8 +73,9 @@ class device_kernel_w_linear {
  * @brief Predicts the labels for data points using the polynomial kernel function.
  * @details Currently only single GPU execution is supported.
  * @tparam T the type of the data points
+ * @tparam unrolled_degree the degree of the polynomial kernel function unrolled into multiplications at compile-time or `0` to use the runtime degree
  */
-template <typename T>
+template <typename T, int unrolled_degree = 0>
 class device_kernel_predict_poly {
   public:
     /// The type of the data.
@@ -116,7 +118,7 @@ class device_kernel_predict_poly {
                 }
             }
 
-            temp = alpha_d_[data_point_index] * ::sycl::pow(gamma_ * temp + coef0_, static_cast<real_type>(degree_));
+            temp = alpha_d_[data_point_index] * detail::integer_pow<unrolled_degree>(gamma_ * temp + coef0_, degree_);
 
             atomic_op<real_type>{ out_d_[predict_point_index] } += temp;
         }
@@ -11,7 +11,8 @@
 
 #pragma once
 
-#include "plssvm/constants.hpp"  // plssvm::kernel_index_type
+#include "plssvm/backends/SYCL/detail/integer_pow.hpp"  // plssvm::sycl::detail::integer_pow
+#include "plssvm/constants.hpp"                         // plssvm::kernel_index_type
 
 #include "sycl/sycl.hpp"  // sycl::nd_item, sycl::pow, sycl::exp
 
@@ -65,8 +66,9 @@ class device_kernel_q_linear {
  * @brief Functor to calculate the `q` vector using the polynomial C-SVM kernel.
  * @details Currently only single GPU execution is supported.
  * @tparam T the type of the data
+ * @tparam unrolled_degree the degree of the polynomial kernel function unrolled into multiplications at compile-time or `0` to use the runtime degree
  */
-template <typename T>
+template <typename T, int unrolled_degree = 0>
 class device_kernel_q_poly {
   public:
     /// The type of the data.
@@ -97,7 +99,7 @@ class device_kernel_q_poly {
         for (kernel_index_type i = 0; i < num_cols_; ++i) {
             temp += data_d_[i * num_rows_ + index] * data_last_[i];
         }
-        q_[index] = ::sycl::pow(gamma_ * temp + coef0_, static_cast<real_type>(degree_));
+        q_[index] = detail::integer_pow<unrolled_degree>(gamma_ * temp + coef0_, degree_);
     }
 
   private:
@@ -11,8 +11,9 @@
 
 #pragma once
 
-#include "plssvm/backends/SYCL/detail/constants.hpp"  // PLSSVM_SYCL_BACKEND_COMPILER_DPCPP, PLSSVM_SYCL_BACKEND_COMPILER_HIPSYCL
-#include "plssvm/constants.hpp"                       // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/backends/SYCL/detail/constants.hpp"    // PLSSVM_SYCL_BACKEND_COMPILER_DPCPP, PLSSVM_SYCL_BACKEND_COMPILER_HIPSYCL
+#include "plssvm/backends/SYCL/detail/integer_pow.hpp"  // plssvm::sycl::detail::integer_pow
+#include "plssvm/constants.hpp"                         // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 
 #include "sycl/sycl.hpp"  // sycl::nd_item, sycl::handler, sycl::accessor, sycl::access::mode, sycl::access::target, sycl::range, sycl::group_barrier, sycl::pow,
                           // sycl::exp, sycl::atomic_ref, sycl::memory_order, sycl::memory_scope, sycl::access::address_space
@@ -153,8 +154,9 @@ class device_kernel_linear {
  * @brief Calculates the C-SVM kernel using the polynomial kernel function.
  * @details Currently only single GPU execution is supported.
  * @tparam T the type of the data
+ * @tparam unrolled_degree the degree of the polynomial kernel function unrolled into multiplications at compile-time or `0` to use the runtime degree
  */
-template <typename T>
+template <typename T, int unrolled_degree = 0>
 class device_kernel_poly {
   public:
     /// The type of the data.
@@ -231,7 +233,7 @@ class device_kernel_poly {
                 real_type ret_jx = 0.0;
                 #pragma unroll INTERNAL_BLOCK_SIZE
                 for (kernel_index_type y = 0; y < INTERNAL_BLOCK_SIZE; ++y) {
-                    const real_type temp = (::sycl::pow(gamma_ * matr[x][y] + coef0_, static_cast<real_type>(degree_)) + QA_cost_ - q_[i + y] - q_[j + x]) * add_;
+                    const real_type temp = (detail::integer_pow<unrolled_degree>(gamma_ * matr[x][y] + coef0_, degree_) + QA_cost_ - q_[i + y] - q_[j + x]) * add_;
                     if (i + x > j + y) {
                         // upper triangular matrix
                         atomic_op<real_type>{ ret_[i + y] } += temp * d_[j + x];
@@ -11,7 +11,8 @@
 
 #pragma once
 
-#include "plssvm/csvm.hpp"  // plssvm::csvm
+#include "plssvm/csvm.hpp"    // plssvm::csvm
+#include "plssvm/matrix.hpp"  // plssvm::aos_matrix
 
 #include <cstddef>  // std::size_t
 #include <vector>   // std::vector
@@ -49,10 +50,14 @@ class gpu_csvm : public csvm<T> {
     using base_type::epsilon_;
     using base_type::gamma_;
     using base_type::kernel_;
+    using base_type::mixed_precision_;
     using base_type::num_data_points_;
     using base_type::num_features_;
     using base_type::print_info_;
     using base_type::QA_cost_;
+    using base_type::replace_interval_;
+    using base_type::replace_threshold_;
+    using base_type::solver_;
     using base_type::target_;
     using base_type::value_ptr_;
     using base_type::w_;
@@ -69,6 +74,7 @@ class gpu_csvm : public csvm<T> {
      * @brief Construct a new C-SVM using any GPU backend with the parameters given through @p params.
      * @param[in] params struct encapsulating all possible parameters
      * @throws plssvm::csvm::csvm() exceptions
+     * @throws plssvm::exception if plssvm::solver_type::cg_explicit has been requested (the GPU backends always use the implicit kernel matrix)
      */
     explicit gpu_csvm(const parameter<T> &params);
 
@@ -80,10 +86,7 @@ class gpu_csvm : public csvm<T> {
     //*************************************************************************************************************************************//
     //                                                functions inherited from plssvm::csvm                                                //
     //*************************************************************************************************************************************//
-    /**
-     * @copydoc plssvm::csvm::predict(const std::vector<std::vector<real_type>>&)
-     */
-    [[nodiscard]] std::vector<real_type> predict(const std::vector<std::vector<real_type>> &points) final;
+    using base_type::predict;
 
   protected:
     /**
@@ -97,11 +100,23 @@ class gpu_csvm : public csvm<T> {
     /**
      * @copydoc plssvm::csvm::solver_CG
      */
-    std::vector<real_type> solver_CG(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &q) final;
+    std::vector<real_type> solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, std::size_t imax, real_type eps, const std::vector<real_type> &q) final;
+    /**
+     * @copydoc plssvm::csvm::solver_CG_cost_path
+     */
+    std::vector<std::vector<real_type>> solver_CG_cost_path(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &q, const std::vector<real_type> &costs) final;
+    /**
+     * @copydoc plssvm::csvm::solver_CG_block
+     */
+    std::vector<std::vector<real_type>> solver_CG_block(const std::vector<std::vector<real_type>> &B, std::size_t imax, real_type eps, const std::vector<real_type> &q, const std::vector<std::size_t> &folds) final;
     /**
      * @copydoc plssvm::csvm::update_w
      */
     void update_w() final;
+    /**
+     * @copydoc plssvm::csvm::predict(const aos_matrix<real_type>&)
+     */
+    [[nodiscard]] std::vector<real_type> predict(const aos_matrix<real_type> &points) final;
 
     /**
      * @brief Run the SVM kernel on the GPU denoted by the @p device ID.
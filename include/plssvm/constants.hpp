@@ -30,16 +30,24 @@ constexpr kernel_index_type INTERNAL_BLOCK_SIZE = PLSSVM_INTERNAL_BLOCK_SIZE;
 constexpr kernel_index_type INTERNAL_BLOCK_SIZE = 6;
 #endif
 
-/// Global compile-time constant used for internal caching in the OpenMP kernel.
-#if defined(PLSSVM_OPENMP_BLOCK_SIZE)
-constexpr kernel_index_type OPENMP_BLOCK_SIZE = PLSSVM_OPENMP_BLOCK_SIZE;
+/// Global compile-time constant: the number of features processed at once in the OpenMP kernel such that a block of data points stays in the cache.
+#if defined(PLSSVM_OPENMP_FEATURE_BLOCK_SIZE)
+constexpr kernel_index_type OPENMP_FEATURE_BLOCK_SIZE = PLSSVM_OPENMP_FEATURE_BLOCK_SIZE;
 #else
-constexpr kernel_index_type OPENMP_BLOCK_SIZE = 64;
+constexpr kernel_index_type OPENMP_FEATURE_BLOCK_SIZE = 256;
 #endif
 
+/// Global compile-time constant: the number of data points whose explicit features are accumulated at once in the shared normal equations of a least-squares problem in a feature space.
+constexpr kernel_index_type FEATURE_SPACE_BLOCK_SIZE = 256;
+
+/// Global compile-time constant: the alignment (in bytes) of the data matrices and the granularity to which their rows are padded.
+constexpr kernel_index_type MATRIX_ALIGNMENT = 64;
+
 // perform sanity checks
 static_assert(THREAD_BLOCK_SIZE > 0, "THREAD_BLOCK_SIZE must be greater than 0!");
 static_assert(INTERNAL_BLOCK_SIZE > 0, "INTERNAL_BLOCK_SIZE must be greater than 0!");
-static_assert(OPENMP_BLOCK_SIZE > 0, "OPENMP_BLOCK_SIZE must be greater than 0!");
+static_assert(OPENMP_FEATURE_BLOCK_SIZE > 0, "OPENMP_FEATURE_BLOCK_SIZE must be greater than 0!");
+static_assert(FEATURE_SPACE_BLOCK_SIZE > 0, "FEATURE_SPACE_BLOCK_SIZE must be greater than 0!");
+static_assert(MATRIX_ALIGNMENT > 0 && (MATRIX_ALIGNMENT & (MATRIX_ALIGNMENT - 1)) == 0, "MATRIX_ALIGNMENT must be a power of two!");
 
 }  // namespace plssvm
\ No newline at end of file
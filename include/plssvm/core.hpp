@@ -13,13 +13,20 @@
 
 #include "plssvm/csvm.hpp"
 #include "plssvm/csvm_factory.hpp"
+#include "plssvm/grid_search.hpp"
 
 #include "plssvm/parameter.hpp"
+#include "plssvm/parameter_compress.hpp"
+#include "plssvm/parameter_grid.hpp"
 #include "plssvm/parameter_predict.hpp"
 #include "plssvm/parameter_train.hpp"
 
 #include "plssvm/backend_types.hpp"
 #include "plssvm/kernel_types.hpp"
+#include "plssvm/landmark_selection_types.hpp"
+#include "plssvm/matrix.hpp"
+#include "plssvm/preconditioner_types.hpp"
+#include "plssvm/solver_types.hpp"
 #include "plssvm/target_platforms.hpp"
 
 #include "plssvm/exceptions/exceptions.hpp"
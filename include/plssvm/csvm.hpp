@@ -11,13 +11,20 @@
 
 #pragma once
 
-#include "plssvm/kernel_types.hpp"      // plssvm::kernel_type
-#include "plssvm/target_platforms.hpp"  // plssvm::target_platform
+#include "plssvm/detail/preconditioner.hpp"  // plssvm::detail::preconditioner
+#include "plssvm/kernel_types.hpp"           // plssvm::kernel_type
+#include "plssvm/landmark_selection_types.hpp"  // plssvm::landmark_selection_type
+#include "plssvm/matrix.hpp"                 // plssvm::aos_matrix
+#include "plssvm/preconditioner_types.hpp"   // plssvm::preconditioner_type
+#include "plssvm/solver_types.hpp"           // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"       // plssvm::target_platform
 
 #include <cstddef>      // std::size_t
+#include <functional>   // std::function
 #include <memory>       // std::shared_ptr
 #include <string>       // std::string
 #include <type_traits>  // std::is_same_v
+#include <utility>      // std::pair
 #include <vector>       // std::vector
 
 namespace plssvm {
@@ -47,9 +54,10 @@ class csvm {
      * @param[in] params struct encapsulating all possible parameters
      * @throws plssvm::exception if the given data pointer is the `nullptr`
      * @throws plssvm::exception if the data matrix is empty
-     * @throws plssvm::exception if not all points in the data matrix have the same number of features
      * @throws plssvm::exception if no features are provided for the data points
      * @throws plssvm::exception if weights are given, but the number of weights doesn't match the number of data points
+     * @throws plssvm::exception if a one-vs-all multi-class model is given, but the number of weight vectors or rho values doesn't match the number of classes
+     * @throws plssvm::exception if a model using random Fourier features is given, but the kernel function isn't the rbf kernel function or the number of weights doesn't match the number of random features
      */
     explicit csvm(const parameter<T> &params);
 
@@ -98,6 +106,9 @@ class csvm {
      * -0.23146635 0:5.765022e-01 1:1.014056e+00 2:1.300943e-01 3:7.261914e-01
      * 0.0034576654 0:1.884940e+00 1:1.005186e+00 2:2.984999e-01 3:1.646463e+00
      * @endcode
+     * A one-vs-all multi-class model additionally contains the entry `multiclass one_vs_all` and uses one rho value, label, and number of support vectors per class.
+     * The support vectors are grouped by their class and each one is preceded by its weight for every class.
+     * A model learned using learn_random_features() only contains the seed and the weights of the random features (see write_random_features_model()).
      * @param[in] filename name of the file to write the model information to
      * @throws plssvm::exception if a call to learn() is missing
      * @throws plssvm::exception if no labels are given
@@ -114,10 +125,166 @@ class csvm {
      * 1. Load the data onto the used device (e.g. one or more GPUs)
      * 2. Learn the model by solving a minimization problem using the Conjugated Gradients algorithm
      *
+     * If the original labels of the data points contain more than two classes, a one-vs-all multi-class model is learned using learn_labels(), i.e., all binary
+     * subproblems share the data on the device, the vector `q`, and the kernel matrix-vector products.
+     *
+     * If the weights of a previous model are known, e.g., after append_data(), the CG solver starts from these weights instead of the default initial guess.
+     *
+     * For the polynomial kernel function with a degree of at most three, the primal problem is solved in the exact finite feature space of the kernel function instead
+     * (see learn_polynomial_feature_map()) if its estimated costs are lower than the ones of the dual problem (see use_polynomial_feature_map()).
+     *
      * @throws plssvm::exception if no labels are given for training
      * @throws plssvm::exception if the number of labels and number of data points mismatch
      */
     void learn();
+    /**
+     * @brief Learns the support vectors like learn(), but starts the CG solver from the weights @p alpha of the @p support_vectors of a previously learned model, e.g., parsed from a model file.
+     * @details Each data point equal to one of the @p support_vectors (as written to a model file) keeps the weight of the support vector, all other data points start with a weight of zero.
+     *          If the data set only changed slightly since the previous model has been learned, the CG solver converges in far less iterations than starting from scratch.
+     * @param[in] support_vectors the support vectors of the previous model
+     * @param[in] alpha the weights of the @p support_vectors
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if the labels contain more than two classes
+     * @throws plssvm::exception if the number of @p support_vectors and weights mismatch
+     * @throws plssvm::exception if the number of features of the @p support_vectors exceeds the number of features of the data points
+     */
+    void learn(const aos_matrix<real_type> &support_vectors, const std::vector<real_type> &alpha);
+    /**
+     * @brief Append the data @p points with the original labels @p labels to the data used for training.
+     * @details If a binary model has been learned, the next call to learn() starts the CG solver from the weights of this model, where the new data points start with a weight of zero.
+     *          The model itself is discarded, i.e., learn() must be called before writing or using a model.
+     * @param[in] points the data points to append
+     * @param[in] labels the original labels of the data points to append
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if no data points are given or the number of @p labels and @p points mismatch
+     * @throws plssvm::exception if the number of features of the @p points and data points mismatch
+     */
+    void append_data(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &labels);
+    /**
+     * @brief Learns the models for all @p costs using a single multi-shift Conjugated Gradients solve.
+     * @details The cost parameter only enters the least-squares matrix as the term \f$\frac{1}{cost} (I + \mathbf{1} \mathbf{1}^T)\f$. After a symmetric transformation, the systems of all costs
+     *          only differ by a diagonal shift and, therefore, share the same Krylov space. Hence, the models for all costs are learned using roughly the number of matrix-vector products
+     *          necessary for the largest cost alone. No preconditioner is used, since it would break the shift invariance of the Krylov space.
+     * @param[in] costs the cost parameters to learn a model for
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if no cost or a non-positive cost is given
+     * @return the weights of the support vectors and the bias of the model learned for each cost (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::pair<std::vector<real_type>, real_type>> learn_cost_path(const std::vector<real_type> &costs);
+    /**
+     * @brief Learns one model for each of the label sets @p labels using a single block Conjugated Gradients solve, e.g., the binary problems of a one-vs-all multi-class classification.
+     * @details All models share the least-squares matrix and, therefore, the kernel matrix. The CG iterations of all right-hand sides run simultaneously, such that each kernel matrix-vector product
+     *          evaluates the kernel matrix only once for all right-hand sides that haven't converged yet.
+     * @param[in] labels the labels of the data points, one label set per model
+     * @throws plssvm::exception if no label set is given
+     * @throws plssvm::exception if the number of labels of a label set and number of data points mismatch
+     * @return the weights of the support vectors and the bias of the model learned for each label set (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::pair<std::vector<real_type>, real_type>> learn_labels(const std::vector<std::vector<real_type>> &labels);
+    /**
+     * @brief Calculate the accuracy of each fold of a @p num_folds -fold cross-validation on the data used for training. The data point with index `i` belongs to the fold `i % num_folds`.
+     * @details The training problem of each fold is the least-squares problem restricted to the data points of all other folds, i.e., its matrix is a projection of the least-squares matrix of all data points.
+     *          Therefore, the data is loaded onto the device(s) only once and the training problems of all folds are solved simultaneously using a single block Conjugated Gradients solve (see learn_labels()),
+     *          such that each kernel matrix entry is evaluated only once per iteration for all folds. Each held-out fold is predicted using the data already residing on the device(s).
+     *          Afterwards, no model is learned, i.e., learn() must be called before writing or using a model.
+     * @param[in] num_folds the number of folds
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if the labels contain more than two classes
+     * @throws plssvm::exception if @p num_folds is less than 2 or greater than the number of data points
+     * @throws plssvm::exception if a fold has less than two training data points
+     * @return the fraction of correctly predicted data points of each fold (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> cross_validate(std::size_t num_folds);
+    /**
+     * @brief Learns the model like learn() and estimates the fraction of data points misclassified by leave-one-out cross-validation using @p num_probes random probing vectors.
+     * @details For LS-SVMs, the leave-one-out residual of the data point `i` is given in closed form by \f$\alpha_i / (H^{-1})_{ii}\f$, where \f$H\f$ is the matrix of the full linear system
+     *          including the bias. The diagonal of \f$H^{-1}\f$ is the diagonal of \f$E A^{-1} E^T\f$ with \f$E = [I; -\mathbf{1}^T]\f$ mapping the reduced to all data points,
+     *          i.e., \f$(A^{-1})_{ii}\f$ for all but the last data point and \f$\mathbf{1}^T A^{-1} \mathbf{1}\f$ for the last one. The diagonal of \f$A^{-1}\f$ is estimated using
+     *          \f$\sum_k z_k \odot A^{-1} z_k / \sum_k z_k \odot z_k\f$ with Rademacher vectors \f$z_k\f$ and clamped to the bounds \f$[1 / A_{ii}, cost]\f$.
+     *          All probing vectors are solved together with the labels and \f$\mathbf{1}\f$ using a single block Conjugated Gradients solve (see learn_labels()), i.e., the estimate costs
+     *          the kernel matrix evaluations of one training. If @p num_probes is at least the number of data points minus one, the unit vectors are used instead and the result is exact.
+     *          The probing vectors are drawn using the seed of the random number generator (plssvm::parameter::random_seed), i.e., the estimate is reproducible.
+     * @param[in] num_probes the number of random probing vectors
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if the labels contain more than two classes
+     * @throws plssvm::exception if @p num_probes is 0
+     * @throws plssvm::exception if less than two data points are given
+     * @return the fraction of misclassified data points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type loo_error(std::size_t num_probes);
+    /**
+     * @brief Learns an approximate model using the Nyström approximation of the kernel matrix with @p num_landmarks landmarks, i.e., \f$f(x) = \sum_j \beta_j k(x, z_j) + b\f$ for the landmarks \f$z_j\f$.
+     * @details The landmarks are selected from the data points using kernel k-means++ seeding, i.e., each landmark is drawn with a probability proportional to the squared distance
+     *          in the kernel feature space to the nearest landmark selected so far, starting with a uniformly drawn data point, or uniformly at random. The random numbers are drawn using the seed
+     *          of the random number generator (plssvm::parameter::random_seed); the seed isn't part of the model, since the selected landmarks are its support vectors. With the Cholesky factor \f$L\f$ of \f$K_{mm}\f$, each data point is mapped to the
+     *          \f$m\f$ features \f$\phi_i = L^{-1} K_{mi}\f$ and the regularized least-squares problem \f$\frac{1}{2 \cdot cost} \|w\|^2 + \frac{1}{2} \sum_i (\phi_i^T w + b - y_i)^2\f$
+     *          is solved using the dense normal equations, where \f$\beta = L^{-T} w\f$. The kernel matrix rows \f$K_{mi}\f$ are evaluated on the fly, i.e., learning needs
+     *          \f$\mathcal{O}(n \cdot m^2)\f$ operations, but only \f$\mathcal{O}(m^2)\f$ additional memory. The learning is performed on the host regardless of the backend.
+     *          Afterwards, the landmarks replace the data points used for training, such that writing the model or predicting only uses the landmarks.
+     * @param[in] num_landmarks the maximum number of landmarks; less landmarks are used if the data set has less (distinct) data points
+     * @param[in] selection the strategy selecting the landmarks
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if the labels contain more than two classes
+     * @throws plssvm::exception if @p num_landmarks is 0
+     * @throws plssvm::exception if the kernel matrix of the landmarks isn't positive definite
+     */
+    void learn_nystrom(std::size_t num_landmarks, landmark_selection_type selection = landmark_selection_type::kmeans_pp);
+    /**
+     * @brief Learns an approximate model of the rbf kernel function in the explicit feature space of @p num_random_features random Fourier features \f$\phi_k(x) = \sqrt{2 / D} \cos(\omega_k^T x + b_k)\f$.
+     * @details The random frequencies \f$\omega_k\f$ and offsets \f$b_k\f$ are generated from `gamma` and the seed of the random number generator. The linear least-squares problem
+     *          \f$\frac{1}{2 \cdot cost} \|w\|^2 + \frac{1}{2} \sum_i (\phi(x_i)^T w + b - y_i)^2\f$ is solved using the dense normal equations in \f$\mathcal{O}(n \cdot D^2)\f$ operations on the host
+     *          regardless of the backend. Afterwards, the random frequencies replace the data points used for training and the model only consists of the seed and the weights \f$w\f$,
+     *          i.e., predicting a data point costs \f$\mathcal{O}(d \cdot D)\f$ independent of the number of data points used for training.
+     * @param[in] num_random_features the number of random Fourier features
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if @p num_random_features is 0
+     * @throws plssvm::exception if the kernel function isn't the rbf kernel function
+     * @throws plssvm::exception if the labels contain more than two classes
+     */
+    void learn_random_features(std::size_t num_random_features);
+    /**
+     * @brief Compress the learned binary model into the Nyström approximation using at most @p num_landmarks of its support vectors as landmarks (see learn_nystrom()).
+     * @details Instead of the labels, the compressed model is fitted to the decision values of the current model on its support vectors, regularized by the cost parameter.
+     *          Afterwards, the approximation error is measured on the @p validation_points and the compressed model replaces the current one.
+     * @param[in] num_landmarks the maximum number of landmarks
+     * @param[in] validation_points the data points used to measure the approximation error
+     * @param[in] selection the strategy selecting the landmarks
+     * @throws plssvm::exception if @p num_landmarks is 0
+     * @throws plssvm::exception if the labels of the support vectors are missing
+     * @throws plssvm::exception if no binary model is given or the model is already compressed
+     * @throws plssvm::exception if no validation points are given or the number of features of the @p validation_points and the model mismatch
+     * @throws plssvm::exception if the kernel matrix of the landmarks isn't positive definite
+     * @return the root mean squared error of the decision values of the compressed model on the @p validation_points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type compress_nystrom(std::size_t num_landmarks, const aos_matrix<real_type> &validation_points, landmark_selection_type selection = landmark_selection_type::kmeans_pp);
+    /**
+     * @brief Compress the learned binary model of the rbf kernel function into @p num_random_features random Fourier features (see learn_random_features()),
+     *        i.e., predicting a data point costs \f$\mathcal{O}(d \cdot D)\f$ instead of \f$\mathcal{O}(d \cdot \#SV)\f$.
+     * @details Instead of the labels, the weights of the random features are fitted to the decision values of the current model on its support vectors, regularized by the cost parameter.
+     *          Afterwards, the approximation error is measured on the @p validation_points and the compressed model replaces the current one.
+     * @param[in] num_random_features the number of random Fourier features
+     * @param[in] validation_points the data points used to measure the approximation error
+     * @throws plssvm::exception if @p num_random_features is 0
+     * @throws plssvm::exception if the kernel function isn't the rbf kernel function
+     * @throws plssvm::exception if no binary model is given or the model is already compressed
+     * @throws plssvm::exception if no validation points are given or the number of features of the @p validation_points and the model mismatch
+     * @return the root mean squared error of the decision values of the compressed model on the @p validation_points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type compress_random_features(std::size_t num_random_features, const aos_matrix<real_type> &validation_points);
+    /**
+     * @brief Use the model given by the weights of the support vectors @p alpha and the bias @p bias learned with the cost parameter @p cost, e.g., one of the models returned by learn_cost_path() or learn_labels().
+     * @param[in] cost the cost parameter used to learn the model
+     * @param[in] alpha the weights of the support vectors
+     * @param[in] bias the bias of the model
+     * @throws plssvm::exception if the number of weights and number of data points mismatch
+     */
+    void set_model(real_type cost, std::vector<real_type> alpha, real_type bias);
 
     //*************************************************************************************************************************************//
     //                                                               predict                                                               //
@@ -150,6 +317,16 @@ class csvm {
      * @return the fraction of correctly labeled data points. (`[[nodiscard]]`)
      */
     [[nodiscard]] real_type accuracy(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &correct_labels);
+    /**
+     * @brief Evaluate the model on the given data @p points with @p correct_labels being the correct labels.
+     * @param[in] points the data points to predict
+     * @param[in] correct_labels the correct labels
+     * @throws plssvm::exception if the number of points to predict mismatch the number of provided, correct label
+     * @throws plssvm::exception if the number of features per point to predict and per point in data matrix mismatch
+     * @throws plssvm::exception if no weights are provided for calculating the accuracy (possibly a call to learn() is missing)
+     * @return the fraction of correctly labeled data points. (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type accuracy(const aos_matrix<real_type> &points, const std::vector<real_type> &correct_labels);
 
     /**
      * @brief Uses the already learned model to predict a (new) data point.
@@ -159,13 +336,22 @@ class csvm {
      * @return a negative #real_type value if the prediction for data point point is the negative class and a positive #real_type value otherwise (`[[nodiscard]]`)
      */
     [[nodiscard]] real_type predict(const std::vector<real_type> &point);
+    /**
+     * @brief Uses the already learned model to predict multiple (new) data points.
+     * @param[in] points the data points to predict
+     * @throws plssvm::exception if not all @p points to predict have the same number of features
+     * @throws plssvm::exception if the number of features per point to predict and per point in data matrix mismatch
+     * @throws plssvm::exception if no weights are provided for calculating the accuracy (possibly a call to learn() is missing)
+     * @return a [`std::vector<real_type>`](https://en.cppreference.com/w/cpp/container/vector) filled with negative values for each prediction for a data point with the negative class and positive values otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> predict(const std::vector<std::vector<real_type>> &points);
 
     /**
      * @brief Uses the already learned model to predict the class of a (new) data point.
      * @param[in] point the data point to predict
      * @throws plssvm::exception if the number of features in @p point doesn't match the number of features in the data matrix
      * @throws plssvm::exception if no weights are provided for calculating the accuracy (possibly a call to learn() is missing)
-     * @return -1.0 if the prediction for @p point is the negative class and +1 otherwise (`[[nodiscard]]`)
+     * @return -1.0 if the prediction for @p point is the negative class and +1 otherwise or the predicted class of a multi-class model (`[[nodiscard]]`)
      */
     [[nodiscard]] real_type predict_label(const std::vector<real_type> &point);
     /**
@@ -174,9 +360,17 @@ class csvm {
      * @throws plssvm::exception if not all @p points to predict have the same number of features
      * @throws plssvm::exception if the number of features per point to predict and per point in data matrix mismatch
      * @throws plssvm::exception if no weights are provided for calculating the accuracy (possibly a call to learn() is missing)
-     * @return a [`std::vector<real_type>`](https://en.cppreference.com/w/cpp/container/vector) filled with -1 for each prediction for a data point with the negative class and +1 otherwise (`[[nodiscard]]`)
+     * @return a [`std::vector<real_type>`](https://en.cppreference.com/w/cpp/container/vector) filled with -1 for each prediction for a data point with the negative class and +1 otherwise or the predicted classes of a multi-class model (`[[nodiscard]]`)
      */
     [[nodiscard]] std::vector<real_type> predict_label(const std::vector<std::vector<real_type>> &points);
+    /**
+     * @brief Uses the already learned model to predict the class of multiple (new) data points.
+     * @param[in] points the data points to predict
+     * @throws plssvm::exception if the number of features per point to predict and per point in data matrix mismatch
+     * @throws plssvm::exception if no weights are provided for calculating the accuracy (possibly a call to learn() is missing)
+     * @return a [`std::vector<real_type>`](https://en.cppreference.com/w/cpp/container/vector) filled with -1 for each prediction for a data point with the negative class and +1 otherwise or the predicted classes of a multi-class model (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> predict_label(const aos_matrix<real_type> &points);
 
   protected:
     //*************************************************************************************************************************************//
@@ -192,16 +386,37 @@ class csvm {
      */
     [[nodiscard]] virtual std::vector<real_type> generate_q() = 0;
     /**
-     * @brief Solves the equation \f$Ax = b\f$ using the Conjugated Gradients algorithm.
+     * @brief Solves the equation \f$Ax = b\f$ using the Conjugated Gradients algorithm starting with the initial guess @p x0.
      * @details Solves using a slightly modified version of the CG algorithm described by [Jonathan Richard Shewchuk](https://www.cs.cmu.edu/~quake-papers/painless-conjugate-gradient.pdf):
      * \image html cg.png
      * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] x0 the initial guess
      * @param[in] imax the maximum number of CG iterations
      * @param[in] eps error tolerance
      * @param[in] q subvector of the least-squares matrix equation
      * @return the alpha values
      */
-    virtual std::vector<real_type> solver_CG(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &q) = 0;
+    virtual std::vector<real_type> solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, std::size_t imax, real_type eps, const std::vector<real_type> &q) = 0;
+    /**
+     * @brief Solves the equations \f$A_{cost} x = b\f$ for all @p costs at once using the multi-shift Conjugated Gradients algorithm.
+     * @param[in] b the right-hand side of the equations \f$A_{cost} x = b\f$
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] q subvector of the least-squares matrix equation
+     * @param[in] costs the cost parameters
+     * @return the alpha values for each cost
+     */
+    virtual std::vector<std::vector<real_type>> solver_CG_cost_path(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &q, const std::vector<real_type> &costs) = 0;
+    /**
+     * @brief Solves the equations \f$Ax = b\f$ for all right-hand sides @p B at once using the block Conjugated Gradients algorithm, i.e., sharing each matrix-vector product between all right-hand sides.
+     * @param[in] B the right-hand sides of the equations \f$Ax = b\f$
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] q subvector of the least-squares matrix equation
+     * @param[in] folds if not empty, the fold of each data point, i.e., the right-hand side `c` is the training problem of the cross-validation fold `c` (see block_conjugate_gradients())
+     * @return the alpha values for each right-hand side
+     */
+    virtual std::vector<std::vector<real_type>> solver_CG_block(const std::vector<std::vector<real_type>> &B, std::size_t imax, real_type eps, const std::vector<real_type> &q, const std::vector<std::size_t> &folds) = 0;
     /**
      * @brief Updates the normal vector #w_, used to speed-up the prediction in case of the linear kernel function, to the current data and alpha values.
      */
@@ -211,7 +426,7 @@ class csvm {
      * @param[in] points the data points to predict
      * @return a [`std::vector<real_type>`](https://en.cppreference.com/w/cpp/container/vector) filled with negative values for each prediction for a data point with the negative class and positive values otherwise (`[[nodiscard]]`)
      */
-    [[nodiscard]] virtual std::vector<real_type> predict(const std::vector<std::vector<real_type>> &points) = 0;
+    [[nodiscard]] virtual std::vector<real_type> predict(const aos_matrix<real_type> &points) = 0;
 
     //*************************************************************************************************************************************//
     //                                                          kernel functions                                                           //
@@ -224,16 +439,290 @@ class csvm {
      * @return the value computed by the kernel function (`[[nodiscard]]`)
      */
     [[nodiscard]] real_type kernel_function(const std::vector<real_type> &xi, const std::vector<real_type> &xj);
+    /**
+     * @brief Computes the value of the two vectors @p xi and @p xj, each consisting of #num_features_ values, using the kernel function specified during construction.
+     * @param[in] xi pointer to the first vector, e.g., a row of the data matrix
+     * @param[in] xj pointer to the second vector, e.g., a row of the data matrix
+     * @throws plssvm::unsupported_kernel_type_exception if the kernel type cannot be recognized
+     * @return the value computed by the kernel function (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type kernel_function(const real_type *xi, const real_type *xj);
 
     /**
-     * @brief Transforms @p num_points entries of the 2D data from AoS to a 1D SoA layout and adding @p boundary points.
-     * @param[in] matrix the 2D vector to be transformed into a 1D representation
-     * @param[in] boundary the number of boundary points
-     * @param[in] num_points the number of data points of the 2D vector to transform
-     * @attention Boundary values can contain random numbers!
-     * @return an 1D vector in a SoA layout (`[[nodiscard]]`)
+     * @brief Convert the 2D vector @p points to a padded plssvm::aos_matrix used for the prediction.
+     * @param[in] points the data points to convert
+     * @throws plssvm::exception if not all @p points have the same number of features
+     * @throws plssvm::exception if the number of features per point in @p points and per point in data matrix mismatch
+     * @return the data points stored in a padded matrix (`[[nodiscard]]`)
+     */
+    [[nodiscard]] aos_matrix<real_type> to_matrix(const std::vector<std::vector<real_type>> &points) const;
+
+    /**
+     * @brief Create the LIBSVM model file header entries describing the SVM type and the kernel function, shared by binary and multi-class models.
+     * @return the model file header entries (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string kernel_model_header() const;
+    /**
+     * @brief Return the distinct original labels #label_ptr_ of the data points in ascending order.
+     * @return the distinct classes, empty if no original labels are given (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> distinct_classes() const;
+    /**
+     * @brief Solve the regularized least-squares problem \f$\frac{1}{2 \cdot cost} \|w\|^2 + \frac{1}{2} \sum_i (\phi_i^T w + b - y_i)^2\f$ in an explicit feature space using the dense normal equations.
+     * @details The features of plssvm::FEATURE_SPACE_BLOCK_SIZE data points at a time are accumulated in the single shared normal matrix (using SYRK if available),
+     *          i.e., the features of all data points are never stored at once and only \f$\mathcal{O}(D^2)\f$ additional memory is necessary.
+     * @param[in] num_features the number of features per data point in the feature space
+     * @param[in] targets the target values \f$y_i\f$ of the data points
+     * @param[in] features the function writing the @p num_features features \f$\phi_i\f$ of the data point `i`, called as `features(i, phi)`; must be callable concurrently from multiple threads
+     * @throws plssvm::exception if the normal equations aren't positive definite
+     * @return the weights \f$w\f$ of the features followed by the bias \f$b\f$ (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> feature_space_least_squares(std::size_t num_features, const std::vector<real_type> &targets, const std::function<void(std::size_t, real_type *)> &features) const;
+    /**
+     * @brief Select at most @p num_landmarks landmarks of the data points, fit the Nyström approximation to the @p targets, and replace the data points with the landmarks (see learn_nystrom()).
+     * @param[in] num_landmarks the maximum number of landmarks
+     * @param[in] targets the target value of each data point
+     * @param[in] selection the strategy selecting the landmarks
+     * @throws plssvm::exception if the kernel matrix of the landmarks isn't positive definite
+     * @return the number of selected landmarks (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t fit_nystrom(std::size_t num_landmarks, const std::vector<real_type> &targets, landmark_selection_type selection);
+    /**
+     * @brief Fit the weights of @p num_random_features random Fourier features to the @p targets and replace the data points with the random frequencies (see learn_random_features()).
+     * @param[in] num_random_features the number of random Fourier features
+     * @param[in] targets the target value of each data point
+     */
+    void fit_random_features(std::size_t num_random_features, const std::vector<real_type> &targets);
+    /**
+     * @brief Learn the model of the polynomial kernel function by solving the primal problem in the exact feature space \f$\phi\f$ of the kernel function (see plssvm::detail::polynomial_feature_map).
+     * @details The \f$D\f$ features of all data points are accumulated in the normal equations (see feature_space_least_squares()), i.e., learning needs \f$\mathcal{O}((n + D) \cdot D^2)\f$ operations
+     *          independent of the condition of the kernel matrix. The weights of the data points are recovered as \f$\alpha_i = cost \cdot (y_i - f(x_i))\f$, such that the model is the same
+     *          as the one of the dual problem. The weights #feature_weights_ of the features are kept for predicting.
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if the normal equations aren't positive definite
+     */
+    void learn_polynomial_feature_map();
+    /**
+     * @brief Compress the current binary model using @p fit and measure the approximation error of the decision values on the @p validation_points.
+     * @param[in] validation_points the data points used to measure the approximation error
+     * @param[in] fit the function fitting the compressed model to the decision values of the current model on its support vectors and returning a description of the compressed model
+     * @throws plssvm::exception if no binary model is given or the model is already compressed
+     * @throws plssvm::exception if no validation points are given or the number of features of the @p validation_points and the model mismatch
+     * @return the root mean squared error of the decision values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type compress_model(const aos_matrix<real_type> &validation_points, const std::function<std::string(const std::vector<real_type> &)> &fit);
+    /**
+     * @brief Write the learned model using random Fourier features to the file denoted by @p filename.
+     * @details The model file only contains the seed of the random number generator and the weights of the random features instead of support vectors (see plssvm::parameter::parse_model_file()).
+     * @param[in] filename name of the file to write the model information to
+     */
+    void write_random_features_model(const std::string &filename);
+    /**
+     * @brief Uses the learned model using random Fourier features to predict the decision values of multiple (new) data points on the host.
+     * @param[in] points the data points to predict
+     * @throws plssvm::exception if the number of features of the @p points and the model mismatch
+     * @return the decision values of the @p points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> predict_random_features(const aos_matrix<real_type> &points) const;
+    /**
+     * @brief Return the number of features of the exact feature map of the kernel function (see plssvm::detail::polynomial_feature_map).
+     * @return the number of features or `0` if the kernel function isn't a polynomial kernel function with a supported feature map (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t polynomial_feature_map_size() const;
+    /**
+     * @brief Decide whether learn() solves the primal problem in the exact feature space of the polynomial kernel function (see learn_polynomial_feature_map()) instead of the dual problem.
+     * @details The primal problem is only solved if #feature_map_ is `true`, the CG solver, the preconditioner, and mixed precision haven't been requested explicitly, and the
+     *          \f$(D + 1)^2\f$ normal matrix fits into the memory budget (see memory_budget_bytes()). Its \f$\mathcal{O}((n + D) \cdot D^2)\f$ operations are compared against the
+     *          operations of the dual problem using the CG solver variant of resolve_solver() and the number of CG iterations estimated as
+     *          \f$\min(d, \frac{\sqrt{\kappa}}{2} \ln\frac{2}{\varepsilon})\f$, where the condition number \f$\kappa\f$ is bounded by \f$1 + cost \cdot trace(K)\f$.
+     * @return `true` if the primal problem should be solved, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool use_polynomial_feature_map() const;
+    /**
+     * @brief Updates the weights #feature_weights_ of the exact feature map of the polynomial kernel function, \f$w = \sum_i \alpha_i \phi(x_i)\f$, to the current data and alpha values.
+     */
+    void update_feature_weights();
+    /**
+     * @brief Uses the weights #feature_weights_ of the exact feature map of the polynomial kernel function to predict the decision values of multiple (new) data points on the host.
+     * @param[in] points the data points to predict
+     * @throws plssvm::exception if the number of features of the @p points and the model mismatch
+     * @return the decision values of the @p points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> predict_polynomial_feature_map(const aos_matrix<real_type> &points) const;
+    /**
+     * @brief Predict the decision values of multiple (new) data points using the cheapest representation of the binary model.
+     * @details Models of random Fourier features are predicted using predict_random_features(). Models of the polynomial kernel function with a supported feature map are predicted using
+     *          predict_polynomial_feature_map() if the number of features \f$D\f$ is less than the number of support vectors times the number of features per data point. Otherwise, the backend
+     *          specific predict() is used.
+     * @param[in] points the data points to predict
+     * @return the decision values of the @p points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> predict_decision_values(const aos_matrix<real_type> &points);
+    /**
+     * @brief Learn a one-vs-all multi-class model for the @p classes of the original labels #label_ptr_ using a single call to learn_labels().
+     * @param[in] classes the distinct classes of the data points
+     */
+    void learn_one_vs_all(std::vector<real_type> classes);
+    /**
+     * @brief Write the learned one-vs-all multi-class model to the file denoted by @p filename.
+     * @param[in] filename name of the file to write the model information to
+     * @throws plssvm::exception if no labels are given
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if a label isn't one of the classes of the model
+     */
+    void write_one_vs_all_model(const std::string &filename);
+    /**
+     * @brief Uses the learned one-vs-all multi-class model to predict the classes of multiple (new) data points on the host.
+     * @details The kernel function of each pair of data point and support vector is evaluated only once for all classes. In case of the linear kernel function, the normal vectors of all classes are used instead.
+     * @param[in] points the data points to predict
+     * @return the class with the largest decision value for each data point (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> predict_one_vs_all(const aos_matrix<real_type> &points);
+
+    /**
+     * @brief Resolve plssvm::solver_type::automatic to the concrete CG solver variant used for a kernel matrix occupying @p kernel_matrix_bytes bytes if stored explicitly.
+     * @details plssvm::solver_type::cg_explicit is selected if the kernel matrix fits into the memory budget #memory_budget_ (in MiB) or,
+     *          if no memory budget has been provided, into half of the available physical memory.
+     * @param[in] kernel_matrix_bytes the number of bytes necessary to explicitly store the kernel matrix
+     * @return the concrete solver variant (`[[nodiscard]]`)
+     */
+    [[nodiscard]] solver_type resolve_solver(std::size_t kernel_matrix_bytes) const;
+    /**
+     * @brief Return the memory budget in bytes: #memory_budget_ (in MiB) or, if no memory budget has been provided, half of the available physical memory.
+     * @return the memory budget in bytes; `0` if no memory budget has been provided and the available memory can't be determined (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t memory_budget_bytes() const;
+
+    /**
+     * @brief Load the data onto the device(s) and set up the least-squares matrix equation, i.e., generate the vector `q`, the right-hand side `b`, and #QA_cost_.
+     * @throws plssvm::exception if no labels are given for training
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @return the vector `q` and the right-hand side `b` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::pair<std::vector<real_type>, std::vector<real_type>> setup_equation();
+    /**
+     * @brief Load the data onto the device(s) and set up the least-squares matrix equations for all label sets @p labels, i.e., generate the vector `q`, one right-hand side per label set, and #QA_cost_.
+     * @param[in] labels the labels of the data points, one label set per right-hand side
+     * @throws plssvm::exception if the number of labels of a label set and number of data points mismatch
+     * @return the vector `q` and the right-hand sides (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::pair<std::vector<real_type>, std::vector<std::vector<real_type>>> setup_equation(const std::vector<std::vector<real_type>> &labels);
+
+    /// The type of a matrix-vector product \f$ret = ret + add \cdot (A \cdot d)\f$ with the least-squares matrix \f$A\f$, called as `matvec(ret, d, add)`.
+    using matvec_type = std::function<void(std::vector<real_type> &, const std::vector<real_type> &, real_type)>;
+    /**
+     * @brief Solves the equation \f$Ax = b\f$ on the host using the (preconditioned) Conjugated Gradients algorithm starting with the initial guess @p x0, where \f$A\f$ is only accessed through @p matvec.
+     * @details The preconditioner #preconditioner_ is created using make_preconditioner().
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] x0 the initial guess
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] q subvector of the least-squares matrix equation
+     * @param[in] matvec the function calculating the matrix-vector product with \f$A\f$
+     * @return the alpha values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> conjugate_gradients(const std::vector<real_type> &b, const std::vector<real_type> &x0, std::size_t imax, real_type eps, const std::vector<real_type> &q, const matvec_type &matvec);
+    /**
+     * @brief Solves the equation \f$Ax = b\f$ on the host using the (preconditioned) Conjugated Gradients algorithm starting with the initial guess @p alpha.
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] alpha the initial guess
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] precond the preconditioner; if `nullptr`, no preconditioner is used
+     * @param[in] matvec the function calculating the matrix-vector product with \f$A\f$
+     * @param[out] num_iterations the number of performed CG iterations
+     * @return the alpha values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> conjugate_gradients(const std::vector<real_type> &b, std::vector<real_type> alpha, std::size_t imax, real_type eps, const detail::preconditioner<real_type> *precond, const matvec_type &matvec, std::size_t &num_iterations);
+    /**
+     * @brief Convert the error tolerance @p eps relative to the residual of the default initial guess \f$\mathbf{1}\f$ to the error tolerance relative to the residual of the initial guess @p x0.
+     * @details The CG solvers reduce the initial residual by @p eps. Starting with a good initial guess, e.g., the weights of a previous model, would therefore tighten the tolerance
+     *          and waste most of the saved iterations. Costs two matrix-vector products if @p x0 isn't the default initial guess.
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] x0 the initial guess
+     * @param[in] eps error tolerance relative to the residual of the default initial guess
+     * @param[in] matvec the function calculating the matrix-vector product with \f$A\f$
+     * @return the error tolerance relative to the residual of @p x0 (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type initial_guess_tolerance(const std::vector<real_type> &b, const std::vector<real_type> &x0, real_type eps, const matvec_type &matvec) const;
+    /**
+     * @brief Solves the equation \f$Ax = b\f$ on the host using mixed-precision iterative refinement.
+     * @details The correction equation \f$Ae = r\f$ is solved using the (preconditioned) Conjugated Gradients algorithm with the cheap, less accurate @p low_precision_matvec,
+     *          while the residual \f$r = b - Ax\f$ of the accumulated solution is always calculated using @p matvec. Therefore, the final residual meets @p eps with respect to
+     *          @p matvec, although (nearly) all matrix-vector products are calculated using @p low_precision_matvec.
+     *          The refinement stops if the residual doesn't decrease anymore, i.e., if the accuracy of @p low_precision_matvec isn't sufficient for the condition of \f$A\f$.
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] x0 the initial guess
+     * @param[in] imax the maximum number of CG iterations summed over all refinement steps
+     * @param[in] eps error tolerance
+     * @param[in] q subvector of the least-squares matrix equation
+     * @param[in] matvec the function calculating the accurate matrix-vector product with \f$A\f$
+     * @param[in] low_precision_matvec the function calculating the matrix-vector product with \f$A\f$ in single precision
+     * @return the alpha values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> mixed_precision_conjugate_gradients(const std::vector<real_type> &b, const std::vector<real_type> &x0, std::size_t imax, real_type eps, const std::vector<real_type> &q, const matvec_type &matvec, const matvec_type &low_precision_matvec);
+    /**
+     * @brief Solves the equations \f$A_{cost} x = b\f$ for all @p costs on the host using the multi-shift Conjugated Gradients algorithm, where \f$A_{cost}\f$ is only accessed through @p matvec.
+     * @details @p matvec calculates the product with the least-squares matrix \f$A_{cost} = \tilde{K} + \frac{1}{cost} M\f$, \f$M = I + \mathbf{1} \mathbf{1}^T\f$, for the cost #cost_.
+     *          Using \f$M^{-1/2} = I - c \mathbf{1} \mathbf{1}^T\f$, all systems are transformed to the shifted systems \f$(M^{-1/2} \tilde{K} M^{-1/2} + \frac{1}{cost} I) y = M^{-1/2} b\f$, \f$x = M^{-1/2} y\f$,
+     *          which are solved simultaneously using the collinear residuals of the CG iteration for the smallest shift (the largest cost), starting with \f$x = 0\f$.
+     *          A system is converged as soon as its residual has been reduced by @p eps.
+     * @param[in] b the right-hand side of the equations \f$A_{cost} x = b\f$
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] costs the cost parameters
+     * @param[in] matvec the function calculating the matrix-vector product with \f$A_{cost}\f$ for the cost #cost_
+     * @return the alpha values for each cost (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<real_type>> multi_shift_conjugate_gradients(const std::vector<real_type> &b, std::size_t imax, real_type eps, const std::vector<real_type> &costs, const matvec_type &matvec);
+    /// The type of a matrix-vector product \f$ret_c = ret_c + add \cdot (A \cdot d_c)\f$ with the least-squares matrix \f$A\f$ for multiple vectors at once, called as `block_matvec(ret, d, add)`.
+    using block_matvec_type = std::function<void(std::vector<std::vector<real_type>> &, const std::vector<std::vector<real_type>> &, real_type)>;
+    /**
+     * @brief Solves the equations \f$Ax = b\f$ for all right-hand sides @p B on the host using the (preconditioned) Conjugated Gradients algorithm, where \f$A\f$ is only accessed through @p block_matvec.
+     * @details The CG iterations of all right-hand sides run in lockstep, but each one uses its own step sizes and residual replacements. In each iteration, the matrix-vector products of all
+     *          right-hand sides that haven't converged yet are calculated using a single call to @p block_matvec. A right-hand side is converged as soon as its residual has been reduced by @p eps.
+     *          The preconditioner #preconditioner_ is created using make_preconditioner() and shared by all right-hand sides.
+     *
+     *          If @p folds isn't empty, the right-hand side `c` instead belongs to the training problem of the cross-validation fold `c`, i.e., the least-squares problem restricted to the data points `i`
+     *          with `folds[i] != c` using the pivot data point fold_pivot() instead of the last one. Its matrix \f$T_c^T P_c A P_c^T T_c\f$ consists of the projection \f$P_c\f$ onto the training data points
+     *          and the change of the pivot \f$T_c\f$. Both are applied on the host around @p block_matvec, i.e., all folds still share each kernel matrix evaluation.
+     *          The entries of the right-hand side and the alpha values of data points not used by the fold (including the pivot) must be zero and are meaningless, respectively.
+     * @param[in] B the right-hand sides of the equations \f$Ax = b\f$
+     * @param[in] imax the maximum number of CG iterations
+     * @param[in] eps error tolerance
+     * @param[in] q subvector of the least-squares matrix equation
+     * @param[in] block_matvec the function calculating the matrix-vector products with \f$A\f$ for multiple vectors at once
+     * @param[in] folds if not empty, the fold of each data point
+     * @return the alpha values for each right-hand side (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<real_type>> block_conjugate_gradients(const std::vector<std::vector<real_type>> &B, std::size_t imax, real_type eps, const std::vector<real_type> &q, const block_matvec_type &block_matvec, const std::vector<std::size_t> &folds = {});
+    /**
+     * @brief Return the pivot data point of the training problem of the cross-validation fold @p fold, i.e., the last data point if it isn't part of @p fold, otherwise the last data point not part of @p fold.
+     * @param[in] folds the fold of each data point
+     * @param[in] fold the cross-validation fold
+     * @return the index of the pivot data point (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::size_t fold_pivot(const std::vector<std::size_t> &folds, std::size_t fold);
+    /**
+     * @brief Create the preconditioner #preconditioner_ for the least-squares matrix \f$\tilde{Q}\f$ used in the CG algorithm.
+     * @details The entries of \f$\tilde{Q}\f$ are evaluated on the host using #data_ptr_, @p q, #QA_cost_, and #cost_.
+     * @param[in] q subvector of the least-squares matrix equation
+     * @throws plssvm::exception if the preconditioner can't be created
+     * @return the preconditioner or a `nullptr` if no preconditioner should be used (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::unique_ptr<detail::preconditioner<real_type>> make_preconditioner(const std::vector<real_type> &q);
+    /**
+     * @brief Calculates \f$ret = ret + add \cdot (\tilde{Q} \cdot d)\f$ for the linear kernel function in the primal space.
+     * @details Using \f$\tilde{Q}_{ij} = x_i^T x_j + QA_{cost} - q_i - q_j + \delta_{ij} \frac{1}{cost}\f$, the product is calculated as
+     *          \f$(\tilde{Q} \cdot d)_i = x_i^T w + (QA_{cost} - q_i) \sum_j d_j - q^T d + \frac{d_i}{cost}\f$ with \f$w = \sum_j d_j x_j\f$.
+     *          Therefore, only two passes over the data set (\f$\mathcal{O}(n \cdot d)\f$) are necessary instead of evaluating the \f$\mathcal{O}(n^2 \cdot d)\f$ kernel matrix.
+     * @param[in] q subvector of the least-squares matrix equation
+     * @param[in,out] ret the result vector
+     * @param[in] d the right-hand side of the matrix-vector product
+     * @param[in] add denotes whether the values are added or subtracted from the result vector
      */
-    [[nodiscard]] std::vector<real_type> transform_data(const std::vector<std::vector<real_type>> &matrix, std::size_t boundary, std::size_t num_points);
+    void linear_kernel_matvec(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, real_type add) const;
 
     //*************************************************************************************************************************************//
     //                                              parameter initialized by the constructor                                               //
@@ -254,13 +743,37 @@ class csvm {
     const real_type epsilon_;
     /// If `true` additional information (e.g. timing information) will be printed during execution.
     const bool print_info_;
+    /// The CG solver variant.
+    const solver_type solver_;
+    /// The memory budget (in MiB) for the explicitly assembled kernel matrix. If `0`, half of the available physical memory is used.
+    const std::size_t memory_budget_;
+    /// The relative residual norm reduction after which the recursively updated residual in the CG algorithm is replaced by the true residual.
+    const real_type replace_threshold_;
+    /// The maximum number of CG iterations between two replacements of the recursively updated residual by the true residual.
+    const std::size_t replace_interval_;
+    /// The preconditioner used in the CG algorithm.
+    const preconditioner_type preconditioner_;
+    /// The block size of the block-Jacobi preconditioner or the maximum rank of the pivoted Cholesky preconditioner.
+    const std::size_t precond_size_;
+    /// If `true` and the data type is `double`, the kernel matrix-vector products in the CG algorithm are calculated in single precision and the solution is iteratively refined in double precision.
+    const bool mixed_precision_;
+    /// If `true`, the CPU implementations of the rbf kernel function use plssvm::detail::fast_exp instead of `std::exp`.
+    const bool fast_math_kernels_;
+    /// If `true`, learn() may solve the primal problem in the exact feature space of a low-degree polynomial kernel function and predicting may use its weights (see use_polynomial_feature_map()).
+    const bool feature_map_;
+    /// The seed of the random number generator generating the random Fourier features, the probing vectors of loo_error(), and the landmarks of learn_nystrom().
+    const unsigned long long random_seed_;
 
     /// The data used the train the SVM.
-    const std::shared_ptr<const std::vector<std::vector<real_type>>> data_ptr_{};
+    std::shared_ptr<const aos_matrix<real_type>> data_ptr_{};
     /// The labels associated to each data point.
     std::shared_ptr<const std::vector<real_type>> value_ptr_{};
+    /// The original labels associated to each data point, e.g., the classes of a multi-class data set.
+    std::shared_ptr<const std::vector<real_type>> label_ptr_{};
     /// The result of the CG calculation: the weights of the support vectors.
     std::shared_ptr<const std::vector<real_type>> alpha_ptr_{};
+    /// The result of the one-vs-all multi-class CG calculation: the weights of the support vectors for each class in #classes_. If `nullptr`, the model is a binary one.
+    std::shared_ptr<const std::vector<std::vector<real_type>>> class_alpha_ptr_{};
 
     //*************************************************************************************************************************************//
     //                                                         internal variables                                                          //
@@ -271,10 +784,22 @@ class csvm {
     std::size_t num_features_{};
     /// The bias after learning.
     real_type bias_{};
+    /// The classes of the one-vs-all multi-class model.
+    std::vector<real_type> classes_{};
+    /// The bias of each class of the one-vs-all multi-class model.
+    std::vector<real_type> class_bias_{};
     /// The bottom right matrix entry multiplied by cost.
     real_type QA_cost_{};
     /// The normal vector used for speeding up the prediction in case of the linear kernel function.
     std::vector<real_type> w_{};
+    /// The weights of the exact feature map used for speeding up the prediction in case of a low-degree polynomial kernel function. If empty, the weights aren't calculated yet.
+    std::vector<real_type> feature_weights_{};
+    /// The weights of all data points the next call to learn() starts the CG solver from. If empty, the default initial guess is used.
+    std::vector<real_type> warm_start_alpha_{};
+    /// The number of random Fourier features of the model. If not `0`, #data_ptr_ contains the random frequencies and #alpha_ptr_ the weights of the random features instead of the support vectors.
+    std::size_t num_random_features_{};
+    /// The random offsets of the random Fourier features of the model.
+    std::vector<real_type> random_offsets_{};
 };
 
 extern template class csvm<float>;
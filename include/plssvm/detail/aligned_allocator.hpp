@@ -0,0 +1,83 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a minimal allocator returning memory aligned to a given boundary.
+ */
+
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <new>      // ::operator new, ::operator delete, std::align_val_t
+
+namespace plssvm::detail {
+
+/**
+ * @brief Allocator returning memory aligned to @p Alignment bytes, e.g., to enable aligned SIMD loads.
+ * @tparam T the type of the allocated elements
+ * @tparam Alignment the alignment in bytes; must be a power of two
+ */
+template <typename T, std::size_t Alignment>
+class aligned_allocator {
+    static_assert(Alignment >= alignof(T), "The alignment must at least be the natural alignment of T!");
+    static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two!");
+
+  public:
+    /// The type of the allocated elements.
+    using value_type = T;
+
+    /**
+     * @brief Rebind the allocator to another element type keeping the alignment.
+     * @tparam U the new element type
+     */
+    template <typename U>
+    struct rebind {
+        /// The rebound allocator type.
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    /**
+     * @brief Default construct the allocator.
+     */
+    constexpr aligned_allocator() noexcept = default;
+    /**
+     * @brief Construct the allocator from an allocator with a different element type.
+     */
+    template <typename U>
+    constexpr explicit aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+    /**
+     * @brief Allocate uninitialized memory for @p n elements aligned to @p Alignment bytes.
+     * @param[in] n the number of elements
+     * @return a pointer to the allocated memory (`[[nodiscard]]`)
+     */
+    [[nodiscard]] T *allocate(const std::size_t n) {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{ Alignment }));
+    }
+    /**
+     * @brief Release the memory pointed to by @p ptr previously allocated by this allocator.
+     * @param[in] ptr the memory to release
+     */
+    void deallocate(T *ptr, std::size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t{ Alignment });
+    }
+
+    /**
+     * @brief All aligned allocators with the same alignment are interchangeable.
+     * @return `true` (`[[nodiscard]]`)
+     */
+    template <typename U>
+    [[nodiscard]] constexpr bool operator==(const aligned_allocator<U, Alignment> &) const noexcept { return true; }
+    /**
+     * @brief All aligned allocators with the same alignment are interchangeable.
+     * @return `false` (`[[nodiscard]]`)
+     */
+    template <typename U>
+    [[nodiscard]] constexpr bool operator!=(const aligned_allocator<U, Alignment> &) const noexcept { return false; }
+};
+
+}  // namespace plssvm::detail
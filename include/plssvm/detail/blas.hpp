@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a small row-major interface to the dense BLAS and LAPACK routines used on the CPU.
+ * @details Only available if PLSSVM has been built with an external BLAS/LAPACK library (e.g., OpenBLAS, BLIS, or MKL; `PLSSVM_ENABLE_BLAS`), i.e., if `PLSSVM_HAS_BLAS` is defined.
+ *          All callers keep their own loops as fallback if `PLSSVM_HAS_BLAS` isn't defined, if BLAS has been disabled at runtime, or if the sizes are too large for the Fortran interface (see plssvm::detail::blas::is_enabled_for()).
+ */
+
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <limits>   // std::numeric_limits
+
+namespace plssvm::detail::blas {
+
+#if defined(PLSSVM_HAS_BLAS)
+
+/**
+ * @brief Check whether the BLAS/LAPACK routines should be used instead of the built-in loops.
+ * @details Initially `true` unless the environment variable `PLSSVM_DISABLE_BLAS` is set.
+ * @return `true` if the callers should use the BLAS/LAPACK routines, `false` if they should use their built-in loops (`[[nodiscard]]`)
+ */
+[[nodiscard]] bool is_enabled() noexcept;
+
+/**
+ * @brief Enable or disable the usage of the BLAS/LAPACK routines at runtime, e.g., to compare them against the built-in loops.
+ * @param[in] enabled `true` to use the BLAS/LAPACK routines, `false` to use the built-in loops
+ */
+void set_enabled(bool enabled) noexcept;
+
+/**
+ * @brief Check whether the BLAS/LAPACK routines should be used for a call with the sizes @p sizes instead of the built-in loops.
+ * @details The sizes (including the leading dimensions) must be representable by the 32-bit integers of the Fortran interface; otherwise, the callers must use their built-in loops.
+ * @tparam Sizes the types of the sizes
+ * @param[in] sizes all sizes passed to the BLAS/LAPACK routine
+ * @return `true` if is_enabled() and all @p sizes fit into an `int`, `false` otherwise (`[[nodiscard]]`)
+ */
+template <typename... Sizes>
+[[nodiscard]] inline bool is_enabled_for(const Sizes... sizes) noexcept {
+    return is_enabled() && ((static_cast<std::size_t>(sizes) <= static_cast<std::size_t>(std::numeric_limits<int>::max())) && ...);
+}
+
+/**
+ * @brief Calculate \f$C = \alpha A B^T + \beta C\f$ (GEMM), e.g., all pairwise dot products between the rows of @p A and @p B.
+ * @tparam T the type of the data
+ * @param[in] m the number of rows of @p A and @p C
+ * @param[in] n the number of rows of @p B and columns of @p C
+ * @param[in] k the number of columns of @p A and @p B
+ * @param[in] alpha the scaling factor of \f$A B^T\f$
+ * @param[in] A the row-major @p m x @p k matrix
+ * @param[in] lda the leading dimension of @p A
+ * @param[in] B the row-major @p n x @p k matrix
+ * @param[in] ldb the leading dimension of @p B
+ * @param[in] beta the scaling factor of @p C
+ * @param[in,out] C the row-major @p m x @p n result matrix
+ * @param[in] ldc the leading dimension of @p C
+ */
+template <typename T>
+void gemm_nt(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *A, std::size_t lda, const T *B, std::size_t ldb, T beta, T *C, std::size_t ldc);
+
+/**
+ * @brief Calculate the lower triangle of \f$C = \alpha A A^T + \beta C\f$ (SYRK), e.g., all pairwise dot products between the rows of @p A.
+ * @details The strictly upper triangle of @p C isn't accessed.
+ * @tparam T the type of the data
+ * @param[in] n the number of rows of @p A and rows and columns of @p C
+ * @param[in] k the number of columns of @p A
+ * @param[in] alpha the scaling factor of \f$A A^T\f$
+ * @param[in] A the row-major @p n x @p k matrix
+ * @param[in] lda the leading dimension of @p A
+ * @param[in] beta the scaling factor of @p C
+ * @param[in,out] C the row-major @p n x @p n result matrix
+ * @param[in] ldc the leading dimension of @p C
+ */
+template <typename T>
+void syrk_lower(std::size_t n, std::size_t k, T alpha, const T *A, std::size_t lda, T beta, T *C, std::size_t ldc);
+
+/**
+ * @brief Calculate \f$y = \alpha A x + \beta y\f$ (GEMV).
+ * @tparam T the type of the data
+ * @param[in] m the number of rows of @p A and values of @p y
+ * @param[in] n the number of columns of @p A and values of @p x
+ * @param[in] alpha the scaling factor of \f$A x\f$
+ * @param[in] A the row-major @p m x @p n matrix
+ * @param[in] lda the leading dimension of @p A
+ * @param[in] x the vector
+ * @param[in] beta the scaling factor of @p y
+ * @param[in,out] y the result vector
+ */
+template <typename T>
+void gemv_n(std::size_t m, std::size_t n, T alpha, const T *A, std::size_t lda, const T *x, T beta, T *y);
+
+/**
+ * @brief Calculate \f$y = \alpha A^T x + \beta y\f$ (GEMV), e.g., the weighted sum of the rows of @p A.
+ * @tparam T the type of the data
+ * @param[in] m the number of rows of @p A and values of @p x
+ * @param[in] n the number of columns of @p A and values of @p y
+ * @param[in] alpha the scaling factor of \f$A^T x\f$
+ * @param[in] A the row-major @p m x @p n matrix
+ * @param[in] lda the leading dimension of @p A
+ * @param[in] x the vector
+ * @param[in] beta the scaling factor of @p y
+ * @param[in,out] y the result vector
+ */
+template <typename T>
+void gemv_t(std::size_t m, std::size_t n, T alpha, const T *A, std::size_t lda, const T *x, T beta, T *y);
+
+/**
+ * @brief Calculate the Cholesky decomposition \f$A = L L^T\f$ of the symmetric positive definite @p n x @p n matrix @p A in-place (POTRF).
+ * @details Only the lower triangle of @p A is accessed and overwritten with \f$L\f$.
+ * @tparam T the type of the data
+ * @param[in,out] A the row-major matrix to decompose
+ * @param[in] n the number of rows and columns of @p A
+ * @param[in] ld the leading dimension of @p A
+ * @return `true` if @p A is positive definite, `false` otherwise
+ */
+template <typename T>
+bool potrf_lower(T *A, std::size_t n, std::size_t ld);
+
+#endif
+
+}  // namespace plssvm::detail::blas
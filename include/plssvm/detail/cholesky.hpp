@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the dense Cholesky decomposition and the triangular solves used for small, symmetric positive definite systems.
+ */
+
+#pragma once
+
+#include "plssvm/detail/blas.hpp"  // plssvm::detail::blas::{is_enabled_for, potrf_lower}
+
+#include <cmath>    // std::sqrt
+#include <cstddef>  // std::size_t
+
+namespace plssvm::detail {
+
+/// The minimum number of remaining rows for which a column of the built-in Cholesky decomposition is updated in parallel.
+constexpr std::size_t cholesky_parallel_threshold = 64;
+
+/**
+ * @brief Calculate the Cholesky decomposition \f$A = L L^T\f$ of the symmetric positive definite @p n x @p n matrix @p A in-place.
+ * @details Only the lower triangle of @p A is accessed and overwritten with \f$L\f$. Uses LAPACK's blocked `potrf` if PLSSVM has been built with BLAS/LAPACK and it hasn't been disabled at runtime.
+ *          Otherwise, the \f$\mathcal{O}(n^3)\f$ built-in loops update the entries below the diagonal of each column in parallel using OpenMP if more than
+ *          plssvm::detail::cholesky_parallel_threshold of them remain; inside an enclosing parallel region (e.g., the blocks of the block-Jacobi preconditioner) they run sequentially.
+ * @tparam T the type of the data
+ * @param[in,out] A the row-major matrix to decompose
+ * @param[in] n the number of rows and columns of @p A
+ * @param[in] ld the leading dimension of @p A
+ * @return `true` if @p A is positive definite, `false` otherwise
+ */
+template <typename T>
+inline bool cholesky_decomposition(T *A, const std::size_t n, const std::size_t ld) {
+#if defined(PLSSVM_HAS_BLAS)
+    if (blas::is_enabled_for(n, ld)) {
+        return blas::potrf_lower(A, n, ld);
+    }
+#endif
+    for (std::size_t j = 0; j < n; ++j) {
+        T diag = A[j * ld + j];
+        for (std::size_t k = 0; k < j; ++k) {
+            diag -= A[j * ld + k] * A[j * ld + k];
+        }
+        if (!(diag > T{ 0.0 })) {
+            return false;
+        }
+        diag = std::sqrt(diag);
+        A[j * ld + j] = diag;
+        // the entries below the diagonal of column j are independent of each other
+        #pragma omp parallel for if (n - j > cholesky_parallel_threshold)
+        for (std::size_t i = j + 1; i < n; ++i) {
+            T temp = A[i * ld + j];
+            for (std::size_t k = 0; k < j; ++k) {
+                temp -= A[i * ld + k] * A[j * ld + k];
+            }
+            A[i * ld + j] = temp / diag;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Solve \f$L y = b\f$ in-place using forward substitution.
+ * @tparam T the type of the data
+ * @param[in] L the row-major lower triangular matrix
+ * @param[in] n the number of rows and columns of @p L
+ * @param[in] ld the leading dimension of @p L
+ * @param[in,out] x the right-hand side \f$b\f$, overwritten with the solution
+ */
+template <typename T>
+inline void forward_substitution(const T *L, const std::size_t n, const std::size_t ld, T *x) {
+    for (std::size_t i = 0; i < n; ++i) {
+        T temp = x[i];
+        for (std::size_t k = 0; k < i; ++k) {
+            temp -= L[i * ld + k] * x[k];
+        }
+        x[i] = temp / L[i * ld + i];
+    }
+}
+
+/**
+ * @brief Solve \f$L^T x = b\f$ in-place using backward substitution.
+ * @tparam T the type of the data
+ * @param[in] L the row-major lower triangular matrix
+ * @param[in] n the number of rows and columns of @p L
+ * @param[in] ld the leading dimension of @p L
+ * @param[in,out] x the right-hand side \f$b\f$, overwritten with the solution
+ */
+template <typename T>
+inline void backward_substitution(const T *L, const std::size_t n, const std::size_t ld, T *x) {
+    for (std::size_t i = n; i-- > 0;) {
+        T temp = x[i];
+        for (std::size_t k = i + 1; k < n; ++k) {
+            temp -= L[k * ld + i] * x[k];
+        }
+        x[i] = temp / L[i * ld + i];
+    }
+}
+
+/**
+ * @brief Solve \f$L L^T x = b\f$ in-place using forward and backward substitution.
+ * @tparam T the type of the data
+ * @param[in] L the row-major lower triangular Cholesky factor
+ * @param[in] n the number of rows and columns of @p L
+ * @param[in] ld the leading dimension of @p L
+ * @param[in,out] x the right-hand side \f$b\f$, overwritten with the solution
+ */
+template <typename T>
+inline void cholesky_solve(const T *L, const std::size_t n, const std::size_t ld, T *x) {
+    forward_substitution(L, n, ld, x);
+    backward_substitution(L, n, ld, x);
+}
+
+}  // namespace plssvm::detail
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the (preconditioned) Conjugated Gradients algorithm on the host for a matrix only accessed through matrix-vector products.
+ */
+
+#pragma once
+
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/operators.hpp"             // plssvm::operators::{transposed, operator+=, operator-=, operator*, operator+}
+#include "plssvm/detail/preconditioner.hpp"        // plssvm::detail::preconditioner
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+
+#include "fmt/core.h"  // fmt::print
+
+#include <algorithm>  // std::fill, std::min
+#include <cstddef>    // std::size_t
+#include <vector>     // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Solves the equation \f$Ax = b\f$ on the host using the (preconditioned) Conjugated Gradients algorithm starting with the initial guess @p alpha.
+ * @details The recursively updated residual is replaced by the true residual as decided by @p replacement; the convergence is always checked using the true residual.
+ * @tparam T the type of the data
+ * @tparam MatVec the type of the matrix-vector product
+ * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+ * @param[in] alpha the initial guess
+ * @param[in] imax the maximum number of CG iterations
+ * @param[in] eps error tolerance
+ * @param[in] precond the preconditioner; if `nullptr`, no preconditioner is used
+ * @param[in] replacement the policy deciding when the true residual is recomputed
+ * @param[in] matvec the function calculating \f$ret = ret + add \cdot (A \cdot d)\f$, called as `matvec(ret, d, add)`
+ * @param[out] num_iterations the number of performed CG iterations
+ * @param[in] print_info if `true`, the residual of each iteration is printed
+ * @return the alpha values (`[[nodiscard]]`)
+ */
+template <typename T, typename MatVec>
+[[nodiscard]] std::vector<T> conjugate_gradients(const std::vector<T> &b, std::vector<T> alpha, const std::size_t imax, const T eps, const preconditioner<T> *precond, residual_replacement<T> replacement, const MatVec &matvec, std::size_t &num_iterations, const bool print_info) {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(b.size() == alpha.size(), "Sizes mismatch!: {} != {}", b.size(), alpha.size());
+
+    const typename std::vector<T>::size_type dept = b.size();
+
+    std::vector<T> r(b);
+
+    // solve: r = b - (A * alpha_)
+    matvec(r, alpha, -1);
+
+    // delta = r.T * r
+    T delta = transposed{ r } * r;
+    const T delta0 = delta;
+    std::vector<T> Ad(dept);
+
+    // z = M^-1 * r
+    std::vector<T> z(r);
+    if (precond != nullptr) {
+        precond->apply(r, z);
+    }
+    T delta_z = transposed{ r } * z;
+
+    std::vector<T> d(z);
+
+    replacement.reset(delta);
+
+    std::size_t run = 0;
+    for (; run < imax; ++run) {
+        if (print_info) {
+            fmt::print("Start Iteration {} (max: {}) with current residuum {} (target: {}).\n", run + 1, imax, delta, eps * eps * delta0);
+        }
+        // Ad = A * d
+        std::fill(Ad.begin(), Ad.end(), T{ 0.0 });
+        matvec(Ad, d, 1);
+
+        // (alpha = delta_new / (d^T * q))
+        const T alpha_cd = delta_z / (transposed{ d } * Ad);
+
+        // (x = x + alpha * d)
+        alpha += alpha_cd * d;
+
+        // r -= alpha_cd * Ad (r = r - alpha * q)
+        r -= alpha_cd * Ad;
+
+        // (delta = r^T * r)
+        delta = transposed{ r } * r;
+
+        // replace the drifting recursively updated residual by the true residual; the convergence is always checked with the true residual
+        if (replacement.replace(delta) || delta <= eps * eps * delta0) {
+            // (r = b - A * x)
+            // r = b
+            r = b;
+            // r -= A * x
+            matvec(r, alpha, -1);
+
+            delta = transposed{ r } * r;
+            replacement.reset(delta);
+        }
+        // if we are exact enough stop CG iterations
+        if (delta <= eps * eps * delta0) {
+            break;
+        }
+
+        // (z = M^-1 * r)
+        if (precond != nullptr) {
+            precond->apply(r, z);
+        } else {
+            z = r;
+        }
+        const T delta_z_old = delta_z;
+        delta_z = transposed{ r } * z;
+
+        // (beta = delta_new / delta_old)
+        const T beta = delta_z / delta_z_old;
+        // d = beta * d + z
+        d = beta * d + z;
+    }
+    num_iterations = std::min(run + 1, imax);
+    if (print_info) {
+        fmt::print("Finished after {} iterations with a residuum of {} (target: {}).\n", num_iterations, delta, eps * eps * delta0);
+    }
+
+    return alpha;
+}
+
+}  // namespace plssvm::detail
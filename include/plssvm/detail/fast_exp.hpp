@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a branch-free exponential function used in the rbf kernel function on the CPU if `fast_math_kernels` is enabled.
+ * @details In contrast to `std::exp`, the implementation is inlined and contains no library calls or branches,
+ *          i.e., loops calling it are vectorized by the compiler (e.g., using AVX2 or AVX-512 with the `-ffast-math -march=native` flags of the Release build).
+ */
+
+#pragma once
+
+#include <cmath>        // std::exp, std::fma, std::isless, std::isgreater
+#include <cstdint>      // std::int32_t, std::int64_t, std::uint32_t, std::uint64_t
+#include <cstring>      // std::memcpy
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::is_same_v, std::bool_constant, std::true_type, std::false_type
+#include <utility>      // std::forward
+
+namespace plssvm::detail {
+
+/**
+ * @brief The maximum error of fast_exp() in units in the last place (ULP) for all arguments whose result is a normal floating point number.
+ * @details Measured against `std::exp` calculated in `long double`, the largest error is 1 ULP for both, the Taylor polynomial (`double`) and the Cephes minimax polynomial (`float`;
+ *          all arguments checked). The bound leaves a margin for compilers contracting or reassociating the polynomial evaluation differently.
+ */
+constexpr double fast_exp_max_ulp_error = 2.0;
+
+namespace impl {
+
+/**
+ * @brief Calculate the reduced argument \f$x - n (ln2_{hi} + ln2_{lo})\f$ of the exponential function.
+ * @details Uses FMA instructions if available, which (in contrast to the plain expression) aren't reassociated if compiled with `-ffast-math`.
+ * @tparam T the floating point type
+ * @param[in] x the argument
+ * @param[in] n the multiple of \f$\ln 2\f$
+ * @param[in] ln2_hi the high part of \f$\ln 2\f$ such that \f$n \cdot ln2_{hi}\f$ is exact
+ * @param[in] ln2_lo the low part of \f$\ln 2\f$
+ * @return the reduced argument (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T reduce(const T x, const T n, const T ln2_hi, const T ln2_lo) noexcept {
+#if defined(__FMA__)
+    return std::fma(-n, ln2_lo, std::fma(-n, ln2_hi, x));
+#else
+    return (x - n * ln2_hi) - n * ln2_lo;
+#endif
+}
+
+}  // namespace impl
+
+/**
+ * @brief Calculate \f$e^x\f$ using a Cody-Waite range reduction and a polynomial approximation (similar to the SLEEF library).
+ * @details \f$x = n \ln 2 + r\f$ with \f$|r| \leq \ln 2 / 2\f$. \f$e^r\f$ is approximated by its Taylor polynomial of degree 13 (`double`) or the minimax polynomial
+ *          of degree 7 of the Cephes library (`float`) and scaled by \f$2^n\f$ constructed directly in the exponent bits. For both types, the error is at most
+ *          plssvm::detail::fast_exp_max_ulp_error ULP. Results that would be subnormal are flushed to zero,
+ *          arguments larger than 709 (`double`) or 88 (`float`) result in infinity. NaNs aren't propagated.
+ * @tparam T the floating point type
+ * @param[in] x the exponent
+ * @return \f$e^x\f$ (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T fast_exp(const T x) noexcept {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "fast_exp is only implemented for float and double!");
+
+    if constexpr (std::is_same_v<T, double>) {
+        // the bounds ensure that the exponent 2^n is a normal number
+        constexpr double lower = -708.39;
+        constexpr double upper = 709.0;
+        const double clamped = std::isless(x, lower) ? lower : (std::isgreater(x, upper) ? upper : x);
+
+        // range reduction: x = n * ln(2) + r, ln(2) split into a high and low part such that n * ln2_hi is exact
+        // round to the nearest integer by truncating a positive value
+        const std::int32_t n = static_cast<std::int32_t>(clamped * 1.4426950408889634 + 1024.5) - 1024;
+        const double r = impl::reduce(clamped, static_cast<double>(n), 6.93147180369123816490e-01, 1.90821492927058770002e-10);
+
+        // Taylor polynomial of e^r using Horner's method
+        double p = 1.0 / 6227020800.0;
+        p = p * r + 1.0 / 479001600.0;
+        p = p * r + 1.0 / 39916800.0;
+        p = p * r + 1.0 / 3628800.0;
+        p = p * r + 1.0 / 362880.0;
+        p = p * r + 1.0 / 40320.0;
+        p = p * r + 1.0 / 5040.0;
+        p = p * r + 1.0 / 720.0;
+        p = p * r + 1.0 / 120.0;
+        p = p * r + 1.0 / 24.0;
+        p = p * r + 1.0 / 6.0;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+
+        // 2^n constructed directly in the exponent bits
+        const std::uint64_t bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(n) + 1023) << 52;
+        double scale{};
+        std::memcpy(&scale, &bits, sizeof(double));
+
+        const double result = p * scale;
+        return std::isless(x, lower) ? 0.0 : (std::isgreater(x, upper) ? std::numeric_limits<double>::infinity() : result);
+    } else {
+        // the bounds ensure that the exponent 2^n is a normal number
+        constexpr float lower = -87.33f;
+        constexpr float upper = 88.0f;
+        const float clamped = std::isless(x, lower) ? lower : (std::isgreater(x, upper) ? upper : x);
+
+        // range reduction: x = n * ln(2) + r, ln(2) split into a high and low part such that n * ln2_hi is exact
+        // round to the nearest integer by truncating a positive value
+        const std::int32_t n = static_cast<std::int32_t>(clamped * 1.44269504f + 128.5f) - 128;
+        const float r = impl::reduce(clamped, static_cast<float>(n), 0.693359375f, -2.12194440e-4f);
+
+        // minimax polynomial of e^r (Cephes)
+        float p = 1.9875691500e-4f;
+        p = p * r + 1.3981999507e-3f;
+        p = p * r + 8.3334519073e-3f;
+        p = p * r + 4.1665795894e-2f;
+        p = p * r + 1.6666665459e-1f;
+        p = p * r + 5.0000001201e-1f;
+        p = p * (r * r) + r + 1.0f;
+
+        // 2^n constructed directly in the exponent bits
+        const std::uint32_t bits = static_cast<std::uint32_t>(n + 127) << 23;
+        float scale{};
+        std::memcpy(&scale, &bits, sizeof(float));
+
+        const float result = p * scale;
+        return std::isless(x, lower) ? 0.0f : (std::isgreater(x, upper) ? std::numeric_limits<float>::infinity() : result);
+    }
+}
+
+/**
+ * @brief Calculate \f$e^x\f$ using `std::exp` or fast_exp() selected at compile-time.
+ * @details Overload selected for the choices already dispatched using dispatch_fast_exp().
+ * @tparam T the floating point type
+ * @tparam use_fast_exp if `true`, use fast_exp(), otherwise `std::exp`
+ * @param[in] x the exponent
+ * @return \f$e^x\f$ (`[[nodiscard]]`)
+ */
+template <typename T, bool use_fast_exp>
+[[nodiscard]] inline T kernel_exp(const T x, std::bool_constant<use_fast_exp>) noexcept {
+    if constexpr (use_fast_exp) {
+        return fast_exp(x);
+    } else {
+        return std::exp(x);
+    }
+}
+
+/**
+ * @brief Calculate \f$e^x\f$ using `std::exp` or fast_exp() selected at runtime.
+ * @tparam T the floating point type
+ * @param[in] x the exponent
+ * @param[in] use_fast_exp if `true`, use fast_exp(), otherwise `std::exp`
+ * @return \f$e^x\f$ (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T kernel_exp(const T x, const bool use_fast_exp) noexcept {
+    return use_fast_exp ? fast_exp(x) : std::exp(x);
+}
+
+/**
+ * @brief Call @p func with `std::true_type` if @p use_fast_exp is `true`, otherwise with `std::false_type`.
+ * @details Used to hoist the choice of the exponential function out of the innermost loops, i.e., `kernel_exp(x, use_fast_exp)` inside @p func is resolved at compile-time.
+ * @tparam Func the type of the function
+ * @param[in] use_fast_exp if `true`, fast_exp() should be used
+ * @param[in] func the function to call; must return the same type for both choices
+ * @return the result of @p func
+ */
+template <typename Func>
+inline auto dispatch_fast_exp(const bool use_fast_exp, Func &&func) {
+    if (use_fast_exp) {
+        return std::forward<Func>(func)(std::true_type{});
+    } else {
+        return std::forward<Func>(func)(std::false_type{});
+    }
+}
+
+}  // namespace plssvm::detail
@@ -0,0 +1,136 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the power function with an integer exponent used in the polynomial kernel function.
+ * @details The common degrees of the polynomial kernel function are unrolled into multiplications at compile-time. All other degrees fall back to `std::pow`.
+ */
+
+#pragma once
+
+#include <cmath>        // std::pow
+#include <type_traits>  // std::integral_constant, std::remove_cv_t
+#include <utility>      // std::forward
+
+namespace plssvm::detail {
+
+/// The largest degree of the polynomial kernel function that is unrolled into multiplications.
+constexpr int max_unrolled_degree = 6;
+
+/**
+ * @brief The degree unrolled into multiplications at compile-time of the type @p Degree passed by dispatch_degree(), or `0` if the degree is only known at runtime.
+ * @tparam Degree the type of the degree
+ */
+template <typename Degree>
+struct unrolled_degree : std::integral_constant<int, 0> {};
+/**
+ * @brief The degree unrolled into multiplications at compile-time of the `std::integral_constant<int, degree>` passed by dispatch_degree().
+ * @tparam degree the degree
+ */
+template <int degree>
+struct unrolled_degree<std::integral_constant<int, degree>> : std::integral_constant<int, degree> {};
+/**
+ * @brief Shorthand for `plssvm::detail::unrolled_degree<Degree>::value` ignoring the cv-qualifiers of @p Degree.
+ */
+template <typename Degree>
+constexpr int unrolled_degree_v = unrolled_degree<std::remove_cv_t<Degree>>::value;
+
+/**
+ * @brief Calculate @p base to the power of the compile-time @p degree using exponentiation by squaring.
+ * @tparam degree the non-negative exponent
+ * @tparam T the type of the base
+ * @param[in] base the base
+ * @return \f$base^{degree}\f$ (`[[nodiscard]]`)
+ */
+template <int degree, typename T>
+[[nodiscard]] constexpr T integer_pow(const T base) noexcept {
+    static_assert(degree >= 0, "The degree must not be negative!");
+    if constexpr (degree == 0) {
+        return T{ 1.0 };
+    } else if constexpr (degree == 1) {
+        return base;
+    } else {
+        const T half = integer_pow<degree / 2>(base);
+        if constexpr (degree % 2 == 0) {
+            return half * half;
+        } else {
+            return half * half * base;
+        }
+    }
+}
+
+/**
+ * @brief Calculate @p base to the power of the compile-time degree given as `std::integral_constant`.
+ * @details Overload selected for the degrees already dispatched using dispatch_degree().
+ * @tparam T the type of the base
+ * @tparam degree the non-negative exponent
+ * @param[in] base the base
+ * @return \f$base^{degree}\f$ (`[[nodiscard]]`)
+ */
+template <typename T, int degree>
+[[nodiscard]] constexpr T integer_pow(const T base, std::integral_constant<int, degree>) noexcept {
+    return integer_pow<degree>(base);
+}
+
+/**
+ * @brief Calculate @p base to the power of the runtime @p degree.
+ * @details The degrees [1, max_unrolled_degree] are unrolled into multiplications, all other degrees use `std::pow`.
+ * @tparam T the type of the base
+ * @param[in] base the base
+ * @param[in] degree the exponent
+ * @return \f$base^{degree}\f$ (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T integer_pow(const T base, const int degree) {
+    switch (degree) {
+        case 1:
+            return integer_pow<1>(base);
+        case 2:
+            return integer_pow<2>(base);
+        case 3:
+            return integer_pow<3>(base);
+        case 4:
+            return integer_pow<4>(base);
+        case 5:
+            return integer_pow<5>(base);
+        case 6:
+            return integer_pow<6>(base);
+        default:
+            return std::pow(base, static_cast<T>(degree));
+    }
+}
+
+/**
+ * @brief Call @p func with the runtime @p degree converted to a compile-time `std::integral_constant<int, degree>` if it is in [1, max_unrolled_degree].
+ * @details Otherwise, @p func is called with the `int` @p degree. Used to hoist the dispatch on the degree out of the innermost loops,
+ *          i.e., `integer_pow(base, degree)` inside @p func is resolved at compile-time.
+ * @tparam Func the type of the function
+ * @param[in] degree the degree of the polynomial kernel function
+ * @param[in] func the function to call; must return the same type for all degrees
+ * @return the result of @p func
+ */
+template <typename Func>
+inline auto dispatch_degree(const int degree, Func &&func) {
+    switch (degree) {
+        case 1:
+            return std::forward<Func>(func)(std::integral_constant<int, 1>{});
+        case 2:
+            return std::forward<Func>(func)(std::integral_constant<int, 2>{});
+        case 3:
+            return std::forward<Func>(func)(std::integral_constant<int, 3>{});
+        case 4:
+            return std::forward<Func>(func)(std::integral_constant<int, 4>{});
+        case 5:
+            return std::forward<Func>(func)(std::integral_constant<int, 5>{});
+        case 6:
+            return std::forward<Func>(func)(std::integral_constant<int, 6>{});
+        default:
+            return std::forward<Func>(func)(degree);
+    }
+}
+
+}  // namespace plssvm::detail
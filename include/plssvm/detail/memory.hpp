@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements utility functions to query the memory of the system.
+ */
+
+#pragma once
+
+#include <cstddef>  // std::size_t
+
+namespace plssvm::detail {
+
+/**
+ * @brief Return the currently available physical memory in bytes.
+ * @details Returns `0` if the available memory can't be determined on the current platform.
+ * @return the available memory in bytes (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t available_memory() noexcept;
+
+}  // namespace plssvm::detail
@@ -14,6 +14,7 @@
 #include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
 
 #include <cmath>        // std::fma, std::copysign
+#include <cstddef>      // std::size_t
 #include <type_traits>  // std::is_arithmetic_v
 #include <vector>       // std::vector
 
@@ -81,6 +82,23 @@ PLSSVM_GENERATE_ARITHMETIC_OPERATION(-)
 PLSSVM_GENERATE_ARITHMETIC_OPERATION(*)
 PLSSVM_GENERATE_ARITHMETIC_OPERATION(/)
 
+/**
+ * @brief Calculate the dot product (\f$x^T \cdot y\f$) between the first @p size elements of @p lhs and @p rhs.
+ * @tparam T the value type
+ * @param[in] lhs pointer to the first vector
+ * @param[in] rhs pointer to the second vector
+ * @param[in] size the number of elements
+ * @return the dot product (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T dot(const T *lhs, const T *rhs, const std::size_t size) {
+    T val{};
+    for (std::size_t i = 0; i < size; ++i) {
+        val = std::fma(lhs[i], rhs[i], val);
+    }
+    return val;
+}
+
 /**
  * @brief Wrapper struct for overloading the dot product operator.
  * @details Used to calculate the dot product \f$x^T \cdot y\f$ using
@@ -114,11 +132,7 @@ template <typename T>
 [[nodiscard]] inline T operator*(const transposed<T> &lhs, const std::vector<T> &rhs) {
     PLSSVM_ASSERT(lhs.vec.size() == rhs.size(), "Sizes mismatch!: {} != {}", lhs.vec.size(), rhs.size());
 
-    T val{};
-    for (typename std::vector<T>::size_type i = 0; i < lhs.vec.size(); ++i) {
-        val = std::fma(lhs.vec[i], rhs[i], val);
-    }
-    return val;
+    return dot(lhs.vec.data(), rhs.data(), rhs.size());
 }
 
 /**
@@ -150,22 +164,31 @@ template <typename T>
  * @brief Calculates the squared Euclidean distance of both vectors: \f$d^2(x, y) = (x_1 - y_1)^2 + (x_2 - y_2)^2 + \dots + (x_n - y_n)^2\f$.
  * @details Uses OpenMP SIMD reduction to speedup the calculation.
  * @tparam T the value type
- * @param[in] lhs the first vector
- * @param[in] rhs the second vector
+ * @param[in] lhs pointer to the first vector
+ * @param[in] rhs pointer to the second vector
+ * @param[in] size the number of elements
  * @return the squared euclidean distance (`[[nodiscard]]`)
  */
 template <typename T>
-[[nodiscard]] inline T squared_euclidean_dist(const std::vector<T> &lhs, const std::vector<T> &rhs) {
-    PLSSVM_ASSERT(lhs.size() == rhs.size(), "Sizes mismatch!: {} != {}", lhs.size(), rhs.size());
-
+[[nodiscard]] inline T squared_euclidean_dist(const T *lhs, const T *rhs, const std::size_t size) {
     T val{};
-    for (typename std::vector<T>::size_type i = 0; i < lhs.size(); ++i) {
+    for (std::size_t i = 0; i < size; ++i) {
         const T diff = lhs[i] - rhs[i];
         val = std::fma(diff, diff, val);
     }
     return val;
 }
 
+/**
+ * @copydoc squared_euclidean_dist(const T*, const T*, std::size_t)
+ */
+template <typename T>
+[[nodiscard]] inline T squared_euclidean_dist(const std::vector<T> &lhs, const std::vector<T> &rhs) {
+    PLSSVM_ASSERT(lhs.size() == rhs.size(), "Sizes mismatch!: {} != {}", lhs.size(), rhs.size());
+
+    return squared_euclidean_dist(lhs.data(), rhs.data(), lhs.size());
+}
+
 /**
  * @brief Returns +1 if x is positive and -1 if x is negative or 0.
  * @param[in] x the number parameter to evaluate
@@ -0,0 +1,84 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the exact finite feature map of the polynomial kernel function with a low degree.
+ */
+
+#pragma once
+
+#include <array>    // std::array
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief The exact feature map \f$\phi\f$ of the polynomial kernel function \f$(\gamma \cdot u^T v + coef0)^{degree} = \phi(u)^T \phi(v)\f$.
+ * @details By the multinomial theorem, each feature is a monomial \f$\prod_j x_j^{m_j}\f$ of total degree \f$t \leq degree\f$ scaled with
+ *          \f$\sqrt{\frac{degree!}{(degree - t)! \prod_j m_j!} coef0^{degree - t} \gamma^t}\f$. Monomials with a scale of zero (all with \f$t < degree\f$ if \f$coef0 = 0\f$) are omitted.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class polynomial_feature_map {
+  public:
+    /// The maximum supported degree of the polynomial kernel function.
+    static constexpr int max_degree = 3;
+
+    /**
+     * @brief Check whether the polynomial kernel function with @p degree, @p gamma, and @p coef0 has a feature map supported by this class, i.e., all scales are real.
+     * @param[in] degree the degree parameter of the polynomial kernel function
+     * @param[in] gamma the gamma parameter of the polynomial kernel function
+     * @param[in] coef0 the coef0 parameter of the polynomial kernel function
+     * @return `true` if `1 <= degree <= max_degree`, @p gamma is positive and @p coef0 isn't negative, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static bool is_supported(int degree, T gamma, T coef0) noexcept;
+    /**
+     * @brief Calculate the number of features of the feature map without creating it.
+     * @param[in] num_features the number of features per data point
+     * @param[in] degree the degree parameter of the polynomial kernel function
+     * @param[in] coef0 the coef0 parameter of the polynomial kernel function
+     * @return the number of features \f$\binom{d + degree}{degree}\f$ or \f$\binom{d + degree - 1}{degree}\f$ if @p coef0 is zero (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::size_t size(std::size_t num_features, int degree, T coef0) noexcept;
+
+    /**
+     * @brief Create the feature map of the polynomial kernel function with @p degree, @p gamma, and @p coef0 for data points with @p num_features features.
+     * @param[in] num_features the number of features per data point
+     * @param[in] degree the degree parameter of the polynomial kernel function
+     * @param[in] gamma the gamma parameter of the polynomial kernel function
+     * @param[in] coef0 the coef0 parameter of the polynomial kernel function
+     * @throws plssvm::exception if the feature map isn't supported (see is_supported())
+     */
+    polynomial_feature_map(std::size_t num_features, int degree, T gamma, T coef0);
+
+    /**
+     * @brief Return the number of features of the feature map.
+     * @return the number of features (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return scales_.size(); }
+
+    /**
+     * @brief Map the @p point to the size() @p features of the feature map.
+     * @param[in] point the data point
+     * @param[out] features the features of the @p point, must have room for size() values
+     */
+    void operator()(const T *point, T *features) const;
+
+  private:
+    /// The scale of each monomial.
+    std::vector<T> scales_{};
+    /// The indices of the data point features multiplied in each monomial (only the first @p t entries of a monomial of total degree @p t are used).
+    std::vector<std::array<std::size_t, max_degree>> indices_{};
+    /// The monomials of total degree @p t are stored in the range `[degree_begin_[t], degree_begin_[t + 1])`.
+    std::array<std::size_t, max_degree + 2> degree_begin_{};
+};
+
+extern template class polynomial_feature_map<float>;
+extern template class polynomial_feature_map<double>;
+
+}  // namespace plssvm::detail
@@ -0,0 +1,192 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the preconditioners used in the CG solver.
+ */
+
+#pragma once
+
+#include "plssvm/preconditioner_types.hpp"  // plssvm::preconditioner_type
+
+#include <cstddef>      // std::size_t
+#include <functional>   // std::function
+#include <memory>       // std::unique_ptr
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Base class for all preconditioners \f$M \approx A\f$ of a symmetric positive definite matrix \f$A\f$ used in the CG solver.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class preconditioner {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+    /// The type of the function returning the entry \f$A_{ij}\f$, called as `entry(i, j)`. Must be callable concurrently from multiple threads.
+    using entry_function_type = std::function<real_type(std::size_t, std::size_t)>;
+
+    /**
+     * @brief Virtual destructor to enable safe inheritance.
+     */
+    virtual ~preconditioner() = default;
+
+    /**
+     * @brief Apply the preconditioner to @p r, i.e., calculate \f$z = M^{-1} r\f$.
+     * @param[in] r the vector to precondition
+     * @param[out] z the preconditioned vector, must have the same size as @p r
+     */
+    virtual void apply(const std::vector<real_type> &r, std::vector<real_type> &z) const = 0;
+};
+
+/**
+ * @brief The Jacobi preconditioner \f$M = \operatorname{diag}(A)\f$.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class jacobi_preconditioner final : public preconditioner<T> {
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using typename preconditioner<T>::real_type;
+    /// The type of the function returning the entry \f$A_{ij}\f$.
+    using typename preconditioner<T>::entry_function_type;
+
+    /**
+     * @brief Construct the Jacobi preconditioner of the @p size x @p size matrix given by @p entry.
+     * @param[in] size the number of rows and columns of the matrix
+     * @param[in] entry the function returning the matrix entries
+     * @throws plssvm::exception if a diagonal entry isn't positive
+     */
+    jacobi_preconditioner(std::size_t size, const entry_function_type &entry);
+
+    /**
+     * @copydoc plssvm::detail::preconditioner::apply
+     */
+    void apply(const std::vector<real_type> &r, std::vector<real_type> &z) const override;
+
+  private:
+    /// The inverse of the diagonal entries.
+    std::vector<real_type> inverse_diagonal_{};
+};
+
+/**
+ * @brief The block-Jacobi preconditioner consisting of the dense diagonal blocks of \f$A\f$, each inverted using its Cholesky decomposition.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class block_jacobi_preconditioner final : public preconditioner<T> {
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using typename preconditioner<T>::real_type;
+    /// The type of the function returning the entry \f$A_{ij}\f$.
+    using typename preconditioner<T>::entry_function_type;
+
+    /**
+     * @brief Construct the block-Jacobi preconditioner of the @p size x @p size matrix given by @p entry using diagonal blocks with @p block_size rows.
+     * @details The last block may be smaller than @p block_size.
+     * @param[in] size the number of rows and columns of the matrix
+     * @param[in] block_size the number of rows and columns of the diagonal blocks
+     * @param[in] entry the function returning the matrix entries
+     * @throws plssvm::exception if @p block_size is `0`
+     * @throws plssvm::exception if a diagonal block isn't positive definite
+     */
+    block_jacobi_preconditioner(std::size_t size, std::size_t block_size, const entry_function_type &entry);
+
+    /**
+     * @copydoc plssvm::detail::preconditioner::apply
+     */
+    void apply(const std::vector<real_type> &r, std::vector<real_type> &z) const override;
+
+  private:
+    /// The number of rows and columns of the matrix.
+    std::size_t size_{};
+    /// The number of rows and columns of the diagonal blocks.
+    std::size_t block_size_{};
+    /// The lower triangular Cholesky factors of all diagonal blocks, each stored in a dense, row-major `block_size_` x `block_size_` block.
+    std::vector<real_type> factors_{};
+};
+
+/**
+ * @brief The pivoted Cholesky (Nyström) preconditioner \f$M = L L^T + \sigma I\f$, where \f$L\f$ is the low-rank pivoted Cholesky factor of \f$A - \sigma I\f$.
+ * @details Applied using the Woodbury identity \f$M^{-1} r = \frac{1}{\sigma} (r - L (\sigma I + L^T L)^{-1} L^T r)\f$.
+ *          Only the diagonal and the columns of the selected pivots are evaluated, i.e., \f$\mathcal{O}(n \cdot rank)\f$ matrix entries.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class pivoted_cholesky_preconditioner final : public preconditioner<T> {
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using typename preconditioner<T>::real_type;
+    /// The type of the function returning the entry \f$A_{ij}\f$.
+    using typename preconditioner<T>::entry_function_type;
+
+    /**
+     * @brief Construct the pivoted Cholesky preconditioner of the @p size x @p size matrix given by @p entry with at most rank @p rank.
+     * @details The decomposition stops early if the largest remaining diagonal entry of \f$A - \sigma I - L L^T\f$ is negligible compared to the largest initial one.
+     * @param[in] size the number of rows and columns of the matrix
+     * @param[in] rank the maximum rank of the low-rank factor
+     * @param[in] shift the positive regularization \f$\sigma\f$ on the diagonal of the matrix
+     * @param[in] entry the function returning the matrix entries
+     * @throws plssvm::exception if @p rank is `0`
+     * @throws plssvm::exception if @p shift isn't positive
+     */
+    pivoted_cholesky_preconditioner(std::size_t size, std::size_t rank, real_type shift, const entry_function_type &entry);
+
+    /**
+     * @copydoc plssvm::detail::preconditioner::apply
+     */
+    void apply(const std::vector<real_type> &r, std::vector<real_type> &z) const override;
+
+    /**
+     * @brief Return the actual rank of the low-rank factor.
+     * @return the rank (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t rank() const noexcept { return rank_; }
+
+  private:
+    /// The number of rows and columns of the matrix.
+    std::size_t size_{};
+    /// The maximum rank of the low-rank factor.
+    std::size_t max_rank_{};
+    /// The actual rank of the low-rank factor.
+    std::size_t rank_{};
+    /// The regularization on the diagonal of the matrix.
+    real_type shift_{};
+    /// The low-rank factor \f$L\f$, stored row-major with `max_rank_` values per row.
+    std::vector<real_type> factor_{};
+    /// The lower triangular Cholesky factor of the `rank_` x `rank_` matrix \f$\sigma I + L^T L\f$, stored row-major.
+    std::vector<real_type> inner_factor_{};
+};
+
+/**
+ * @brief Create the preconditioner of type @p type for the @p size x @p size symmetric positive definite matrix given by @p entry.
+ * @tparam T the type of the data
+ * @param[in] type the preconditioner type
+ * @param[in] size the number of rows and columns of the matrix
+ * @param[in] precond_size the block size of the plssvm::preconditioner_type::block_jacobi or the maximum rank of the plssvm::preconditioner_type::pivoted_cholesky preconditioner
+ * @param[in] shift the positive regularization on the diagonal of the matrix used in the plssvm::preconditioner_type::pivoted_cholesky preconditioner
+ * @param[in] entry the function returning the matrix entries
+ * @throws plssvm::exception if the preconditioner can't be created
+ * @return the preconditioner or a `nullptr` for plssvm::preconditioner_type::none (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] std::unique_ptr<preconditioner<T>> make_preconditioner(preconditioner_type type, std::size_t size, std::size_t precond_size, T shift, const typename preconditioner<T>::entry_function_type &entry);
+
+extern template class jacobi_preconditioner<float>;
+extern template class jacobi_preconditioner<double>;
+extern template class block_jacobi_preconditioner<float>;
+extern template class block_jacobi_preconditioner<double>;
+extern template class pivoted_cholesky_preconditioner<float>;
+extern template class pivoted_cholesky_preconditioner<double>;
+
+}  // namespace plssvm::detail
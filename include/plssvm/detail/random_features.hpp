@@ -0,0 +1,46 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the generation of the random Fourier features approximating the rbf kernel function.
+ */
+
+#pragma once
+
+#include "plssvm/matrix.hpp"  // plssvm::aos_matrix
+
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Generate the @p num_random_features random offsets \f$b_k \sim U[0, 2\pi)\f$ of the random Fourier features \f$\sqrt{2 / D} \cos(\omega_k^T x + b_k)\f$ using the seed @p seed.
+ * @details The random numbers are generated using `std::mt19937_64` without a standard library distribution, i.e., the same seed yields the same offsets on all platforms.
+ * @tparam T the type of the data
+ * @param[in] num_random_features the number of random features \f$D\f$
+ * @param[in] seed the seed of the random number generator
+ * @return the random offsets (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] std::vector<T> random_fourier_offsets(std::size_t num_random_features, unsigned long long seed);
+
+/**
+ * @brief Generate the @p num_random_features random frequencies \f$\omega_k \sim N(0, 2 \gamma I)\f$ of the random Fourier features approximating the rbf kernel function with @p gamma using the seed @p seed.
+ * @details The random numbers are drawn after the offsets of random_fourier_offsets() from the same random number generator. The frequencies are generated feature by feature,
+ *          i.e., the frequencies of the first features don't depend on @p num_features.
+ * @tparam T the type of the data
+ * @param[in] num_features the number of features per data point
+ * @param[in] num_random_features the number of random features \f$D\f$
+ * @param[in] gamma the gamma parameter of the rbf kernel function
+ * @param[in] seed the seed of the random number generator
+ * @return the @p num_random_features x @p num_features matrix of the random frequencies (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] aos_matrix<T> random_fourier_frequencies(std::size_t num_features, std::size_t num_random_features, T gamma, unsigned long long seed);
+
+}  // namespace plssvm::detail
@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the policy deciding when the recursively updated residual in the CG algorithm is replaced by the true residual.
+ */
+
+#pragma once
+
+#include <algorithm>    // std::max
+#include <cstddef>      // std::size_t
+#include <type_traits>  // std::is_same_v
+
+namespace plssvm::detail {
+
+/**
+ * @brief Decides when the recursively updated residual \f$r_{i+1} = r_i - \alpha_i A d_i\f$ in the CG algorithm is replaced by the true residual \f$r = b - Ax\f$.
+ * @details Due to rounding errors, the recursively updated residual drifts away from the true residual. Following the reliable updating strategy of Sleijpen and van der Vorst,
+ *          this drift is proportional to the largest residual norm since the last replacement. Therefore, the true residual is recomputed once the current residual norm
+ *          dropped below `threshold` times this largest norm or, at the latest, after `interval` iterations.
+ * @tparam T the type of the residual norms
+ */
+template <typename T>
+class residual_replacement {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the residual norms.
+    using real_type = T;
+
+    /**
+     * @brief Construct a new residual replacement policy.
+     * @param[in] threshold the relative residual norm reduction after which the true residual is recomputed; `0` disables the drift-based replacement, `1` replaces the residual in every iteration
+     * @param[in] interval the maximum number of iterations between two replacements; `0` disables the fixed upper bound
+     */
+    residual_replacement(const real_type threshold, const std::size_t interval) noexcept :
+        threshold_{ threshold * threshold }, interval_{ interval } {}
+
+    /**
+     * @brief Restart the drift tracking after the true residual with the squared norm @p delta has been (re)computed.
+     * @param[in] delta the squared norm of the true residual
+     */
+    void reset(const real_type delta) noexcept {
+        max_delta_ = delta;
+        num_iterations_ = 0;
+    }
+    /**
+     * @brief Check whether the recursively updated residual with the squared norm @p delta must be replaced by the true residual.
+     * @details Must be called exactly once per CG iteration. If `true` is returned, the true residual must be computed and reset() must be called.
+     * @param[in] delta the squared norm of the recursively updated residual
+     * @return `true` if the true residual must be recomputed, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool replace(const real_type delta) noexcept {
+        ++num_iterations_;
+        max_delta_ = std::max(max_delta_, delta);
+        return delta <= threshold_ * max_delta_ || (interval_ > 0 && num_iterations_ >= interval_);
+    }
+
+  private:
+    /// The squared relative residual norm reduction after which the true residual is recomputed.
+    const real_type threshold_;
+    /// The maximum number of iterations between two replacements.
+    const std::size_t interval_;
+    /// The largest squared residual norm since the last replacement.
+    real_type max_delta_{ 0.0 };
+    /// The number of iterations since the last replacement.
+    std::size_t num_iterations_{ 0 };
+};
+
+}  // namespace plssvm::detail
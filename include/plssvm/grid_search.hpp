@@ -0,0 +1,189 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a hyperparameter grid search evaluating all kernel functions using a single, reusable Gram matrix.
+ */
+
+#pragma once
+
+#include "plssvm/kernel_types.hpp"          // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                // plssvm::aos_matrix
+#include "plssvm/preconditioner_types.hpp"  // plssvm::preconditioner_type
+
+#include <cstddef>      // std::size_t
+#include <memory>       // std::shared_ptr
+#include <string>       // std::string
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
+
+namespace plssvm {
+
+// forward declare class
+template <typename T>
+class parameter;
+
+/**
+ * @brief A single combination of hyperparameters evaluated by the plssvm::grid_search together with its cross-validation accuracy.
+ * @tparam T the type of the data
+ */
+template <typename T>
+struct grid_point {
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+
+    /// The gamma parameter used in the polynomial and rbf kernel functions.
+    real_type gamma{};
+    /// The coef0 parameter used in the polynomial kernel function.
+    real_type coef0{};
+    /// The degree parameter used in the polynomial kernel function.
+    int degree{};
+    /// The cost parameter in the C-SVM.
+    real_type cost{};
+    /// The fraction of correctly predicted data points in the cross-validation. Only valid after plssvm::grid_search::evaluate.
+    real_type accuracy{};
+};
+
+/**
+ * @brief Evaluates combinations of hyperparameters using k-fold cross-validation on the host.
+ * @details All implemented kernel functions are elementwise transformations of the Gram matrix \f$G = X X^T\f$:
+ *          \f$K_{ij} = G_{ij}\f$ (linear), \f$K_{ij} = (\gamma G_{ij} + coef0)^{degree}\f$ (polynomial), and \f$K_{ij} = e^{-\gamma (G_{ii} + G_{jj} - 2 G_{ij})}\f$ (rbf).
+ *          Therefore, \f$G\f$ is computed only once (or read from a cache file) and the kernel matrix of each combination of kernel parameters is a cheap transformation of it,
+ *          which is shared by all costs and folds of this combination. The least-squares problems of these costs and folds are independent and solved concurrently, each one using a single thread
+ *          and the same (preconditioned) CG solver as plssvm::csvm::learn().
+ *          \f$G\f$ and the current kernel matrix are stored explicitly as packed lower triangles, i.e., they need \f$n (n + 1) / 2\f$ values each
+ *          (the linear kernel function directly uses \f$G\f$).
+ * @tparam T the type of the data
+ */
+template <typename T>
+class grid_search {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+
+    /**
+     * @brief Construct a new grid search for the data and labels given through @p params and compute its Gram matrix.
+     * @details If @p gram_cache_filename isn't empty and the file contains the Gram matrix of the data set (identified by a hash of the data points), the Gram matrix is read from it.
+     *          Otherwise, the Gram matrix is computed and, if @p gram_cache_filename isn't empty, written to it.
+     * @param[in] params struct encapsulating all possible parameters; uses the kernel type, the CG solver parameters (epsilon, residual replacement, and preconditioner), fast_math_kernels, print_info, the data, and the labels
+     * @param[in] gram_cache_filename the file the Gram matrix is read from or written to; if empty, no cache file is used
+     * @throws plssvm::exception if no data points or no labels are given
+     * @throws plssvm::exception if the number of labels and number of data points mismatch
+     * @throws plssvm::exception if the original labels contain more than two classes
+     * @throws plssvm::exception if the Gram matrix cache file can't be written
+     */
+    explicit grid_search(const parameter<T> &params, const std::string &gram_cache_filename = "");
+
+    /**
+     * @brief Create the cartesian product of all hyperparameters used by the @p kernel function.
+     * @details Parameters unused by the @p kernel function are set to the first given value, e.g., only @p costs is varied for the linear kernel function.
+     * @param[in] kernel the kernel function
+     * @param[in] gammas the gamma values
+     * @param[in] coef0s the coef0 values
+     * @param[in] degrees the degree values
+     * @param[in] costs the cost values
+     * @throws plssvm::exception if one of the hyperparameter lists is empty
+     * @throws plssvm::exception if a cost isn't positive
+     * @return all grid points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::vector<grid_point<real_type>> make_grid(kernel_type kernel, const std::vector<real_type> &gammas, const std::vector<real_type> &coef0s, const std::vector<int> &degrees, const std::vector<real_type> &costs);
+
+    /**
+     * @brief Calculate the @p num_folds -fold cross-validation accuracy of all grid points in @p grid.
+     * @details The data point with index `i` belongs to the fold `i % num_folds`.
+     * @param[in] grid the grid points to evaluate
+     * @param[in] num_folds the number of folds
+     * @throws plssvm::exception if @p num_folds is less than 2 or greater than the number of data points
+     * @throws plssvm::exception if a fold has less than two training data points
+     * @throws plssvm::exception if the preconditioner of a fold can't be created
+     * @return @p grid with the calculated accuracies (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<grid_point<real_type>> evaluate(std::vector<grid_point<real_type>> grid, std::size_t num_folds) const;
+
+    /**
+     * @brief Return the Gram matrix of the data set.
+     * @details The entry \f$G_{ij}\f$ with \f$j \leq i\f$ is stored at the index \f$i (i + 1) / 2 + j\f$.
+     * @return the lower triangle of the Gram matrix, stored packed row by row (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<real_type> &gram_matrix() const noexcept { return gram_; }
+
+  private:
+    /**
+     * @brief Compute the Gram matrix #gram_ of the data set.
+     */
+    void compute_gram_matrix();
+    /**
+     * @brief Read the Gram matrix #gram_ from the file @p filename.
+     * @param[in] filename the Gram matrix cache file
+     * @return `true` if the file contains the Gram matrix of the data set, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool read_gram_matrix(const std::string &filename);
+    /**
+     * @brief Write the Gram matrix #gram_ to the file @p filename.
+     * @param[in] filename the Gram matrix cache file
+     * @throws plssvm::exception if the file can't be written
+     */
+    void write_gram_matrix(const std::string &filename) const;
+    /**
+     * @brief Learn the least-squares model for @p cost on all data points not in @p fold using the kernel matrix @p kernel_matrix of all data points and predict the data points in @p fold.
+     * @details The least-squares problem is solved like in plssvm::csvm::learn(), i.e., using the same initial guess, maximum number of CG iterations, preconditioner, and residual replacement.
+     * @param[in] kernel_matrix the lower triangle of the kernel matrix of all data points, stored packed row by row
+     * @param[in] cost the cost parameter
+     * @param[in] fold the fold of the validation data points
+     * @param[in] num_folds the number of folds
+     * @throws plssvm::exception if the preconditioner can't be created
+     * @return the number of correctly predicted data points in @p fold (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t evaluate_fold(const std::vector<real_type> &kernel_matrix, real_type cost, std::size_t fold, std::size_t num_folds) const;
+    /**
+     * @brief Check whether the grid points @p lhs and @p rhs have the same kernel matrix, i.e., whether they only differ in parameters unused by #kernel_ or in the cost.
+     * @param[in] lhs the first grid point
+     * @param[in] rhs the second grid point
+     * @return `true` if both grid points have the same kernel matrix, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool same_kernel_matrix(const grid_point<real_type> &lhs, const grid_point<real_type> &rhs) const noexcept;
+    /**
+     * @brief Compute the kernel matrix of all data points for the kernel parameters of the grid point @p point from the Gram matrix #gram_.
+     * @param[in] point the grid point
+     * @throws plssvm::unsupported_kernel_type_exception if the kernel type is unknown
+     * @return the lower triangle of the kernel matrix, stored packed row by row (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<real_type> compute_kernel_matrix(const grid_point<real_type> &point) const;
+
+    /// The used kernel function.
+    const kernel_type kernel_;
+    /// The error tolerance parameter for the CG algorithm.
+    const real_type epsilon_;
+    /// The relative residual norm reduction after which the recursively updated residual in the CG algorithm is replaced by the true residual.
+    const real_type replace_threshold_;
+    /// The maximum number of CG iterations between two replacements of the recursively updated residual by the true residual.
+    const std::size_t replace_interval_;
+    /// The preconditioner used in the CG algorithm.
+    const preconditioner_type preconditioner_;
+    /// The block size of the block-Jacobi preconditioner or the maximum rank of the pivoted Cholesky preconditioner.
+    const std::size_t precond_size_;
+    /// If `true`, the rbf kernel matrices are computed using plssvm::detail::fast_exp instead of `std::exp`.
+    const bool fast_math_kernels_;
+    /// If `true` additional information (e.g. timing information) will be printed during execution.
+    const bool print_info_;
+    /// The data used for the cross-validation.
+    const std::shared_ptr<const aos_matrix<real_type>> data_ptr_{};
+    /// The labels associated to each data point.
+    const std::shared_ptr<const std::vector<real_type>> value_ptr_{};
+    /// The number of data points in the data set.
+    std::size_t num_data_points_{};
+    /// The lower triangle of the Gram matrix of the data set, stored packed row by row.
+    std::vector<real_type> gram_{};
+};
+
+extern template class grid_search<float>;
+extern template class grid_search<double>;
+
+}  // namespace plssvm
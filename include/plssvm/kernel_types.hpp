@@ -11,13 +11,17 @@
 
 #pragma once
 
-#include "plssvm/detail/assert.hpp"     // PLSSVM_ASSERT
-#include "plssvm/detail/operators.hpp"  // dot product, plssvm::squared_euclidean_dist
-#include "plssvm/detail/utility.hpp"    // plssvm::detail::always_false_v
+#include "plssvm/detail/assert.hpp"       // PLSSVM_ASSERT
+#include "plssvm/detail/fast_exp.hpp"     // plssvm::detail::kernel_exp
+#include "plssvm/detail/integer_pow.hpp"  // plssvm::detail::integer_pow
+#include "plssvm/detail/operators.hpp"    // dot product, plssvm::squared_euclidean_dist
+#include "plssvm/detail/utility.hpp"      // plssvm::detail::always_false_v
 
-#include <cmath>   // std::pow, std::exp, std::fma
-#include <iosfwd>  // forward declare std::ostream and std::istream
-#include <vector>  // std::vector
+#include <cmath>    // std::exp, std::fma
+#include <cstddef>  // std::size_t
+#include <iosfwd>   // forward declare std::ostream and std::istream
+#include <utility>  // std::forward
+#include <vector>   // std::vector
 
 namespace plssvm {
 
@@ -51,37 +55,61 @@ std::ostream &operator<<(std::ostream &out, kernel_type kernel);
 std::istream &operator>>(std::istream &in, kernel_type &kernel);
 
 /**
- * @brief Computes the value of the two vectors @p xi and @p xj using the @p kernel function determined at compile-time.
+ * @brief Computes the value of the two vectors @p xi and @p xj, each consisting of @p num_features values, using the @p kernel function determined at compile-time.
+ * @details Used to directly operate on the rows of a plssvm::aos_matrix. The degree of the polynomial kernel function is either an integer or a
+ *          `std::integral_constant<int, degree>` selecting the power unrolled into multiplications at compile-time (see plssvm::detail::dispatch_degree).
+ *          The rbf kernel function optionally takes a second parameter selecting plssvm::detail::fast_exp instead of `std::exp`, either as `bool` or
+ *          as `std::bool_constant` (see plssvm::detail::dispatch_fast_exp).
  * @tparam kernel the type of the kernel
  * @tparam real_type the type of the values
  * @tparam Args additional parameters used in the respective kernel function
- * @param[in] xi the first vector
- * @param[in] xj the second vector
+ * @param[in] xi pointer to the first vector
+ * @param[in] xj pointer to the second vector
+ * @param[in] num_features the number of values in both vectors
  * @param[in] args additional parameters
  * @return the value computed by the @p kernel function (`[[nodiscard]]`)
  */
 template <kernel_type kernel, typename real_type, typename... Args>
-[[nodiscard]] inline real_type kernel_function(const std::vector<real_type> &xi, const std::vector<real_type> &xj, Args &&...args) {
+[[nodiscard]] inline real_type kernel_function(const real_type *xi, const real_type *xj, const std::size_t num_features, Args &&...args) {
     using namespace plssvm::operators;
 
-    PLSSVM_ASSERT(xi.size() == xj.size(), "Sizes mismatch!: {} != {}", xi.size(), xj.size());
-
     if constexpr (kernel == kernel_type::linear) {
         static_assert(sizeof...(args) == 0, "Illegal number of additional parameters! Must be 0.");
-        return transposed{ xi } * xj;
+        return dot(xi, xj, num_features);
     } else if constexpr (kernel == kernel_type::polynomial) {
         static_assert(sizeof...(args) == 3, "Illegal number of additional parameters! Must be 3.");
-        const auto degree = static_cast<real_type>(detail::get<0>(args...));
+        const auto degree = detail::get<0>(args...);
         const auto gamma = static_cast<real_type>(detail::get<1>(args...));
         const auto coef0 = static_cast<real_type>(detail::get<2>(args...));
-        return std::pow(std::fma(gamma, (transposed<real_type>{ xi } * xj), coef0), degree);
+        return detail::integer_pow(std::fma(gamma, dot(xi, xj, num_features), coef0), degree);
     } else if constexpr (kernel == kernel_type::rbf) {
-        static_assert(sizeof...(args) == 1, "Illegal number of additional parameters! Must be 1.");
+        static_assert(sizeof...(args) == 1 || sizeof...(args) == 2, "Illegal number of additional parameters! Must be 1 or 2.");
         const auto gamma = static_cast<real_type>(detail::get<0>(args...));
-        return std::exp(-gamma * squared_euclidean_dist(xi, xj));
+        if constexpr (sizeof...(args) == 2) {
+            return detail::kernel_exp(-gamma * squared_euclidean_dist(xi, xj, num_features), detail::get<1>(args...));
+        } else {
+            return std::exp(-gamma * squared_euclidean_dist(xi, xj, num_features));
+        }
     } else {
         static_assert(detail::always_false_v<real_type>, "Unknown kernel type!");
     }
 }
 
+/**
+ * @brief Computes the value of the two vectors @p xi and @p xj using the @p kernel function determined at compile-time.
+ * @tparam kernel the type of the kernel
+ * @tparam real_type the type of the values
+ * @tparam Args additional parameters used in the respective kernel function
+ * @param[in] xi the first vector
+ * @param[in] xj the second vector
+ * @param[in] args additional parameters
+ * @return the value computed by the @p kernel function (`[[nodiscard]]`)
+ */
+template <kernel_type kernel, typename real_type, typename... Args>
+[[nodiscard]] inline real_type kernel_function(const std::vector<real_type> &xi, const std::vector<real_type> &xj, Args &&...args) {
+    PLSSVM_ASSERT(xi.size() == xj.size(), "Sizes mismatch!: {} != {}", xi.size(), xj.size());
+
+    return kernel_function<kernel>(xi.data(), xj.data(), xi.size(), std::forward<Args>(args)...);
+}
+
 }  // namespace plssvm
@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines all possible strategies selecting the landmarks of the Nyström approximation.
+ */
+
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all possible strategies selecting the landmarks of the Nyström approximation.
+ */
+enum class landmark_selection_type {
+    /** Use kernel k-means++ seeding, i.e., draw each landmark with a probability proportional to its squared distance to the nearest landmark in the kernel feature space. */
+    kmeans_pp,
+    /** Draw the landmarks uniformly at random without replacement. */
+    uniform
+};
+
+/**
+ * @brief Output the landmark @p selection type to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the landmark selection type to
+ * @param[in] selection the landmark selection type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, landmark_selection_type selection);
+
+/**
+ * @brief Use the input-stream @p in to initialize the landmark @p selection type.
+ * @param[in,out] in input-stream to extract the landmark selection type from
+ * @param[in] selection the landmark selection type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, landmark_selection_type &selection);
+
+}  // namespace plssvm
@@ -0,0 +1,262 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a dense, contiguous and padded matrix used to store the data points.
+ */
+
+#pragma once
+
+#include "plssvm/constants.hpp"                  // plssvm::MATRIX_ALIGNMENT
+#include "plssvm/detail/aligned_allocator.hpp"   // plssvm::detail::aligned_allocator
+#include "plssvm/detail/assert.hpp"              // PLSSVM_ASSERT
+#include "plssvm/exceptions/exceptions.hpp"      // plssvm::exception
+
+#include <algorithm>    // std::all_of, std::copy
+#include <cstddef>      // std::size_t
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for the different memory layouts of a matrix.
+ */
+enum class layout_type {
+    /** Array-of-Structs: the features of one data point are stored contiguously (row-major). */
+    aos,
+    /** Struct-of-Arrays: the values of one feature of all data points are stored contiguously (column-major). */
+    soa
+};
+
+/**
+ * @brief Return the number of padding entries necessary to round @p size up to a multiple of plssvm::MATRIX_ALIGNMENT bytes.
+ * @tparam T the type of the elements
+ * @param[in] size the number of elements to pad
+ * @return the number of padding elements (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] constexpr std::size_t simd_padding(const std::size_t size) noexcept {
+    constexpr std::size_t simd_width = static_cast<std::size_t>(MATRIX_ALIGNMENT) / sizeof(T);
+    return (simd_width - size % simd_width) % simd_width;
+}
+
+/**
+ * @brief A dense matrix stored in one contiguous, aligned memory block using the memory layout @p layout.
+ * @details Each row (plssvm::layout_type::aos) or column (plssvm::layout_type::soa) can be followed by padding entries,
+ *          additional padding rows and columns are appended at the end. All padding entries are zero-initialized.
+ * @tparam T the type of the data
+ * @tparam layout the memory layout
+ */
+template <typename T, layout_type layout>
+class matrix {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using value_type = T;
+    /// The unsigned integer type used for sizes and indices.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Default construct an empty matrix.
+     */
+    matrix() = default;
+    /**
+     * @brief Construct a zero-initialized @p num_rows x @p num_cols matrix with @p row_padding additional rows and @p col_padding additional columns.
+     * @param[in] num_rows the number of rows (data points)
+     * @param[in] num_cols the number of columns (features)
+     * @param[in] row_padding the number of zero-initialized padding rows
+     * @param[in] col_padding the number of zero-initialized padding columns
+     */
+    matrix(const size_type num_rows, const size_type num_cols, const size_type row_padding = 0, const size_type col_padding = 0) :
+        num_rows_{ num_rows }, num_cols_{ num_cols }, row_padding_{ row_padding }, col_padding_{ col_padding }, data_((num_rows + row_padding) * (num_cols + col_padding), value_type{ 0.0 }) {}
+    /**
+     * @brief Construct a matrix from the 2D vector @p data, where each inner vector represents one data point (row).
+     * @param[in] data the 2D data
+     * @param[in] row_padding the number of zero-initialized padding rows
+     * @param[in] col_padding the number of zero-initialized padding columns
+     * @throws plssvm::exception if not all points in @p data have the same number of features
+     */
+    explicit matrix(const std::vector<std::vector<value_type>> &data, const size_type row_padding = 0, const size_type col_padding = 0) :
+        matrix{ data.size(), data.empty() ? 0 : data.front().size(), row_padding, col_padding } {
+        if (!std::all_of(data.begin(), data.end(), [&](const std::vector<value_type> &point) { return point.size() == num_cols_; })) {
+            throw exception{ "All points in the data vector must have the same number of features!" };
+        }
+        #pragma omp parallel for if (num_rows_ * num_cols_ > 10000)
+        for (size_type row = 0; row < num_rows_; ++row) {
+            for (size_type col = 0; col < num_cols_; ++col) {
+                (*this)(row, col) = data[row][col];
+            }
+        }
+    }
+    /**
+     * @brief Construct a matrix with the same values as @p other, possibly converting the memory layout and changing the padding.
+     * @tparam other_layout the memory layout of the matrix to copy
+     * @param[in] other the matrix to copy
+     * @param[in] row_padding the number of zero-initialized padding rows
+     * @param[in] col_padding the number of zero-initialized padding columns
+     */
+    template <layout_type other_layout>
+    matrix(const matrix<value_type, other_layout> &other, const size_type row_padding, const size_type col_padding) :
+        matrix{ other.num_rows(), other.num_cols(), row_padding, col_padding } {
+        if constexpr (layout == layout_type::aos) {
+            #pragma omp parallel for if (num_rows_ * num_cols_ > 10000)
+            for (size_type row = 0; row < num_rows_; ++row) {
+                for (size_type col = 0; col < num_cols_; ++col) {
+                    (*this)(row, col) = other(row, col);
+                }
+            }
+        } else {
+            #pragma omp parallel for if (num_rows_ * num_cols_ > 10000)
+            for (size_type col = 0; col < num_cols_; ++col) {
+                for (size_type row = 0; row < num_rows_; ++row) {
+                    (*this)(row, col) = other(row, col);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Return the number of rows (data points) without padding.
+     * @return the number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_rows() const noexcept { return num_rows_; }
+    /**
+     * @brief Return the number of columns (features) without padding.
+     * @return the number of columns (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_cols() const noexcept { return num_cols_; }
+    /**
+     * @brief Return the number of padding rows.
+     * @return the number of padding rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type row_padding() const noexcept { return row_padding_; }
+    /**
+     * @brief Return the number of padding columns.
+     * @return the number of padding columns (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type col_padding() const noexcept { return col_padding_; }
+    /**
+     * @brief Return the number of rows including padding, i.e., the stride between two consecutive columns in a plssvm::layout_type::soa matrix.
+     * @return the padded number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_rows_padded() const noexcept { return num_rows_ + row_padding_; }
+    /**
+     * @brief Return the number of columns including padding, i.e., the stride between two consecutive rows in a plssvm::layout_type::aos matrix.
+     * @return the padded number of columns (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_cols_padded() const noexcept { return num_cols_ + col_padding_; }
+    /**
+     * @brief Check whether the matrix contains no entries (padding excluded).
+     * @return `true` if the matrix is empty, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool empty() const noexcept { return num_rows_ == 0 || num_cols_ == 0; }
+
+    /**
+     * @brief Return the entry at position (@p row, @p col).
+     * @param[in] row the row index
+     * @param[in] col the column index
+     * @return the entry (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const value_type &operator()(const size_type row, const size_type col) const noexcept {
+        PLSSVM_ASSERT(row < num_rows_padded() && col < num_cols_padded(), "Out-of-bounce access!: ({}, {}) >= ({}, {})", row, col, num_rows_padded(), num_cols_padded());
+        if constexpr (layout == layout_type::aos) {
+            return data_[row * num_cols_padded() + col];
+        } else {
+            return data_[col * num_rows_padded() + row];
+        }
+    }
+    /**
+     * @copydoc operator()(size_type, size_type) const
+     */
+    [[nodiscard]] value_type &operator()(const size_type row, const size_type col) noexcept {
+        PLSSVM_ASSERT(row < num_rows_padded() && col < num_cols_padded(), "Out-of-bounce access!: ({}, {}) >= ({}, {})", row, col, num_rows_padded(), num_cols_padded());
+        if constexpr (layout == layout_type::aos) {
+            return data_[row * num_cols_padded() + col];
+        } else {
+            return data_[col * num_rows_padded() + row];
+        }
+    }
+
+    /**
+     * @brief Return a pointer to the underlying contiguous, plssvm::MATRIX_ALIGNMENT aligned memory (including padding).
+     * @return the data pointer (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const value_type *data() const noexcept { return data_.data(); }
+    /**
+     * @copydoc data() const
+     */
+    [[nodiscard]] value_type *data() noexcept { return data_.data(); }
+
+    /**
+     * @brief Return a pointer to the first feature of the data point @p row. Only available for plssvm::layout_type::aos matrices.
+     * @param[in] row the row index
+     * @return the pointer to the row (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const value_type *row_data(const size_type row) const noexcept {
+        static_assert(layout == layout_type::aos, "Contiguous row access is only possible using the AoS layout!");
+        PLSSVM_ASSERT(row < num_rows_padded(), "Out-of-bounce access!: {} >= {}", row, num_rows_padded());
+        return data_.data() + row * num_cols_padded();
+    }
+    /**
+     * @copydoc row_data(size_type) const
+     */
+    [[nodiscard]] value_type *row_data(const size_type row) noexcept {
+        static_assert(layout == layout_type::aos, "Contiguous row access is only possible using the AoS layout!");
+        PLSSVM_ASSERT(row < num_rows_padded(), "Out-of-bounce access!: {} >= {}", row, num_rows_padded());
+        return data_.data() + row * num_cols_padded();
+    }
+
+    /**
+     * @brief Return a copy of the data point @p row without padding.
+     * @param[in] row the row index
+     * @return the data point (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<value_type> row(const size_type row) const {
+        PLSSVM_ASSERT(row < num_rows_, "Out-of-bounce access!: {} >= {}", row, num_rows_);
+        std::vector<value_type> point(num_cols_);
+        for (size_type col = 0; col < num_cols_; ++col) {
+            point[col] = (*this)(row, col);
+        }
+        return point;
+    }
+    /**
+     * @brief Convert the matrix to a 2D vector where each inner vector represents one data point (padding excluded).
+     * @return the 2D vector (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<value_type>> to_2D_vector() const {
+        std::vector<std::vector<value_type>> ret(num_rows_);
+        #pragma omp parallel for if (num_rows_ * num_cols_ > 10000)
+        for (size_type row = 0; row < num_rows_; ++row) {
+            ret[row] = this->row(row);
+        }
+        return ret;
+    }
+
+  private:
+    /// The number of rows without padding.
+    size_type num_rows_{ 0 };
+    /// The number of columns without padding.
+    size_type num_cols_{ 0 };
+    /// The number of padding rows.
+    size_type row_padding_{ 0 };
+    /// The number of padding columns.
+    size_type col_padding_{ 0 };
+    /// The contiguous, aligned matrix entries including padding.
+    std::vector<value_type, detail::aligned_allocator<value_type, static_cast<std::size_t>(MATRIX_ALIGNMENT)>> data_{};
+};
+
+/// Type alias for a matrix using the Array-of-Structs layout.
+template <typename T>
+using aos_matrix = matrix<T, layout_type::aos>;
+/// Type alias for a matrix using the Struct-of-Arrays layout.
+template <typename T>
+using soa_matrix = matrix<T, layout_type::soa>;
+
+}  // namespace plssvm
@@ -11,10 +11,14 @@
 
 #pragma once
 
-#include "plssvm/backend_types.hpp"     // plssvm::backend_type
-#include "plssvm/kernel_types.hpp"      // plssvm::kernel_type
-#include "plssvm/target_platforms.hpp"  // plssvm::target_platform
+#include "plssvm/backend_types.hpp"         // plssvm::backend_type
+#include "plssvm/kernel_types.hpp"          // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                // plssvm::aos_matrix
+#include "plssvm/preconditioner_types.hpp"  // plssvm::preconditioner_type
+#include "plssvm/solver_types.hpp"          // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"      // plssvm::target_platform
 
+#include <cstddef>      // std::size_t
 #include <iosfwd>       // forward declare std::ostream
 #include <memory>       // std::shared_ptr
 #include <string>       // std::string
@@ -58,9 +62,9 @@ class parameter {
      * -1 2:0.298499933047586044 # this is also a comment
      * @endcode
      *
-     * Be aware that the parsed output is **always** in a dense format. The above file for example will be parsed to a
+     * Be aware that the parsed output is **always** in a dense format. The above file for example will be parsed to a padded plssvm::aos_matrix containing
      * @code
-     * std::vector<std::vector<real_type>> data = {
+     * {
      *   { 1.29801019287324655, 0.51687296029754564, 0.0 },
      *   { 1.01405596624706053, 0.0, 0.0 },
      *   { 0.60276937379453293, 0.0, -0.13086851759108944 },
@@ -74,7 +78,7 @@ class parameter {
      * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
      * @throws plssvm::invalid_file_format_exception if the @p filename has an invalid format (e.g. an empty file, a file not using the LIBSVM file format, ...)
      */
-    void parse_libsvm_file(const std::string &filename, std::shared_ptr<const std::vector<std::vector<real_type>>> &data_ptr_ref);
+    void parse_libsvm_file(const std::string &filename, std::shared_ptr<const aos_matrix<real_type>> &data_ptr_ref);
     /**
      * @brief Parse a file in the [arff file format](https://www.cs.waikato.ac.nz/ml/weka/arff.html).
      * @details The arff file format saves each data point with its respective class as follows:
@@ -106,9 +110,9 @@ class parameter {
      * @endcode
      * The necessary arff header values must be present and the type of the `@ATTRIBUTE` tags must be `NUMERIC`.
      *
-     * Be aware that the parsed output is **always** in a dense format. The above file for example will be parsed to a
+     * Be aware that the parsed output is **always** in a dense format. The above file for example will be parsed to a padded plssvm::aos_matrix containing
      * @code
-     * std::vector<std::vector<real_type>> data = {
+     * {
      *   { -1.117827500607882, -2.9087188881250993, 0.66638344270039144, 1.0978832703949288 },
      *   { -0.5282118298909262, -0.335880984968183973, 0.51687296029754564, 0.54604461446026 },
      *   { 0.0, 0.60276937379453293, -0.13086851759108944, 0.0 },
@@ -122,7 +126,7 @@ class parameter {
      * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
      * @throws plssvm::invalid_file_format_exception if the @p filename has an invalid format (e.g. an empty file, invalid arff header, ...)
      */
-    void parse_arff_file(const std::string &filename, std::shared_ptr<const std::vector<std::vector<real_type>>> &data_ptr_ref);
+    void parse_arff_file(const std::string &filename, std::shared_ptr<const aos_matrix<real_type>> &data_ptr_ref);
     /**
      * @brief Parse a model file in the [LIBSVM model file format](https://www.csie.ntu.edu.tw/~cjlin/libsvm/faq.html#f402).
      * @details An example LIBSVM file could look as follows:
@@ -141,6 +145,12 @@ class parameter {
      * 0.0034556484621847128 0:1.884940e+00 1:1.005186e+00 2:2.984999e-01 3:1.646463e+00
      * -0.23146573996578407 0:5.765022e-01 1:1.014056e+00 2:1.300943e-01 3:7.261914e-01
      * @endcode
+     * A one-vs-all multi-class model with `nr_class` > 2 must contain the entry `multiclass one_vs_all` (e.g., the one-vs-one models of LIBSVM are rejected). It contains one rho value, label,
+     * and number of support vectors per class and each support vector is preceded by one weight per class.
+     * In this case, #class_alpha_ptr, #classes, and #class_rho are set instead of #alpha_ptr, #value_ptr, and #rho. Note that `nr_class` must precede `multiclass`, `rho`, `label`, and `nr_sv`.
+     * A model learned using random Fourier features (see plssvm::csvm::learn_random_features()) contains `random_features`, `random_seed`, and `num_features` instead of `total_sv` and `nr_sv`
+     * and the weights of the random features, one per line, after `W` instead of the support vectors. In this case, #data_ptr contains the random frequencies regenerated using the seed,
+     * #alpha_ptr the weights of the random features, and #num_random_features and #random_seed are set.
      * @param[in] filename the model file to parse
      * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
      * @throws plssvm::invalid_file_format_exception if the @p filename has an invalid format (e.g. an empty file, invalid LIBSVM model file header, ...)
@@ -153,7 +163,7 @@ class parameter {
      * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
      * @throws plssvm::invalid_file_format_exception if the @p filename has an invalid format (e.g. an empty file, ...)
      */
-    void parse_file(const std::string &filename, std::shared_ptr<const std::vector<std::vector<real_type>>> &data_ptr_ref);
+    void parse_file(const std::string &filename, std::shared_ptr<const aos_matrix<real_type>> &data_ptr_ref);
 
     /**
      * @brief Parse the given file as training data. If the file is in the arff format (has the `.arff` extension), the arff parser is used, otherwise the LIBSVM parser is used.
@@ -190,6 +200,38 @@ class parameter {
     backend_type backend = backend_type::openmp;
     /// The target platform: automatic (depending on the used backend), CPUs or GPUs from NVIDIA, AMD or Intel.
     target_platform target = target_platform::automatic;
+    /// The size of the tiles the kernel matrix is split into in the OpenMP backend.
+    std::size_t openmp_tile_size = 64;
+    /// The CG solver variant: automatic (depending on the memory budget), an explicitly assembled kernel matrix, or an implicit on-the-fly kernel matrix.
+    solver_type solver = solver_type::automatic;
+    /// The memory budget (in MiB) for the explicitly assembled kernel matrix. If `0`, half of the available physical memory is used.
+    std::size_t memory_budget = 0;
+    /// The memory (in MiB) used to cache kernel matrix tiles if the kernel matrix is recomputed in every CG iteration in the OpenMP backend. If `0`, no cache is used.
+    std::size_t cache_size = 0;
+    /// The relative residual norm reduction after which the recursively updated residual in the CG algorithm is replaced by the true residual. If `0`, only #replace_interval is used.
+    real_type replace_threshold = static_cast<real_type>(0.01);
+    /// The maximum number of CG iterations between two replacements of the recursively updated residual by the true residual. If `0`, only #replace_threshold is used.
+    std::size_t replace_interval = 50;
+    /// The preconditioner used in the CG algorithm: none, Jacobi, block-Jacobi, or pivoted Cholesky.
+    preconditioner_type preconditioner = preconditioner_type::none;
+    /// The block size of the block-Jacobi preconditioner or the maximum rank of the pivoted Cholesky preconditioner.
+    std::size_t precond_size = 64;
+    /// If `true` and #real_type is `double`, the kernel matrix-vector products in the CG algorithm are calculated in single precision and the solution is iteratively refined in double precision.
+    bool mixed_precision = false;
+    /// If `true`, the CPU implementations of the rbf kernel function use plssvm::detail::fast_exp instead of `std::exp`. Ignored by the GPU backends.
+    bool fast_math_kernels = false;
+    /// If `true`, the primal problem is solved in the exact feature space of a low-degree polynomial kernel function if it is estimated to be cheaper than the dual problem and predicting uses its weights.
+    bool feature_map = true;
+    /// The cost parameters for which models are learned using a single multi-shift CG solve instead of a single model for #cost. Only used in the `svm-train` executable.
+    std::vector<real_type> cost_path{};
+    /// The number of folds of the cross-validation. If `0`, no cross-validation is performed. Only used in the `svm-train` and `svm-grid` executables.
+    std::size_t num_folds = 0;
+    /// The number of random probing vectors used to estimate the leave-one-out error while learning the model. If `0`, no leave-one-out error is estimated. Only used in the `svm-train` executable.
+    std::size_t loo_probes = 0;
+    /// The number of random Fourier features approximating the rbf kernel function. If `0`, the kernel function is evaluated exactly. Only used in the `svm-train` executable or parsed from a random features model file.
+    std::size_t num_random_features = 0;
+    /// The seed of the random number generator generating the random Fourier features, the probing vectors of the leave-one-out estimate, and the landmarks of the Nyström approximation.
+    unsigned long long random_seed = 42;
 
     /// The name of the data/test file to parse.
     std::string input_filename{};
@@ -199,16 +241,24 @@ class parameter {
     std::string predict_filename{};
 
     /// The data used the train the SVM.
-    std::shared_ptr<const std::vector<std::vector<real_type>>> data_ptr{};
+    std::shared_ptr<const aos_matrix<real_type>> data_ptr{};
     /// The labels associated with each data point.
     std::shared_ptr<const std::vector<real_type>> value_ptr{};
+    /// The original labels associated with each data point, e.g., the classes of a multi-class data set. #value_ptr contains the signs of these labels.
+    std::shared_ptr<const std::vector<real_type>> label_ptr{};
     /// The weights associated with each data point after training.
     std::shared_ptr<const std::vector<real_type>> alpha_ptr{};
+    /// The weights associated with each data point for each class of a one-vs-all multi-class model.
+    std::shared_ptr<const std::vector<std::vector<real_type>>> class_alpha_ptr{};
     /// The test data to predict.
-    std::shared_ptr<const std::vector<std::vector<real_type>>> test_data_ptr{};
+    std::shared_ptr<const aos_matrix<real_type>> test_data_ptr{};
 
     /// The rho value of the calculated/read model.
     real_type rho = real_type{ 0.0 };
+    /// The classes of the read one-vs-all multi-class model. Empty for a binary model.
+    std::vector<real_type> classes{};
+    /// The rho values of the read one-vs-all multi-class model, one for each class in #classes.
+    std::vector<real_type> class_rho{};
 
   protected:
     /**
@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a class encapsulating all necessary parameters for compressing a learned model possibly provided through command line arguments.
+ */
+
+#pragma once
+
+#include "plssvm/landmark_selection_types.hpp"  // plssvm::landmark_selection_type
+#include "plssvm/parameter.hpp"                 // plssvm::parameter
+
+#include <cstddef>  // std::size_t
+#include <string>   // std::string
+
+namespace plssvm {
+
+/**
+ * @brief Class for encapsulating all necessary parameters for compressing a learned model possibly provided through command line arguments.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class parameter_compress : public parameter<T> {
+  public:
+    /// The template base type of the parameter_compress class.
+    using base_type = parameter<T>;
+
+    using base_type::backend;
+    using base_type::cost;
+    using base_type::gamma;
+    using base_type::kernel;
+    using base_type::print_info;
+    using base_type::random_seed;
+    using base_type::target;
+
+    using base_type::input_filename;
+    using base_type::model_filename;
+
+    using base_type::alpha_ptr;
+    using base_type::data_ptr;
+    using base_type::label_ptr;
+    using base_type::test_data_ptr;
+    using base_type::value_ptr;
+
+    using base_type::rho;
+
+    /**
+     * @brief Parse the command line arguments @p argv using [`cxxopts`](https://github.com/jarro2783/cxxopts) and set the compression parameters accordingly. Parse the given model and validation file.
+     * @param[in] argc the number of passed command line arguments
+     * @param[in] argv the command line arguments
+     */
+    parameter_compress(int argc, char **argv);
+
+    /// The number of random Fourier features the model is compressed into. If `0`, the model is compressed using the Nyström approximation.
+    std::size_t num_fourier_features = 0;
+    /// The number of landmarks of the Nyström approximation. If `0`, the model is compressed using random Fourier features.
+    std::size_t num_landmarks = 0;
+    /// The strategy selecting the landmarks of the Nyström approximation.
+    landmark_selection_type landmark_selection = landmark_selection_type::kmeans_pp;
+    /// The name of the file the compressed model is written to (default: `${model_filename}.compressed`).
+    std::string compressed_filename{};
+};
+
+extern template class parameter_compress<float>;
+extern template class parameter_compress<double>;
+
+}  // namespace plssvm
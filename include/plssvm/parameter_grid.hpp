@@ -0,0 +1,77 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a class encapsulating all necessary parameters for a hyperparameter grid search possibly provided through command line arguments.
+ */
+
+#pragma once
+
+#include "plssvm/parameter.hpp"  // plssvm::parameter
+
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief Class for encapsulating all necessary parameters for a hyperparameter grid search possibly provided through command line arguments.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class parameter_grid : public parameter<T> {
+  public:
+    /// The template base type of the parameter_grid class.
+    using base_type = parameter<T>;
+    /// The type of the data. Must be either `float` or `double`.
+    using typename base_type::real_type;
+
+    using base_type::coef0;
+    using base_type::cost;
+    using base_type::degree;
+    using base_type::epsilon;
+    using base_type::fast_math_kernels;
+    using base_type::gamma;
+    using base_type::kernel;
+    using base_type::num_folds;
+    using base_type::precond_size;
+    using base_type::preconditioner;
+    using base_type::print_info;
+    using base_type::replace_interval;
+    using base_type::replace_threshold;
+
+    using base_type::input_filename;
+
+    using base_type::data_ptr;
+    using base_type::label_ptr;
+    using base_type::value_ptr;
+
+    /**
+     * @brief Parse the command line arguments @p argv using [`cxxopts`](https://github.com/jarro2783/cxxopts) and set the grid search parameters accordingly. Parse the given data file.
+     * @param[in] argc the number of passed command line arguments
+     * @param[in] argv the command line arguments
+     */
+    parameter_grid(int argc, char **argv);
+
+    /// The gamma values of the grid (default: `1 / num_features`).
+    std::vector<real_type> gamma_grid{};
+    /// The coef0 values of the grid.
+    std::vector<real_type> coef0_grid{};
+    /// The degree values of the grid.
+    std::vector<int> degree_grid{};
+    /// The cost values of the grid.
+    std::vector<real_type> cost_grid{};
+    /// The name of the file the Gram matrix is cached in. If empty, the Gram matrix isn't cached.
+    std::string gram_cache_filename{};
+    /// The name of the file the accuracies of all grid points are written to. If empty, only the best grid point is reported.
+    std::string result_filename{};
+};
+
+extern template class parameter_grid<float>;
+extern template class parameter_grid<double>;
+
+}  // namespace plssvm
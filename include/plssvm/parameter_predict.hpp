@@ -28,13 +28,27 @@ class parameter_predict : public parameter<T> {
     using base_type = parameter<T>;
 
     using base_type::backend;
+    using base_type::cache_size;
     using base_type::coef0;
     using base_type::cost;
+    using base_type::cost_path;
     using base_type::degree;
     using base_type::epsilon;
+    using base_type::fast_math_kernels;
+    using base_type::feature_map;
     using base_type::gamma;
     using base_type::kernel;
+    using base_type::loo_probes;
+    using base_type::memory_budget;
+    using base_type::mixed_precision;
+    using base_type::num_folds;
+    using base_type::openmp_tile_size;
+    using base_type::precond_size;
+    using base_type::preconditioner;
     using base_type::print_info;
+    using base_type::replace_interval;
+    using base_type::replace_threshold;
+    using base_type::solver;
     using base_type::target;
 
     using base_type::input_filename;
@@ -42,10 +56,14 @@ class parameter_predict : public parameter<T> {
     using base_type::predict_filename;
 
     using base_type::alpha_ptr;
+    using base_type::class_alpha_ptr;
     using base_type::data_ptr;
+    using base_type::label_ptr;
     using base_type::test_data_ptr;
     using base_type::value_ptr;
 
+    using base_type::class_rho;
+    using base_type::classes;
     using base_type::rho;
     /**
      * @brief Default construct all parameters for prediction.
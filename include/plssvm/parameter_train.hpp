@@ -11,9 +11,11 @@
 
 #pragma once
 
-#include "plssvm/parameter.hpp"  // plssvm::parameter
+#include "plssvm/landmark_selection_types.hpp"  // plssvm::landmark_selection_type
+#include "plssvm/parameter.hpp"                 // plssvm::parameter
 
-#include <string>  // std::string
+#include <cstddef>  // std::size_t
+#include <string>   // std::string
 
 namespace plssvm {
 
@@ -28,13 +30,29 @@ class parameter_train : public parameter<T> {
     using base_type = parameter<T>;
 
     using base_type::backend;
+    using base_type::cache_size;
     using base_type::coef0;
     using base_type::cost;
+    using base_type::cost_path;
     using base_type::degree;
     using base_type::epsilon;
+    using base_type::fast_math_kernels;
+    using base_type::feature_map;
     using base_type::gamma;
     using base_type::kernel;
+    using base_type::loo_probes;
+    using base_type::memory_budget;
+    using base_type::mixed_precision;
+    using base_type::num_folds;
+    using base_type::num_random_features;
+    using base_type::random_seed;
+    using base_type::openmp_tile_size;
+    using base_type::precond_size;
+    using base_type::preconditioner;
     using base_type::print_info;
+    using base_type::replace_interval;
+    using base_type::replace_threshold;
+    using base_type::solver;
     using base_type::target;
 
     using base_type::input_filename;
@@ -42,10 +60,14 @@ class parameter_train : public parameter<T> {
     using base_type::predict_filename;
 
     using base_type::alpha_ptr;
+    using base_type::class_alpha_ptr;
     using base_type::data_ptr;
+    using base_type::label_ptr;
     using base_type::test_data_ptr;
     using base_type::value_ptr;
 
+    using base_type::class_rho;
+    using base_type::classes;
     using base_type::rho;
 
     /**
@@ -66,6 +88,13 @@ class parameter_train : public parameter<T> {
      * @param[in] argv the command line arguments
      */
     parameter_train(int argc, char **argv);
+
+    /// The name of the model file whose weights the CG solver starts from. If empty, the CG solver starts from scratch.
+    std::string warm_start_filename{};
+    /// The number of landmarks of the Nyström approximation. If `0`, the exact model is learned.
+    std::size_t num_landmarks = 0;
+    /// The strategy selecting the landmarks of the Nyström approximation.
+    landmark_selection_type landmark_selection = landmark_selection_type::kmeans_pp;
 };
 
 extern template class parameter_train<float>;
@@ -0,0 +1,48 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines all possible preconditioners used in the CG solver.
+ */
+
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all possible preconditioners used in the CG solver.
+ */
+enum class preconditioner_type {
+    /** Use the unpreconditioned CG algorithm. */
+    none,
+    /** Use the inverse of the diagonal of the kernel matrix. */
+    jacobi,
+    /** Use the inverse of the dense diagonal blocks of the kernel matrix computed via their Cholesky decompositions. */
+    block_jacobi,
+    /** Use a low-rank pivoted Cholesky (Nyström) approximation of the kernel matrix plus its regularization diagonal inverted via the Woodbury identity. */
+    pivoted_cholesky
+};
+
+/**
+ * @brief Output the @p preconditioner type to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the preconditioner type to
+ * @param[in] preconditioner the preconditioner type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, preconditioner_type preconditioner);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p preconditioner type.
+ * @param[in,out] in input-stream to extract the preconditioner type from
+ * @param[in] preconditioner the preconditioner type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, preconditioner_type &preconditioner);
+
+}  // namespace plssvm
@@ -0,0 +1,46 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines all possible variants of the CG solver used to solve the system of linear equations.
+ */
+
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all possible CG solver variants.
+ */
+enum class solver_type {
+    /** Use plssvm::solver_type::cg_explicit if the kernel matrix fits into the available memory budget (and is supported by the backend), otherwise plssvm::solver_type::cg_implicit. */
+    automatic,
+    /** Assemble the kernel matrix once before the first CG iteration and reuse it in every iteration. */
+    cg_explicit,
+    /** Recompute the kernel matrix on-the-fly in every CG iteration. */
+    cg_implicit
+};
+
+/**
+ * @brief Output the @p solver type to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the solver type to
+ * @param[in] solver the solver type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, solver_type solver);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p solver type.
+ * @param[in,out] in input-stream to extract the solver type from
+ * @param[in] solver the solver type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, solver_type &solver);
+
+}  // namespace plssvm
@@ -0,0 +1,47 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Main function compiled to the `svm-compress` executable used for compressing a learned model into an explicit feature map.
+ */
+
+#include "plssvm/core.hpp"
+
+#include <exception>  // std::exception
+#include <iostream>   // std::cerr, std::endl
+
+// perform calculations in single precision if requested
+#ifdef PLSSVM_EXECUTABLES_USE_SINGLE_PRECISION
+using real_type = float;
+#else
+using real_type = double;
+#endif
+
+int main(int argc, char *argv[]) {
+    try {
+        // parse compression parameter from command line
+        plssvm::parameter_compress<real_type> params{ argc, argv };
+
+        // create SVM using the learned model
+        auto svm = plssvm::make_csvm(params);
+
+        // compress the model and measure the approximation error on the validation data
+        if (params.num_landmarks != 0) {
+            [[maybe_unused]] const real_type error = svm->compress_nystrom(params.num_landmarks, *params.test_data_ptr, params.landmark_selection);
+        } else {
+            [[maybe_unused]] const real_type error = svm->compress_random_features(params.num_fourier_features, *params.test_data_ptr);
+        }
+
+        // write the compressed model file
+        svm->write_model(params.compressed_filename);
+
+    } catch (const plssvm::exception &e) {
+        std::cerr << e.what_with_loc() << std::endl;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+    }
+    return 0;
+}
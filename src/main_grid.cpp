@@ -0,0 +1,57 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Main function compiled to the `svm-grid` executable used for searching the best hyperparameters of a C-SVM.
+ */
+
+#include "plssvm/core.hpp"
+
+#include "fmt/core.h"  // fmt::print, fmt::format
+
+#include <algorithm>  // std::max_element
+#include <exception>  // std::exception
+#include <fstream>    // std::ofstream
+#include <iostream>   // std::cerr, std::endl
+
+// perform calculations in single precision if requested
+#ifdef PLSSVM_EXECUTABLES_USE_SINGLE_PRECISION
+using real_type = float;
+#else
+using real_type = double;
+#endif
+
+int main(int argc, char *argv[]) {
+    try {
+        // parse grid search parameter from command line
+        plssvm::parameter_grid<real_type> params{ argc, argv };
+
+        // compute (or read) the Gram matrix once
+        const plssvm::grid_search<real_type> search{ params, params.gram_cache_filename };
+
+        // evaluate all grid points
+        const auto grid = search.evaluate(plssvm::grid_search<real_type>::make_grid(params.kernel, params.gamma_grid, params.coef0_grid, params.degree_grid, params.cost_grid), params.num_folds);
+
+        // save the accuracies of all grid points
+        if (!params.result_filename.empty()) {
+            std::ofstream out{ params.result_filename };
+            out << "gamma coef0 degree cost accuracy\n";
+            for (const auto &point : grid) {
+                out << fmt::format("{} {} {} {} {}\n", point.gamma, point.coef0, point.degree, point.cost, point.accuracy);
+            }
+        }
+
+        // report the best grid point
+        const auto best = std::max_element(grid.cbegin(), grid.cend(), [](const auto &lhs, const auto &rhs) { return lhs.accuracy < rhs.accuracy; });
+        fmt::print("Best: gamma = {}, coef0 = {}, degree = {}, cost = {}, cross-validation accuracy = {:.2f}%\n", best->gamma, best->coef0, best->degree, best->cost, best->accuracy * 100);
+
+    } catch (const plssvm::exception &e) {
+        std::cerr << e.what_with_loc() << std::endl;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+    }
+    return 0;
+}
@@ -45,16 +45,16 @@ int main(int argc, char *argv[]) {
         if (params.value_ptr) {
             unsigned long long correct = 0;
             for (typename std::vector<real_type>::size_type i = 0; i < labels.size(); ++i) {
-                // check of prediction was correct
-                if ((*params.value_ptr)[i] * labels[i] > real_type{ 0.0 }) {
+                // check of prediction was correct, a multi-class prediction must match the original label
+                if (params.classes.empty() ? (*params.value_ptr)[i] * labels[i] > real_type{ 0.0 } : (*params.label_ptr)[i] == labels[i]) {
                     ++correct;
                 }
             }
             // print accuracy
             fmt::print("Accuracy = {}% ({}/{}) (classification)\n",
-                       static_cast<real_type>(correct) / static_cast<real_type>(params.test_data_ptr->size()) * real_type{ 100 },
+                       static_cast<real_type>(correct) / static_cast<real_type>(params.test_data_ptr->num_rows()) * real_type{ 100 },
                        correct,
-                       params.test_data_ptr->size());
+                       params.test_data_ptr->num_rows());
         }
 
     } catch (const plssvm::exception &e) {
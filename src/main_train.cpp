@@ -10,8 +10,14 @@
 
 #include "plssvm/core.hpp"
 
+#include "fmt/format.h"  // fmt::format, fmt::print
+
+#include <cstddef>    // std::size_t
 #include <exception>  // std::exception
 #include <iostream>   // std::cerr, std::endl
+#include <numeric>    // std::accumulate
+#include <utility>    // std::move
+#include <vector>     // std::vector
 
 // perform calculations in single precision if requested
 #ifdef PLSSVM_EXECUTABLES_USE_SINGLE_PRECISION
@@ -28,11 +34,61 @@ int main(int argc, char *argv[]) {
         // create SVM
         auto svm = plssvm::make_csvm(params);
 
-        // learn
-        svm->learn();
+        if (params.num_folds != 0) {
+            // cross-validate instead of learning a model
+            const std::vector<real_type> accuracies = svm->cross_validate(params.num_folds);
+
+            // print achieved mean accuracy
+            fmt::print("Cross Validation Accuracy = {}% (mean of {} folds)\n", std::accumulate(accuracies.cbegin(), accuracies.cend(), real_type{ 0.0 }) / static_cast<real_type>(accuracies.size()) * real_type{ 100 }, accuracies.size());
+        } else if (params.loo_probes != 0) {
+            // learn and estimate the leave-one-out error at once
+            const real_type error = svm->loo_error(params.loo_probes);
+
+            // print estimated leave-one-out accuracy
+            fmt::print("Leave-One-Out Accuracy = {}% (estimated using {} probing vectors)\n", (1 - error) * real_type{ 100 }, params.loo_probes);
+
+            // save model file
+            svm->write_model(params.model_filename);
+        } else if (!params.warm_start_filename.empty()) {
+            // learn starting from the weights of a previous model
+            plssvm::parameter<real_type> warm_start_params;
+            warm_start_params.print_info = params.print_info;
+            warm_start_params.parse_model_file(params.warm_start_filename);
+            if (warm_start_params.alpha_ptr == nullptr) {
+                throw plssvm::exception{ fmt::format("The warm start model file '{}' must contain a binary model!", params.warm_start_filename) };
+            }
+            svm->learn(*warm_start_params.data_ptr, *warm_start_params.alpha_ptr);
+
+            // save model file
+            svm->write_model(params.model_filename);
+        } else if (params.num_landmarks != 0) {
+            // learn an approximate model using only the landmarks as support vectors
+            svm->learn_nystrom(params.num_landmarks, params.landmark_selection);
+
+            // save model file
+            svm->write_model(params.model_filename);
+        } else if (params.num_random_features != 0) {
+            // learn an approximate model in the space of the random Fourier features
+            svm->learn_random_features(params.num_random_features);
+
+            // save model file
+            svm->write_model(params.model_filename);
+        } else if (params.cost_path.empty()) {
+            // learn
+            svm->learn();
+
+            // save model file
+            svm->write_model(params.model_filename);
+        } else {
+            // learn the models for all costs at once
+            auto models = svm->learn_cost_path(params.cost_path);
 
-        // save model file
-        svm->write_model(params.model_filename);
+            // save one model file per cost
+            for (std::size_t i = 0; i < models.size(); ++i) {
+                svm->set_model(params.cost_path[i], std::move(models[i].first), models[i].second);
+                svm->write_model(fmt::format("{}.{}", params.model_filename, params.cost_path[i]));
+            }
+        }
 
     } catch (const plssvm::exception &e) {
         std::cerr << e.what_with_loc() << std::endl;
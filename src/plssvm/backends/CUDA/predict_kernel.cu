@@ -8,8 +8,9 @@
 
 #include "plssvm/backends/CUDA/predict_kernel.cuh"
 
-#include "plssvm/backends/CUDA/detail/atomics.cuh"  // atomicAdd for double precision floating point numbers on older CUDA hardware
-#include "plssvm/constants.hpp"                     // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/backends/CUDA/detail/atomics.cuh"      // atomicAdd for double precision floating point numbers on older CUDA hardware
+#include "plssvm/backends/CUDA/detail/integer_pow.cuh"  // plssvm::cuda::detail::integer_pow
+#include "plssvm/constants.hpp"                         // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 
 namespace plssvm::cuda {
 
@@ -28,7 +29,7 @@ __global__ void device_kernel_w_linear(real_type *w_d, const real_type *data_d,
 template __global__ void device_kernel_w_linear(float *, const float *, const float *, const float *, const kernel_index_type, const kernel_index_type);
 template __global__ void device_kernel_w_linear(double *, const double *, const double *, const double *, const kernel_index_type, const kernel_index_type);
 
-template <typename real_type>
+template <int unrolled_degree, typename real_type>
 __global__ void device_kernel_predict_poly(real_type *out_d, const real_type *data_d, const real_type *data_last_d, const real_type *alpha_d, const kernel_index_type num_data_points, const real_type *points, const kernel_index_type num_predict_points, const kernel_index_type num_features, const int degree, const real_type gamma, const real_type coef0) {
     const kernel_index_type data_point_index = blockIdx.x * blockDim.x + threadIdx.x;
     const kernel_index_type predict_point_index = blockIdx.y * blockDim.y + threadIdx.y;
@@ -43,14 +44,24 @@ __global__ void device_kernel_predict_poly(real_type *out_d, const real_type *da
             }
         }
 
-        temp = alpha_d[data_point_index] * pow(gamma * temp + coef0, degree);
+        temp = alpha_d[data_point_index] * detail::integer_pow<unrolled_degree>(gamma * temp + coef0, degree);
 
         atomicAdd(&out_d[predict_point_index], temp);
     }
 }
 
-template __global__ void device_kernel_predict_poly(float *, const float *, const float *, const float *, const kernel_index_type, const float *, const kernel_index_type, const kernel_index_type, const int, const float, const float);
-template __global__ void device_kernel_predict_poly(double *, const double *, const double *, const double *, const kernel_index_type, const double *, const kernel_index_type, const kernel_index_type, const int, const double, const double);
+/// Explicitly instantiate device_kernel_predict_poly for the runtime degree and all degrees unrolled at compile-time.
+#define PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(degree) \
+    template __global__ void device_kernel_predict_poly<degree>(float *, const float *, const float *, const float *, const kernel_index_type, const float *, const kernel_index_type, const kernel_index_type, const int, const float, const float); \
+    template __global__ void device_kernel_predict_poly<degree>(double *, const double *, const double *, const double *, const kernel_index_type, const double *, const kernel_index_type, const kernel_index_type, const int, const double, const double);
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(0)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(1)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(2)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(3)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(4)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(5)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY(6)
+#undef PLSSVM_INSTANTIATE_DEVICE_KERNEL_PREDICT_POLY
 
 template <typename real_type>
 __global__ void device_kernel_predict_radial(real_type *out_d, const real_type *data_d, const real_type *data_last_d, const real_type *alpha_d, const kernel_index_type num_data_points, const real_type *points, const kernel_index_type num_predict_points, const kernel_index_type num_features, const real_type gamma) {
@@ -8,7 +8,8 @@
 
 #include "plssvm/backends/CUDA/q_kernel.cuh"
 
-#include "plssvm/constants.hpp"  // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/backends/CUDA/detail/integer_pow.cuh"  // plssvm::cuda::detail::integer_pow
+#include "plssvm/constants.hpp"                         // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 
 namespace plssvm::cuda {
 
@@ -24,17 +25,27 @@ __global__ void device_kernel_q_linear(real_type *q, const real_type *data_d, co
 template __global__ void device_kernel_q_linear(float *, const float *, const float *, const kernel_index_type, const kernel_index_type);
 template __global__ void device_kernel_q_linear(double *, const double *, const double *, const kernel_index_type, const kernel_index_type);
 
-template <typename real_type>
+template <int unrolled_degree, typename real_type>
 __global__ void device_kernel_q_poly(real_type *q, const real_type *data_d, const real_type *data_last, const kernel_index_type num_rows, const kernel_index_type num_cols, const int degree, const real_type gamma, const real_type coef0) {
     const kernel_index_type index = blockIdx.x * blockDim.x + threadIdx.x;
     real_type temp{ 0.0 };
     for (kernel_index_type i = 0; i < num_cols; ++i) {
         temp += data_d[i * num_rows + index] * data_last[i];
     }
-    q[index] = pow(gamma * temp + coef0, degree);
+    q[index] = detail::integer_pow<unrolled_degree>(gamma * temp + coef0, degree);
 }
-template __global__ void device_kernel_q_poly(float *, const float *, const float *, const kernel_index_type, const kernel_index_type, const int, const float, const float);
-template __global__ void device_kernel_q_poly(double *, const double *, const double *, const kernel_index_type, const kernel_index_type, const int, const double, const double);
+/// Explicitly instantiate device_kernel_q_poly for the runtime degree and all degrees unrolled at compile-time.
+#define PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(degree) \
+    template __global__ void device_kernel_q_poly<degree>(float *, const float *, const float *, const kernel_index_type, const kernel_index_type, const int, const float, const float); \
+    template __global__ void device_kernel_q_poly<degree>(double *, const double *, const double *, const kernel_index_type, const kernel_index_type, const int, const double, const double);
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(0)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(1)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(2)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(3)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(4)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(5)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY(6)
+#undef PLSSVM_INSTANTIATE_DEVICE_KERNEL_Q_POLY
 
 template <typename real_type>
 __global__ void device_kernel_q_radial(real_type *q, const real_type *data_d, const real_type *data_last, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type gamma) {
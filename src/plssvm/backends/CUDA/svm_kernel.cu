@@ -8,8 +8,9 @@
 
 #include "plssvm/backends/CUDA/svm_kernel.cuh"
 
-#include "plssvm/backends/CUDA/detail/atomics.cuh"  // atomicAdd for double precision floating point numbers on older CUDA hardware
-#include "plssvm/constants.hpp"                     // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/backends/CUDA/detail/atomics.cuh"      // atomicAdd for double precision floating point numbers on older CUDA hardware
+#include "plssvm/backends/CUDA/detail/integer_pow.cuh"  // plssvm::cuda::detail::integer_pow
+#include "plssvm/constants.hpp"                         // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 
 namespace plssvm::cuda {
 
@@ -90,7 +91,7 @@ __global__ void device_kernel_linear(const real_type *q, real_type *ret, const r
 template __global__ void device_kernel_linear(const float *, float *, const float *, const float *, const float, const float, const kernel_index_type, const kernel_index_type, const float, const kernel_index_type);
 template __global__ void device_kernel_linear(const double *, double *, const double *, const double *, const double, const double, const kernel_index_type, const kernel_index_type, const double, const kernel_index_type);
 
-template <typename real_type>
+template <int unrolled_degree, typename real_type>
 __global__ void device_kernel_poly(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0) {
     kernel_index_type i = blockIdx.x * blockDim.x * INTERNAL_BLOCK_SIZE;
     kernel_index_type j = blockIdx.y * blockDim.y * INTERNAL_BLOCK_SIZE;
@@ -139,7 +140,7 @@ __global__ void device_kernel_poly(const real_type *q, real_type *ret, const rea
             real_type ret_jx = 0.0;
             #pragma unroll INTERNAL_BLOCK_SIZE
             for (kernel_index_type y = 0; y < INTERNAL_BLOCK_SIZE; ++y) {
-                const real_type temp = (pow(gamma * matr[x][y] + coef0, degree) + QA_cost - q[i + y] - q[j + x]) * add;
+                const real_type temp = (detail::integer_pow<unrolled_degree>(gamma * matr[x][y] + coef0, degree) + QA_cost - q[i + y] - q[j + x]) * add;
                 if (i + x > j + y) {
                     // upper triangular matrix
                     atomicAdd(&ret[i + y], temp * d[j + x]);
@@ -154,8 +155,18 @@ __global__ void device_kernel_poly(const real_type *q, real_type *ret, const rea
     }
 }
 
-template __global__ void device_kernel_poly(const float *, float *, const float *, const float *, const float, const float, const kernel_index_type, const kernel_index_type, const float, const int, const float, const float);
-template __global__ void device_kernel_poly(const double *, double *, const double *, const double *, const double, const double, const kernel_index_type, const kernel_index_type, const double, const int, const double, const double);
+/// Explicitly instantiate device_kernel_poly for the runtime degree and all degrees unrolled at compile-time.
+#define PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(degree) \
+    template __global__ void device_kernel_poly<degree>(const float *, float *, const float *, const float *, const float, const float, const kernel_index_type, const kernel_index_type, const float, const int, const float, const float); \
+    template __global__ void device_kernel_poly<degree>(const double *, double *, const double *, const double *, const double, const double, const kernel_index_type, const kernel_index_type, const double, const int, const double, const double);
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(0)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(1)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(2)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(3)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(4)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(5)
+PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY(6)
+#undef PLSSVM_INSTANTIATE_DEVICE_KERNEL_POLY
 
 template <typename real_type>
 __global__ void device_kernel_radial(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma) {
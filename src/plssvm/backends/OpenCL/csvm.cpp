@@ -16,6 +16,7 @@
 #include "plssvm/constants.hpp"                             // plssvm::kernel_index_type
 #include "plssvm/detail/assert.hpp"                         // PLSSVM_ASSERT
 #include "plssvm/detail/execution_range.hpp"                // plssvm::detail::execution_range
+#include "plssvm/detail/integer_pow.hpp"                    // plssvm::detail::max_unrolled_degree
 #include "plssvm/exceptions/exceptions.hpp"                 // plssvm::exception
 #include "plssvm/kernel_types.hpp"                          // plssvm::kernel_type
 #include "plssvm/parameter.hpp"                             // plssvm::parameter
@@ -93,17 +94,22 @@ csvm<T>::csvm(const parameter<T> &params) :
 
     // get kernel names
     std::pair<std::string, std::string> kernel_names = detail::kernel_type_to_function_name(kernel_);
+    // bake the degree of the polynomial kernel function into the kernels such that its power is unrolled into multiplications
+    std::string build_options;
+    if (kernel_ == kernel_type::polynomial && degree_ >= 1 && degree_ <= ::plssvm::detail::max_unrolled_degree) {
+        build_options = fmt::format("-DPLSSVM_POLYNOMIAL_DEGREE={}", degree_);
+    }
     // build necessary kernel
-    q_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "q_kernel.cl", kernel_names.first);
+    q_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "q_kernel.cl", kernel_names.first, build_options);
     // assemble kernel name
-    svm_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "svm_kernel.cl", kernel_names.second);
+    svm_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "svm_kernel.cl", kernel_names.second, build_options);
 
     switch (kernel_) {
         case kernel_type::linear:
             kernel_w_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "predict_kernel.cl", "device_kernel_w_linear");
             break;
         case kernel_type::polynomial:
-            predict_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "predict_kernel.cl", "device_kernel_predict_poly");
+            predict_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "predict_kernel.cl", "device_kernel_predict_poly", build_options);
             break;
         case kernel_type::rbf:
             predict_kernel_ = detail::create_kernel<real_type>(devices_, PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "predict_kernel.cl", "device_kernel_predict_radial");
@@ -169,7 +169,7 @@ std::pair<std::string, std::string> kernel_type_to_function_name(const kernel_ty
 }
 
 template <typename real_type>
-std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, const std::string &file, const std::string &kernel_name) {
+std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, const std::string &file, const std::string &kernel_name, const std::string &build_options) {
     std::string kernel_src_string;
 
     // append kernel file to kernel string
@@ -194,6 +194,8 @@ std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, cons
 
     // read atomic
     append_to_kernel_src_string(PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "detail/atomics.cl");
+    // read integer power
+    append_to_kernel_src_string(PLSSVM_OPENCL_BACKEND_KERNEL_FILE_DIRECTORY "detail/integer_pow.cl");
     // read kernel
     append_to_kernel_src_string(file);
 
@@ -210,7 +212,8 @@ std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, cons
     const char *kernel_src_ptr = kernel_src_string.c_str();
     // TODO: not all command queue must have the same context (but this would be highly unlikely)
     cl_program program = clCreateProgramWithSource(queues[0].context, 1, &kernel_src_ptr, nullptr, &err);
-    err = clBuildProgram(program, 0, nullptr, "-cl-fast-relaxed-math -cl-mad-enable", nullptr, nullptr);
+    const std::string options = fmt::format("-cl-fast-relaxed-math -cl-mad-enable {}", build_options);
+    err = clBuildProgram(program, 0, nullptr, options.c_str(), nullptr, nullptr);
     if (!err) {
         // determine the size of the log
         std::size_t log_size;
@@ -239,7 +242,7 @@ std::vector<kernel> create_kernel(const std::vector<command_queue> &queues, cons
     return kernels;
 }
 
-template std::vector<kernel> create_kernel<float>(const std::vector<command_queue> &, const std::string &, const std::string &);
-template std::vector<kernel> create_kernel<double>(const std::vector<command_queue> &, const std::string &, const std::string &);
+template std::vector<kernel> create_kernel<float>(const std::vector<command_queue> &, const std::string &, const std::string &, const std::string &);
+template std::vector<kernel> create_kernel<double>(const std::vector<command_queue> &, const std::string &, const std::string &, const std::string &);
 
 }  // namespace plssvm::opencl::detail
\ No newline at end of file
@@ -8,28 +8,38 @@
 
 #include "plssvm/backends/OpenMP/csvm.hpp"
 
-#include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
-#include "plssvm/backends/OpenMP/q_kernel.hpp"    // plssvm::openmp::device_kernel_q_linear, plssvm::openmp::device_kernel_q_poly, plssvm::openmp::device_kernel_q_radial
-#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::device_kernel_linear, plssvm::openmp::device_kernel_poly, plssvm::openmp::device_kernel_radial
-#include "plssvm/csvm.hpp"                        // plssvm::csvm
-#include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
-#include "plssvm/detail/operators.hpp"            // various operator overloads for std::vector and scalars
-#include "plssvm/exceptions/exceptions.hpp"       // plssvm::unsupported_kernel_type_exception
-#include "plssvm/kernel_types.hpp"                // plssvm::kernel_type
-#include "plssvm/parameter.hpp"                   // plssvm::parameter
-#include "plssvm/target_platforms.hpp"            // plssvm::target_platform
-
+#include "plssvm/backends/OpenMP/detail/simd.hpp"  // plssvm::openmp::detail::simd::instruction_set
+#include "plssvm/backends/OpenMP/exceptions.hpp"   // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/q_kernel.hpp"     // plssvm::openmp::device_kernel_q_linear, plssvm::openmp::device_kernel_q_poly, plssvm::openmp::device_kernel_q_radial
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"   // plssvm::openmp::accumulation_strategy, plssvm::openmp::device_kernel_linear, plssvm::openmp::device_kernel_poly, plssvm::openmp::device_kernel_radial, plssvm::openmp::device_kernel_predict_radial, ...
+#include "plssvm/backends/OpenMP/tile_cache.hpp"   // plssvm::openmp::tile_cache
+#include "plssvm/csvm.hpp"                         // plssvm::csvm
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/blas.hpp"                  // plssvm::detail::blas::{is_enabled_for, gemv_n, gemv_t}
+#include "plssvm/detail/operators.hpp"             // various operator overloads for std::vector and scalars
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::unsupported_kernel_type_exception
+#include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix, plssvm::simd_padding
+#include "plssvm/parameter.hpp"                    // plssvm::parameter
+#include "plssvm/solver_types.hpp"                 // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"             // plssvm::target_platform
+
+#include "fmt/chrono.h"   // format std::chrono
 #include "fmt/core.h"     // fmt::print, fmt::format
 #include "fmt/ostream.h"  // can use fmt using operator<< overloads
 
-#include <algorithm>  // std::fill, std::all_of
-#include <vector>     // std::vector
+#include <algorithm>    // std::all_of, std::copy, std::fill
+#include <chrono>       // std::chrono::steady_clock, std::chrono::duration_cast, std::chrono::milliseconds
+#include <cstddef>      // std::size_t
+#include <memory>       // std::make_unique, std::unique_ptr
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
 
 namespace plssvm::openmp {
 
 template <typename T>
 csvm<T>::csvm(const parameter<T> &params) :
-    ::plssvm::csvm<T>{ params } {
+    ::plssvm::csvm<T>{ params }, tile_size_{ params.openmp_tile_size }, cache_size_{ params.cache_size } {
     // check if supported target platform has been selected
     if (target_ != target_platform::automatic && target_ != target_platform::cpu) {
         throw backend_exception{ fmt::format("Invalid target platform '{}' for the OpenMP backend!", target_) };
@@ -38,15 +48,19 @@ csvm<T>::csvm(const parameter<T> &params) :
         throw backend_exception{ fmt::format("Requested target platform {} that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!", target_) };
 #endif
     }
+    // check if a valid tile size has been provided
+    if (tile_size_ == 0) {
+        throw backend_exception{ "The OpenMP tile size must be greater than 0!" };
+    }
 
     if (print_info_) {
-        fmt::print("Using OpenMP as backend.\n\n");
+        fmt::print("Using OpenMP as backend ({} kernels).\n\n", detail::simd::instruction_set);
     }
 }
 
 template <typename T>
 auto csvm<T>::generate_q() -> std::vector<real_type> {
-    std::vector<real_type> q(data_ptr_->size() - 1);
+    std::vector<real_type> q(num_data_points_ - 1);
     switch (kernel_) {
         case kernel_type::linear:
             device_kernel_q_linear(q, *data_ptr_);
@@ -55,85 +69,237 @@ auto csvm<T>::generate_q() -> std::vector<real_type> {
             device_kernel_q_poly(q, *data_ptr_, degree_, gamma_, coef0_);
             break;
         case kernel_type::rbf:
-            device_kernel_q_radial(q, *data_ptr_, gamma_);
+            device_kernel_q_radial(q, *data_ptr_, gamma_, fast_math_kernels_);
             break;
     }
     return q;
 }
 
 template <typename T>
-void csvm<T>::run_device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type add) {
+void csvm<T>::assemble_kernel_matrix(const std::vector<real_type> &q) {
+    kernel_matrix_ = assemble_kernel_matrix(q, *data_ptr_, QA_cost_);
+}
+
+template <typename T>
+template <typename U>
+auto csvm<T>::assemble_kernel_matrix(const std::vector<U> &q, const aos_matrix<U> &data, const U QA_cost) const -> kernel_matrix<U> {
+    const U cost = static_cast<U>(1 / cost_);
     switch (kernel_) {
         case kernel_type::linear:
-            openmp::device_kernel_linear(q, ret, d, data, QA_cost_, 1 / cost_, add);
-            break;
+            return openmp::assemble_kernel_matrix_linear(q, data, QA_cost, cost, tile_size_);
         case kernel_type::polynomial:
-            openmp::device_kernel_poly(q, ret, d, data, QA_cost_, 1 / cost_, add, degree_, gamma_, coef0_);
-            break;
+            return openmp::assemble_kernel_matrix_poly(q, data, QA_cost, cost, degree_, static_cast<U>(gamma_), static_cast<U>(coef0_), tile_size_);
         case kernel_type::rbf:
-            openmp::device_kernel_radial(q, ret, d, data, QA_cost_, 1 / cost_, add, gamma_);
-            break;
+            return openmp::assemble_kernel_matrix_radial(q, data, QA_cost, cost, static_cast<U>(gamma_), tile_size_, fast_math_kernels_);
     }
+    return kernel_matrix<U>{};
 }
 
 template <typename T>
-auto csvm<T>::solver_CG(const std::vector<real_type> &b, const std::size_t imax, const real_type eps, const std::vector<real_type> &q) -> std::vector<real_type> {
-    using namespace plssvm::operators;
+accumulation_strategy csvm<T>::run_device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, const real_type add, const accumulation_strategy strategy) {
+    return run_device_kernel(kernel_matrix_, tile_cache_.get(), q, ret, d, data, QA_cost_, add, strategy);
+}
 
-    std::vector<real_type> alpha(b.size(), 1.0);
-    const typename std::vector<real_type>::size_type dept = b.size();
+template <typename T>
+accumulation_strategy csvm<T>::run_device_kernel(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, const real_type add, const accumulation_strategy strategy) {
+    return run_device_kernel(kernel_matrix_, tile_cache_.get(), q, ret, d, data, QA_cost_, add, strategy);
+}
 
-    // sanity checks
-    PLSSVM_ASSERT(dept == num_data_points_ - 1, "Sizes mismatch!: {} != {}", dept, num_data_points_ - 1);
+template <typename T>
+template <typename U, typename Vector>
+accumulation_strategy csvm<T>::run_device_kernel(const kernel_matrix<U> &matrix, tile_cache<U> *cache, const std::vector<U> &q, Vector &ret, const Vector &d, const aos_matrix<U> &data, const U QA_cost, const U add, const accumulation_strategy strategy) const {
+    if (matrix.data != nullptr) {
+        return openmp::device_kernel_explicit(matrix, ret, d, add, strategy);
+    }
+    const U cost = static_cast<U>(1 / cost_);
+    switch (kernel_) {
+        case kernel_type::linear:
+            return openmp::device_kernel_linear(q, ret, d, data, QA_cost, cost, add, tile_size_, strategy, cache);
+        case kernel_type::polynomial:
+            return openmp::device_kernel_poly(q, ret, d, data, QA_cost, cost, add, degree_, static_cast<U>(gamma_), static_cast<U>(coef0_), tile_size_, strategy, cache);
+        case kernel_type::rbf:
+            return openmp::device_kernel_radial(q, ret, d, data, QA_cost, cost, add, static_cast<U>(gamma_), tile_size_, strategy, cache, fast_math_kernels_);
+    }
+    return strategy;
+}
 
-    std::vector<real_type> r(b);
+template <typename T>
+template <typename U>
+void csvm<T>::setup_kernel_matrix(const std::vector<U> &q, const aos_matrix<U> &data, const U QA_cost, kernel_matrix<U> &matrix, std::unique_ptr<tile_cache<U>> &cache) {
+    const std::size_t dept = q.size();
+
+    // assemble the kernel matrix once if it fits into the memory budget, otherwise recompute it in every CG iteration
+    const std::size_t kernel_matrix_bytes = kernel_matrix_size<U>(dept, tile_size_);
+    const solver_type solver = base_type::resolve_solver(kernel_matrix_bytes);
+    if (solver == solver_type::cg_explicit) {
+        const auto start_time = std::chrono::steady_clock::now();
+        matrix = assemble_kernel_matrix(q, data, QA_cost);
+        const auto end_time = std::chrono::steady_clock::now();
+        if (print_info_) {
+            fmt::print("Using the {} solver (assembled the {:.2f} MiB kernel matrix in {}).\n", solver, static_cast<double>(kernel_matrix_bytes) / (1024 * 1024), std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+        }
+    } else {
+        if (print_info_) {
+            fmt::print("Using the {} solver (the explicit kernel matrix would need {:.2f} MiB).\n", solver, static_cast<double>(kernel_matrix_bytes) / (1024 * 1024));
+        }
+        // cache as many kernel matrix tiles as fit into the cache size to avoid recalculating them in every CG iteration
+        if (cache_size_ > 0) {
+            const std::size_t used_tile_size = round_tile_size(tile_size_);
+            cache = std::make_unique<tile_cache<U>>(lower_triangular_tiles(dept, used_tile_size).size(), used_tile_size, cache_size_ * 1024 * 1024);
+            if (print_info_) {
+                fmt::print("Caching up to {} of {} kernel matrix tiles ({} MiB).\n", cache->capacity(), cache->num_tiles(), cache_size_);
+            }
+        }
+    }
+}
 
-    // solve: r = b - (A * alpha_)
-    run_device_kernel(q, r, alpha, *data_ptr_, -1);
+template <typename T>
+auto csvm<T>::setup_matvec(const std::vector<real_type> &q) -> matvec_type {
+    if (kernel_ == kernel_type::linear) {
+        // the linear kernel matrix is never needed explicitly: the matrix-vector product in the primal space only needs O(n * d) per CG iteration
+        if (print_info_) {
+            fmt::print("Using the primal-space matrix-vector product for the linear kernel.\n");
+        }
+        return [this, &q](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+            base_type::linear_kernel_matvec(q, ret, d, add);
+        };
+    }
 
-    // delta = r.T * r
-    real_type delta = transposed{ r } * r;
-    const real_type delta0 = delta;
-    std::vector<real_type> Ad(dept);
+    setup_kernel_matrix(q, *data_ptr_, QA_cost_, kernel_matrix_, tile_cache_);
 
-    std::vector<real_type> d(r);
+    return [this, &q, first_run = true](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) mutable {
+        const accumulation_strategy strategy = run_device_kernel(q, ret, d, *data_ptr_, add);
+        if (first_run && print_info_) {
+            fmt::print("Using the {} accumulation strategy in the OpenMP kernel.\n", strategy);
+        }
+        first_run = false;
+    };
+}
 
-    std::size_t run = 0;
-    for (; run < imax; ++run) {
+template <typename T>
+auto csvm<T>::setup_block_matvec(const std::vector<real_type> &q) -> block_matvec_type {
+    if (kernel_ == kernel_type::linear) {
+        // the primal-space matrix-vector product already is O(n * d), i.e., there are no kernel matrix entries that could be shared between the vectors
         if (print_info_) {
-            fmt::print("Start Iteration {} (max: {}) with current residuum {} (target: {}).\n", run + 1, imax, delta, eps * eps * delta0);
+            fmt::print("Using the primal-space matrix-vector product for the linear kernel.\n");
         }
-        // Ad = A * d
-        std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
-        run_device_kernel(q, Ad, d, *data_ptr_, 1);
-
-        // (alpha = delta_new / (d^T * q))
-        const real_type alpha_cd = delta / (transposed{ d } * Ad);
-
-        // (x = x + alpha * d)
-        alpha += alpha_cd * d;
-
-        // (r = b - A * x)
-        // r = b
-        r = b;
-        // r -= A * x
-        run_device_kernel(q, r, alpha, *data_ptr_, -1);
-
-        // (delta = r^T * r)
-        const real_type delta_old = delta;
-        delta = transposed{ r } * r;
-        // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
-            break;
+        return [this, &q](std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const real_type add) {
+            for (std::size_t c = 0; c < d.size(); ++c) {
+                base_type::linear_kernel_matvec(q, ret[c], d[c], add);
+            }
+        };
+    }
+
+    setup_kernel_matrix(q, *data_ptr_, QA_cost_, kernel_matrix_, tile_cache_);
+
+    return [this, &q, first_run = true](std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const real_type add) mutable {
+        const accumulation_strategy strategy = run_device_kernel(q, ret, d, *data_ptr_, add);
+        if (first_run && print_info_) {
+            fmt::print("Using the {} accumulation strategy in the OpenMP kernel.\n", strategy);
         }
+        first_run = false;
+    };
+}
+
+template <typename T>
+void csvm<T>::release_matvec() {
+    if (tile_cache_ != nullptr && print_info_) {
+        const std::size_t num_lookups = tile_cache_->num_hits() + tile_cache_->num_misses();
+        fmt::print("Kernel matrix tile cache: {} hits, {} misses (hit rate: {:.2f}%).\n", tile_cache_->num_hits(), tile_cache_->num_misses(), num_lookups == 0 ? 0.0 : 100.0 * static_cast<double>(tile_cache_->num_hits()) / static_cast<double>(num_lookups));
+    }
+
+    // release the explicit kernel matrix and the tile cache
+    kernel_matrix_ = kernel_matrix<real_type>{};
+    tile_cache_.reset();
+}
+
+template <typename T>
+auto csvm<T>::solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, const std::size_t imax, const real_type eps, const std::vector<real_type> &q) -> std::vector<real_type> {
+    // sanity checks
+    PLSSVM_ASSERT(b.size() == num_data_points_ - 1, "Sizes mismatch!: {} != {}", b.size(), num_data_points_ - 1);
 
-        // (beta = delta_new / delta_old)
-        real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
+    if constexpr (std::is_same_v<real_type, double>) {
+        if (mixed_precision_ && kernel_ != kernel_type::linear) {
+            return mixed_precision_solver_CG(b, x0, imax, eps, q);
+        }
     }
+
+    const matvec_type matvec = setup_matvec(q);
+    std::vector<real_type> alpha = base_type::conjugate_gradients(b, x0, imax, eps, q, matvec);
+    release_matvec();
+
+    return alpha;
+}
+
+template <typename T>
+auto csvm<T>::solver_CG_cost_path(const std::vector<real_type> &b, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const std::vector<real_type> &costs) -> std::vector<std::vector<real_type>> {
+    // sanity checks
+    PLSSVM_ASSERT(b.size() == num_data_points_ - 1, "Sizes mismatch!: {} != {}", b.size(), num_data_points_ - 1);
+
+    const matvec_type matvec = setup_matvec(q);
+    std::vector<std::vector<real_type>> alphas = base_type::multi_shift_conjugate_gradients(b, imax, eps, costs, matvec);
+    release_matvec();
+
+    return alphas;
+}
+
+template <typename T>
+auto csvm<T>::solver_CG_block(const std::vector<std::vector<real_type>> &B, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const std::vector<std::size_t> &folds) -> std::vector<std::vector<real_type>> {
+    // sanity checks
+    PLSSVM_ASSERT(std::all_of(B.begin(), B.end(), [&](const std::vector<real_type> &b) { return b.size() == num_data_points_ - 1; }), "All right-hand sides must have {} values!", num_data_points_ - 1);
+
+    const block_matvec_type block_matvec = setup_block_matvec(q);
+    std::vector<std::vector<real_type>> alphas = base_type::block_conjugate_gradients(B, imax, eps, q, block_matvec, folds);
+    release_matvec();
+
+    return alphas;
+}
+
+template <typename T>
+auto csvm<T>::mixed_precision_solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, const std::size_t imax, const real_type eps, const std::vector<real_type> &q) -> std::vector<real_type> {
+    const typename std::vector<real_type>::size_type dept = b.size();
+
     if (print_info_) {
-        fmt::print("Finished after {} iterations with a residuum of {} (target: {}).\n", run + 1, delta, eps * eps * delta0);
+        fmt::print("Using mixed precision: single precision kernel matrix-vector products with double precision iterative refinement.\n");
+    }
+
+    // convert the data set and q vector to single precision
+    aos_matrix<float> data{ data_ptr_->num_rows(), data_ptr_->num_cols(), data_ptr_->row_padding(), simd_padding<float>(data_ptr_->num_cols()) };
+    #pragma omp parallel for
+    for (std::size_t row = 0; row < data_ptr_->num_rows(); ++row) {
+        for (std::size_t col = 0; col < data_ptr_->num_cols(); ++col) {
+            data(row, col) = static_cast<float>((*data_ptr_)(row, col));
+        }
+    }
+    const std::vector<float> q_float(q.begin(), q.end());
+    const auto QA_cost = static_cast<float>(QA_cost_);
+
+    kernel_matrix<float> matrix{};
+    std::unique_ptr<tile_cache<float>> cache{};
+    setup_kernel_matrix(q_float, data, QA_cost, matrix, cache);
+
+    std::vector<float> d_float(dept);
+    std::vector<float> ret_float(dept);
+    const auto low_precision_matvec = [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+        std::copy(d.begin(), d.end(), d_float.begin());
+        std::fill(ret_float.begin(), ret_float.end(), 0.0f);
+        run_device_kernel(matrix, cache.get(), q_float, ret_float, d_float, data, QA_cost, 1.0f, accumulation_strategy::automatic);
+        // accumulate the single precision result in double precision
+        #pragma omp parallel for
+        for (std::size_t i = 0; i < dept; ++i) {
+            ret[i] += add * static_cast<real_type>(ret_float[i]);
+        }
+    };
+    // the residual of the refinement is always calculated in double precision without storing anything
+    const auto matvec = [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+        run_device_kernel(q, ret, d, *data_ptr_, add);
+    };
+
+    std::vector<real_type> alpha = base_type::mixed_precision_conjugate_gradients(b, x0, imax, eps, q, matvec, low_precision_matvec);
+
+    if (cache != nullptr && print_info_) {
+        const std::size_t num_lookups = cache->num_hits() + cache->num_misses();
+        fmt::print("Kernel matrix tile cache: {} hits, {} misses (hit rate: {:.2f}%).\n", cache->num_hits(), cache->num_misses(), num_lookups == 0 ? 0.0 : 100.0 * static_cast<double>(cache->num_hits()) / static_cast<double>(num_lookups));
     }
 
     return alpha;
@@ -145,59 +311,77 @@ void csvm<T>::update_w() {
     w_.resize(num_features_);
     std::fill(w_.begin(), w_.end(), real_type{ 0.0 });
 
+#if defined(PLSSVM_HAS_BLAS)
+    if (::plssvm::detail::blas::is_enabled_for(num_data_points_, num_features_, data_ptr_->num_cols_padded())) {
+        // w = data^T * alpha
+        ::plssvm::detail::blas::gemv_t(num_data_points_, num_features_, real_type{ 1.0 }, data_ptr_->data(), data_ptr_->num_cols_padded(), alpha_ptr_->data(), real_type{ 0.0 }, w_.data());
+        return;
+    }
+#endif
     // calculate the w vector
     #pragma omp parallel for
     for (std::size_t feature_index = 0; feature_index < num_features_; ++feature_index) {
         real_type temp{ 0.0 };
         #pragma omp simd reduction(+: temp)
         for (std::size_t data_index = 0; data_index < num_data_points_; ++data_index) {
-            temp += (*alpha_ptr_)[data_index] * (*data_ptr_)[data_index][feature_index];
+            temp += (*alpha_ptr_)[data_index] * (*data_ptr_)(data_index, feature_index);
         }
         w_[feature_index] = temp;
     }
 }
 
 template <typename T>
-auto csvm<T>::predict(const std::vector<std::vector<real_type>> &points) -> std::vector<real_type> {
+auto csvm<T>::predict(const aos_matrix<real_type> &points) -> std::vector<real_type> {
     using namespace plssvm::operators;
 
     PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
     PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
 
     // return empty vector if there are no points to predict
-    if (points.empty()) {
+    if (points.num_rows() == 0) {
         return std::vector<real_type>{};
     }
 
     // sanity checks
-    if (!std::all_of(points.begin(), points.end(), [&](const std::vector<real_type> &point) { return point.size() == points.front().size(); })) {
-        throw exception{ "All points in the prediction point vector must have the same number of features!" };
-    } else if (points.front().size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", data_ptr_->front().size(), points.front().size()) };
+    if (points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.num_cols()) };
     } else if (alpha_ptr_ == nullptr) {
         throw exception{ "No alphas provided for prediction!" };
     }
 
-    PLSSVM_ASSERT(data_ptr_->size() == alpha_ptr_->size(), "Sizes mismatch!: {} != {}", data_ptr_->size(), alpha_ptr_->size());  // exception in constructor
+    PLSSVM_ASSERT(num_data_points_ == alpha_ptr_->size(), "Sizes mismatch!: {} != {}", num_data_points_, alpha_ptr_->size());  // exception in constructor
 
-    std::vector<real_type> out(points.size(), bias_);
+    std::vector<real_type> out(points.num_rows(), bias_);
     if (kernel_ == kernel_type::linear) {
         // use faster methode in case of the linear kernel function
         if (w_.empty()) {
             update_w();
         }
+#if defined(PLSSVM_HAS_BLAS)
+        if (::plssvm::detail::blas::is_enabled_for(points.num_rows(), num_features_, points.num_cols_padded())) {
+            // out += points * w
+            ::plssvm::detail::blas::gemv_n(points.num_rows(), num_features_, real_type{ 1.0 }, points.data(), points.num_cols_padded(), w_.data(), real_type{ 1.0 }, out.data());
+            return out;
+        }
+#endif
+    }
+
+    if (kernel_ == kernel_type::rbf) {
+        // the squared euclidean distances are calculated from dot product tiles
+        device_kernel_predict_radial(out, *data_ptr_, *alpha_ptr_, points, gamma_, tile_size_, fast_math_kernels_);
+        return out;
     }
 
     #pragma omp parallel for
-    for (typename std::vector<std::vector<real_type>>::size_type point_index = 0; point_index < points.size(); ++point_index) {
+    for (std::size_t point_index = 0; point_index < points.num_rows(); ++point_index) {
         if (kernel_ == kernel_type::linear) {
             // use faster methode in case of the linear kernel function
-            out[point_index] += transposed{ w_ } * points[point_index];
+            out[point_index] += dot(w_.data(), points.row_data(point_index), num_features_);
         } else {
             real_type temp{ 0.0 };
             #pragma omp simd reduction(+: temp)
             for (std::size_t data_index = 0; data_index < num_data_points_; ++data_index) {
-                temp += (*alpha_ptr_)[data_index] * base_type::kernel_function((*data_ptr_)[data_index], points[point_index]);
+                temp += (*alpha_ptr_)[data_index] * base_type::kernel_function(data_ptr_->row_data(data_index), points.row_data(point_index));
             }
             out[point_index] += temp;
         }
@@ -10,45 +10,53 @@
 
 #include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
 #include "plssvm/kernel_types.hpp"   // plssvm::kernel_function
+#include "plssvm/matrix.hpp"         // plssvm::aos_matrix
 
-#include <vector>  // std::vector
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
 
 namespace plssvm::openmp {
 
 template <typename real_type>
-void device_kernel_q_linear(std::vector<real_type> &q, const std::vector<std::vector<real_type>> &data) {
-    PLSSVM_ASSERT(q.size() == data.size() - 1, "Sizes mismatch!: {} != {}", q.size(), data.size() - 1);
+void device_kernel_q_linear(std::vector<real_type> &q, const aos_matrix<real_type> &data) {
+    PLSSVM_ASSERT(q.size() == data.num_rows() - 1, "Sizes mismatch!: {} != {}", q.size(), data.num_rows() - 1);
+
+    const std::size_t last = data.num_rows() - 1;
 
     #pragma omp parallel for
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size() - 1; ++i) {
-        q[i] = kernel_function<kernel_type::linear>(data[i], data.back());
+    for (std::size_t i = 0; i < last; ++i) {
+        q[i] = kernel_function<kernel_type::linear>(data.row_data(i), data.row_data(last), data.num_cols());
     }
 }
-template void device_kernel_q_linear(std::vector<float> &, const std::vector<std::vector<float>> &);
-template void device_kernel_q_linear(std::vector<double> &, const std::vector<std::vector<double>> &);
+template void device_kernel_q_linear(std::vector<float> &, const aos_matrix<float> &);
+template void device_kernel_q_linear(std::vector<double> &, const aos_matrix<double> &);
 
 template <typename real_type>
-void device_kernel_q_poly(std::vector<real_type> &q, const std::vector<std::vector<real_type>> &data, const int degree, const real_type gamma, const real_type coef0) {
-    PLSSVM_ASSERT(q.size() == data.size() - 1, "Sizes mismatch!: {} != {}", q.size(), data.size() - 1);
+void device_kernel_q_poly(std::vector<real_type> &q, const aos_matrix<real_type> &data, const int degree, const real_type gamma, const real_type coef0) {
+    PLSSVM_ASSERT(q.size() == data.num_rows() - 1, "Sizes mismatch!: {} != {}", q.size(), data.num_rows() - 1);
+
+    const std::size_t last = data.num_rows() - 1;
 
     #pragma omp parallel for
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size() - 1; ++i) {
-        q[i] = kernel_function<kernel_type::polynomial>(data[i], data.back(), degree, gamma, coef0);
+    for (std::size_t i = 0; i < last; ++i) {
+        q[i] = kernel_function<kernel_type::polynomial>(data.row_data(i), data.row_data(last), data.num_cols(), degree, gamma, coef0);
     }
 }
-template void device_kernel_q_poly(std::vector<float> &, const std::vector<std::vector<float>> &, const int, const float, const float);
-template void device_kernel_q_poly(std::vector<double> &, const std::vector<std::vector<double>> &, const int, const double, const double);
+template void device_kernel_q_poly(std::vector<float> &, const aos_matrix<float> &, const int, const float, const float);
+template void device_kernel_q_poly(std::vector<double> &, const aos_matrix<double> &, const int, const double, const double);
 
 template <typename real_type>
-void device_kernel_q_radial(std::vector<real_type> &q, const std::vector<std::vector<real_type>> &data, const real_type gamma) {
-    PLSSVM_ASSERT(q.size() == data.size() - 1, "Sizes mismatch!: {} != {}", q.size(), data.size() - 1);
+void device_kernel_q_radial(std::vector<real_type> &q, const aos_matrix<real_type> &data, const real_type gamma, const bool fast_exp) {
+    PLSSVM_ASSERT(q.size() == data.num_rows() - 1, "Sizes mismatch!: {} != {}", q.size(), data.num_rows() - 1);
+
+    const std::size_t last = data.num_rows() - 1;
 
     #pragma omp parallel for
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size() - 1; ++i) {
-        q[i] = kernel_function<kernel_type::rbf>(data[i], data.back(), gamma);
+    for (std::size_t i = 0; i < last; ++i) {
+        q[i] = kernel_function<kernel_type::rbf>(data.row_data(i), data.row_data(last), data.num_cols(), gamma, fast_exp);
     }
 }
-template void device_kernel_q_radial(std::vector<float> &, const std::vector<std::vector<float>> &, const float);
-template void device_kernel_q_radial(std::vector<double> &, const std::vector<std::vector<double>> &, const double);
+template void device_kernel_q_radial(std::vector<float> &, const aos_matrix<float> &, const float, const bool);
+template void device_kernel_q_radial(std::vector<double> &, const aos_matrix<double> &, const double, const bool);
 
 }  // namespace plssvm::openmp
\ No newline at end of file
@@ -8,39 +8,558 @@
 
 #include "plssvm/backends/OpenMP/svm_kernel.hpp"
 
-#include "plssvm/constants.hpp"     // plssvm::kernel_index_type, plssvm::OPENMP_BLOCK_SIZE
-#include "plssvm/kernel_types.hpp"  // plssvm::kernel_type, plssvm::kernel_function
+#include "plssvm/backends/OpenMP/detail/simd.hpp"  // plssvm::openmp::detail::simd::vec, plssvm::openmp::detail::simd::register_block_size
+#include "plssvm/backends/OpenMP/tile_cache.hpp"   // plssvm::openmp::tile_cache
+#include "plssvm/constants.hpp"                    // plssvm::kernel_index_type, plssvm::OPENMP_FEATURE_BLOCK_SIZE
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/blas.hpp"                  // plssvm::detail::blas::{is_enabled_for, gemm_nt, syrk_lower}
+#include "plssvm/detail/fast_exp.hpp"              // plssvm::detail::kernel_exp, plssvm::detail::dispatch_fast_exp
+#include "plssvm/detail/integer_pow.hpp"           // plssvm::detail::integer_pow, plssvm::detail::dispatch_degree
+#include "plssvm/detail/operators.hpp"             // plssvm::operators::dot
+#include "plssvm/detail/utility.hpp"               // plssvm::detail::get, plssvm::detail::always_false_v
+#include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix
 
-#include <utility>  // std::forward
-#include <vector>   // std::vector
+#include <omp.h>  // omp_get_max_threads, omp_get_num_threads, omp_get_thread_num
+
+#include <algorithm>    // std::min, std::max, std::fill, std::stable_sort, std::all_of
+#include <array>        // std::array
+#include <cmath>        // std::fma
+#include <cstddef>      // std::size_t
+#include <memory>       // std::unique_ptr
+#include <ostream>      // std::ostream
+#include <type_traits>  // std::true_type, std::false_type
+#include <utility>      // std::pair
+#include <vector>       // std::vector
 
 namespace plssvm::openmp {
 
 namespace detail {
 
+/// The number of rows and columns of one register block.
+constexpr kernel_index_type REGISTER_BLOCK_SIZE = simd::register_block_size;
+
+/**
+ * @brief Accumulate the dot products between all pairs of the data points @p x_i and @p x_j over the features [@p feature_begin, @p feature_end) into @p tile.
+ * @details The REGISTER_BLOCK_SIZE x REGISTER_BLOCK_SIZE accumulators are kept in SIMD registers, i.e., each loaded feature vector is reused REGISTER_BLOCK_SIZE times (GEMM micro-kernel).
+ *          The number of features in [@p feature_begin, @p feature_end) must be a multiple of the SIMD width.
+ * @tparam real_type the type of the data
+ * @param[in] x_i the row pointers of the first register block of data points
+ * @param[in] x_j the row pointers of the second register block of data points
+ * @param[in] feature_begin the first feature to process
+ * @param[in] feature_end one past the last feature to process
+ * @param[in,out] tile the partial results
+ * @param[in] tile_stride the stride between two rows of @p tile
+ */
+template <typename real_type>
+inline void register_block(const std::array<const real_type *, REGISTER_BLOCK_SIZE> &x_i, const std::array<const real_type *, REGISTER_BLOCK_SIZE> &x_j, const kernel_index_type feature_begin, const kernel_index_type feature_end, real_type *tile, const kernel_index_type tile_stride) {
+    using simd_type = simd::vec<real_type>;
+
+    simd_type acc[REGISTER_BLOCK_SIZE][REGISTER_BLOCK_SIZE];
+    for (kernel_index_type r = 0; r < REGISTER_BLOCK_SIZE; ++r) {
+        for (kernel_index_type c = 0; c < REGISTER_BLOCK_SIZE; ++c) {
+            acc[r][c] = simd_type::zero();
+        }
+    }
+
+    for (kernel_index_type f = feature_begin; f < feature_end; f += simd_type::width) {
+        simd_type xi[REGISTER_BLOCK_SIZE];
+        for (kernel_index_type r = 0; r < REGISTER_BLOCK_SIZE; ++r) {
+            xi[r] = simd_type::load(x_i[r] + f);
+        }
+        for (kernel_index_type c = 0; c < REGISTER_BLOCK_SIZE; ++c) {
+            const simd_type xj = simd_type::load(x_j[c] + f);
+            for (kernel_index_type r = 0; r < REGISTER_BLOCK_SIZE; ++r) {
+                acc[r][c] = fma(xi[r], xj, acc[r][c]);
+            }
+        }
+    }
+
+    for (kernel_index_type r = 0; r < REGISTER_BLOCK_SIZE; ++r) {
+        for (kernel_index_type c = 0; c < REGISTER_BLOCK_SIZE; ++c) {
+            tile[r * tile_stride + c] += reduce_add(acc[r][c]);
+        }
+    }
+}
+
+/**
+ * @brief Apply the @p kernel function to the accumulated dot product (linear and polynomial kernel) or squared euclidean distance (rbf kernel) @p value.
+ * @tparam kernel the kernel type
+ * @tparam real_type the type of the data
+ * @tparam Args additional parameters used in the respective kernel function
+ * @param[in] value the dot product or squared euclidean distance
+ * @param[in] args additional parameters
+ * @return the kernel function value (`[[nodiscard]]`)
+ */
 template <kernel_type kernel, typename real_type, typename... Args>
-void device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, Args &&...args) {
-    const auto dept = static_cast<kernel_index_type>(d.size());
-
-    #pragma omp parallel for collapse(2) schedule(dynamic)
-    for (kernel_index_type i = 0; i < dept; i += OPENMP_BLOCK_SIZE) {
-        for (kernel_index_type j = 0; j < dept; j += OPENMP_BLOCK_SIZE) {
-            for (kernel_index_type ii = 0; ii < OPENMP_BLOCK_SIZE && ii + i < dept; ++ii) {
-                real_type ret_iii = 0.0;
-                for (kernel_index_type jj = 0; jj < OPENMP_BLOCK_SIZE && jj + j < dept; ++jj) {
-                    if (ii + i >= jj + j) {
-                        const real_type temp = (kernel_function<kernel>(data[ii + i], data[jj + j], std::forward<Args>(args)...) + QA_cost - q[ii + i] - q[jj + j]) * add;
-                        if (ii + i == jj + j) {
-                            ret_iii += (temp + cost * add) * d[ii + i];
-                        } else {
-                            ret_iii += temp * d[jj + j];
-                            #pragma omp atomic
-                            ret[jj + j] += temp * d[ii + i];
-                        }
+[[nodiscard]] inline real_type apply_kernel_function(const real_type value, const Args... args) {
+    if constexpr (kernel == kernel_type::linear) {
+        return value;
+    } else if constexpr (kernel == kernel_type::polynomial) {
+        // the degree is a std::integral_constant for the degrees unrolled into multiplications
+        const auto degree = ::plssvm::detail::get<0>(args...);
+        const auto gamma = static_cast<real_type>(::plssvm::detail::get<1>(args...));
+        const auto coef0 = static_cast<real_type>(::plssvm::detail::get<2>(args...));
+        return ::plssvm::detail::integer_pow(std::fma(gamma, value, coef0), degree);
+    } else if constexpr (kernel == kernel_type::rbf) {
+        // the second parameter is a std::bool_constant selecting plssvm::detail::fast_exp
+        const auto gamma = static_cast<real_type>(::plssvm::detail::get<0>(args...));
+        return ::plssvm::detail::kernel_exp(-gamma * value, ::plssvm::detail::get<1>(args...));
+    } else {
+        static_assert(::plssvm::detail::always_false_v<real_type>, "Unknown kernel type!");
+    }
+}
+
+/**
+ * @brief Return the number of features of @p data processed using SIMD instructions.
+ * @details The padding entries are zero and, therefore, don't change the dot products or distances
+ *          -> if the padded rows are a multiple of the SIMD width, no scalar remainder loop is necessary.
+ * @tparam real_type the type of the data
+ * @param[in] data the data matrix
+ * @return the number of features processed using SIMD instructions (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] inline kernel_index_type num_simd_features(const aos_matrix<real_type> &data) {
+    using simd_type = simd::vec<real_type>;
+    const auto num_features = static_cast<kernel_index_type>(data.num_cols());
+    return static_cast<kernel_index_type>(data.num_cols_padded()) % simd_type::width == 0 ? (num_features + simd_type::width - 1) / simd_type::width * simd_type::width
+                                                                                          : num_features / simd_type::width * simd_type::width;
+}
+
+/**
+ * @brief Calculate the squared euclidean norms of all rows of @p data.
+ * @details Used to calculate the squared euclidean distances of the rbf kernel function as \f$\|x\|^2 + \|y\|^2 - 2 x^T y\f$, i.e., using the same
+ *          dot product tiles as the linear and polynomial kernel functions.
+ * @tparam real_type the type of the data
+ * @param[in] data the data matrix
+ * @return the squared norms (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] inline std::vector<real_type> squared_row_norms(const aos_matrix<real_type> &data) {
+    std::vector<real_type> norms(data.num_rows());
+    #pragma omp parallel for
+    for (std::size_t row = 0; row < data.num_rows(); ++row) {
+        norms[row] = ::plssvm::operators::dot(data.row_data(row), data.row_data(row), data.num_cols());
+    }
+    return norms;
+}
+
+/**
+ * @brief Calculate the squared euclidean distance from the dot product @p dot of two data points and their squared norms @p squared_norm_i and @p squared_norm_j.
+ * @details Due to cancellation, the difference may become slightly negative for (nearly) identical data points -> clamped to `0`.
+ * @tparam real_type the type of the data
+ * @param[in] dot the dot product of both data points
+ * @param[in] squared_norm_i the squared norm of the first data point
+ * @param[in] squared_norm_j the squared norm of the second data point
+ * @return the squared euclidean distance (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] inline real_type squared_distance_from_dot(const real_type dot, const real_type squared_norm_i, const real_type squared_norm_j) {
+    return std::max(squared_norm_i + squared_norm_j - 2 * dot, real_type{ 0.0 });
+}
+
+/**
+ * @brief Calculate the entries on and below the diagonal of the reduced kernel matrix tile starting at the data points @p i and @p j.
+ * @tparam kernel the kernel type
+ * @tparam real_type the type of the data
+ * @tparam Args additional parameters used in the respective kernel function
+ * @param[in] i the first row of the tile
+ * @param[in] j the first column of the tile
+ * @param[in] tile_size the size of the tile, must be a multiple of REGISTER_BLOCK_SIZE
+ * @param[out] tile the tile, must be able to hold `tile_size * tile_size` values
+ * @param[in] q the `q` vector
+ * @param[in] data the data matrix
+ * @param[in] squared_norms the squared norms of all rows of @p data (rbf kernel only, see squared_row_norms())
+ * @param[in] num_features_simd the number of features processed using SIMD instructions
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] args additional parameters
+ */
+template <kernel_type kernel, typename real_type, typename... Args>
+inline void compute_tile(const kernel_index_type i, const kernel_index_type j, const kernel_index_type tile_size, real_type *tile, const std::vector<real_type> &q, const aos_matrix<real_type> &data, const std::vector<real_type> &squared_norms, const kernel_index_type num_features_simd, const real_type QA_cost, const real_type cost, const Args... args) {
+    using simd_type = simd::vec<real_type>;
+    // round the feature block size up to a multiple of the SIMD width
+    constexpr kernel_index_type FEATURE_BLOCK_SIZE = (OPENMP_FEATURE_BLOCK_SIZE + simd_type::width - 1) / simd_type::width * simd_type::width;
+
+    const auto dept = static_cast<kernel_index_type>(q.size());
+    const auto num_features = static_cast<kernel_index_type>(data.num_cols());
+    const kernel_index_type i_end = std::min(tile_size, dept - i);
+    const kernel_index_type j_end = std::min(tile_size, dept - j);
+
+#if defined(PLSSVM_HAS_BLAS)
+    if (const std::size_t ld = data.num_cols_padded(); ::plssvm::detail::blas::is_enabled_for(num_features, ld, tile_size)) {
+        // the dot products of the current tile; only the lower triangle of a diagonal tile is needed
+        if (i == j) {
+            ::plssvm::detail::blas::syrk_lower(static_cast<std::size_t>(i_end), static_cast<std::size_t>(num_features), real_type{ 1.0 }, data.row_data(i), ld, real_type{ 0.0 }, tile, static_cast<std::size_t>(tile_size));
+        } else {
+            ::plssvm::detail::blas::gemm_nt(static_cast<std::size_t>(i_end), static_cast<std::size_t>(j_end), static_cast<std::size_t>(num_features), real_type{ 1.0 }, data.row_data(i), ld, data.row_data(j), ld, real_type{ 0.0 }, tile, static_cast<std::size_t>(tile_size));
+        }
+    } else
+#endif
+    {
+        // accumulate the dot products of the current tile, feature block by feature block
+        std::fill(tile, tile + tile_size * tile_size, real_type{ 0.0 });
+        for (kernel_index_type f = 0; f < num_features_simd; f += FEATURE_BLOCK_SIZE) {
+            const kernel_index_type f_end = std::min(f + FEATURE_BLOCK_SIZE, num_features_simd);
+            for (kernel_index_type ii = 0; ii < i_end; ii += REGISTER_BLOCK_SIZE) {
+                for (kernel_index_type jj = 0; jj < j_end && j + jj <= i + ii + REGISTER_BLOCK_SIZE - 1; jj += REGISTER_BLOCK_SIZE) {
+                    // data points outside the matrix are clamped to the last data point; their results are discarded
+                    std::array<const real_type *, REGISTER_BLOCK_SIZE> x_i{};
+                    std::array<const real_type *, REGISTER_BLOCK_SIZE> x_j{};
+                    for (kernel_index_type b = 0; b < REGISTER_BLOCK_SIZE; ++b) {
+                        x_i[b] = data.row_data(std::min(i + ii + b, dept - 1));
+                        x_j[b] = data.row_data(std::min(j + jj + b, dept - 1));
                     }
+                    register_block(x_i, x_j, f, f_end, tile + ii * tile_size + jj, tile_size);
                 }
+            }
+        }
+        // remaining features of an unpadded matrix
+        for (kernel_index_type ii = 0; ii < i_end && num_features_simd < num_features; ++ii) {
+            for (kernel_index_type jj = 0; jj < j_end && j + jj <= i + ii; ++jj) {
+                const real_type *x_i = data.row_data(i + ii);
+                const real_type *x_j = data.row_data(j + jj);
+                for (kernel_index_type f = num_features_simd; f < num_features; ++f) {
+                    tile[ii * tile_size + jj] += x_i[f] * x_j[f];
+                }
+            }
+        }
+    }
+
+    // apply the kernel function and the corrections of the reduced system
+    for (kernel_index_type ii = 0; ii < i_end; ++ii) {
+        // only the entries on and below the diagonal; the countable loop is vectorized including the kernel function
+        const kernel_index_type jj_end = std::min(j_end, i + ii - j + 1);
+        #pragma omp simd
+        for (kernel_index_type jj = 0; jj < jj_end; ++jj) {
+            real_type value = tile[ii * tile_size + jj];
+            if constexpr (kernel == kernel_type::rbf) {
+                value = squared_distance_from_dot(value, squared_norms[ii + i], squared_norms[jj + j]);
+            }
+            tile[ii * tile_size + jj] = apply_kernel_function<kernel>(value, args...) + QA_cost - q[ii + i] - q[jj + j];
+        }
+        if (i == j) {
+            tile[ii * tile_size + ii] += cost;
+        }
+    }
+}
+
+/**
+ * @brief Add the contribution of the reduced kernel matrix tile starting at the data points @p i and @p j, and the contribution of its transposed tile, to @p ret.
+ * @tparam use_atomics if `true`, @p ret is shared between all threads and, therefore, must be updated atomically
+ * @tparam real_type the type of the data
+ * @param[in] i the first row of the tile
+ * @param[in] j the first column of the tile
+ * @param[in] tile_size the size of the tile
+ * @param[in] tile the tile calculated by compute_tile()
+ * @param[in,out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] dept the size of @p ret and @p d
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ */
+template <bool use_atomics, typename real_type>
+inline void accumulate_tile(const kernel_index_type i, const kernel_index_type j, const kernel_index_type tile_size, const real_type *tile, real_type *ret, const real_type *d, const kernel_index_type dept, const real_type add) {
+    const kernel_index_type i_end = std::min(tile_size, dept - i);
+    const kernel_index_type j_end = std::min(tile_size, dept - j);
+
+    for (kernel_index_type ii = 0; ii < i_end; ++ii) {
+        real_type ret_iii = 0.0;
+        // the diagonal of a diagonal tile is only added once
+        const kernel_index_type jj_end = i == j ? ii : j_end;
+        for (kernel_index_type jj = 0; jj < jj_end; ++jj) {
+            const real_type temp = tile[ii * tile_size + jj] * add;
+            ret_iii += temp * d[jj + j];
+            if constexpr (use_atomics) {
                 #pragma omp atomic
-                ret[ii + i] += ret_iii;
+                ret[jj + j] += temp * d[ii + i];
+            } else {
+                ret[jj + j] += temp * d[ii + i];
+            }
+        }
+        if (i == j) {
+            ret_iii += tile[ii * tile_size + ii] * add * d[ii + i];
+        }
+        if constexpr (use_atomics) {
+            #pragma omp atomic
+            ret[ii + i] += ret_iii;
+        } else {
+            ret[ii + i] += ret_iii;
+        }
+    }
+}
+
+/**
+ * @brief Return the pointers to the data of all @p vectors, e.g., the columns of a block of right-hand sides.
+ * @tparam Vectors the type of the vectors, possibly const qualified
+ * @param[in] vectors the vectors
+ * @return the pointers to the data of the vectors (`[[nodiscard]]`)
+ */
+template <typename Vectors>
+[[nodiscard]] inline auto data_pointers(Vectors &vectors) {
+    std::vector<decltype(vectors.front().data())> pointers(vectors.size());
+    for (std::size_t c = 0; c < vectors.size(); ++c) {
+        pointers[c] = vectors[c].data();
+    }
+    return pointers;
+}
+
+/**
+ * @brief Process the @p num_tiles lower triangular tiles of the reduced kernel matrix in parallel and accumulate their contributions into all result vectors @p ret using the accumulation @p strategy.
+ * @tparam real_type the type of the data
+ * @tparam TileFunc the type of the function processing one tile
+ * @param[in,out] ret the result vectors, each of size @p dept
+ * @param[in] dept the size of the result vectors
+ * @param[in] num_tiles the number of tiles
+ * @param[in] tile_buffer_size the number of values of the thread-local tile buffer passed to @p tile_func
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in] tile_func called as `tile_func(t, tile_buffer, thread_ret, std::bool_constant<use_atomics>{})` for each tile `t`, where `thread_ret` contains one result vector per vector in @p ret
+ * @return the used accumulation strategy
+ */
+template <typename real_type, typename TileFunc>
+accumulation_strategy tiled_device_kernel(const std::vector<real_type *> &ret, const kernel_index_type dept, const std::size_t num_tiles, const std::size_t tile_buffer_size, const accumulation_strategy strategy, TileFunc tile_func) {
+    const std::size_t num_rhs = ret.size();
+
+    const accumulation_strategy used_strategy = resolve_accumulation_strategy<real_type>(strategy, num_rhs * static_cast<std::size_t>(dept), omp_get_max_threads());
+    const bool thread_private = used_strategy == accumulation_strategy::thread_private;
+    std::vector<std::vector<real_type>> thread_rets(thread_private ? omp_get_max_threads() : 0);
+
+    #pragma omp parallel
+    {
+        std::vector<real_type> tile_buffer(tile_buffer_size);
+        std::vector<real_type *> thread_ret(ret);
+        if (thread_private) {
+            // allocated and first touched by the owning thread, i.e., placed on the thread's NUMA node
+            std::vector<real_type> &buffer = thread_rets[omp_get_thread_num()];
+            buffer.assign(num_rhs * static_cast<std::size_t>(dept), real_type{ 0.0 });
+            for (std::size_t c = 0; c < num_rhs; ++c) {
+                thread_ret[c] = buffer.data() + c * static_cast<std::size_t>(dept);
+            }
+        }
+
+        // the most expensive tiles are scheduled first such that the cheap tiles near the diagonal and at the border balance the load at the end
+        #pragma omp for schedule(dynamic)
+        for (std::size_t t = 0; t < num_tiles; ++t) {
+            if (thread_private) {
+                tile_func(t, tile_buffer.data(), thread_ret, std::false_type{});
+            } else {
+                tile_func(t, tile_buffer.data(), thread_ret, std::true_type{});
+            }
+        }
+
+        if (thread_private) {
+            // reduce the partial results: each thread sums up a contiguous chunk of all thread-private vectors
+            const auto num_threads = static_cast<std::size_t>(omp_get_num_threads());
+            #pragma omp for schedule(static)
+            for (kernel_index_type k = 0; k < dept; ++k) {
+                for (std::size_t c = 0; c < num_rhs; ++c) {
+                    const std::size_t offset = c * static_cast<std::size_t>(dept) + static_cast<std::size_t>(k);
+                    real_type sum = 0.0;
+                    for (std::size_t t = 0; t < num_threads; ++t) {
+                        sum += thread_rets[t][offset];
+                    }
+                    ret[c][k] += sum;
+                }
+            }
+        }
+    }
+
+    return used_strategy;
+}
+
+/**
+ * @brief Calculate the C-SVM kernel for all right-hand sides @p d at once: each tile of the reduced kernel matrix is calculated (or looked up in the @p cache) only once and used for all right-hand sides.
+ * @tparam kernel the kernel type
+ * @tparam real_type the type of the data
+ * @tparam Args additional parameters used in the respective kernel function
+ * @param[in] q the `q` vector
+ * @param[in,out] ret the result vectors, one for each right-hand side
+ * @param[in] d the right-hand sides of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vectors
+ * @param[in] requested_tile_size the size of the tiles the kernel matrix is split into (rounded up to a multiple of the register block size)
+ * @param[in] strategy the strategy used to accumulate the results
+ * @param[in,out] cache if not `nullptr`, the cache used to store and reuse the calculated kernel matrix tiles
+ * @param[in] args additional parameters
+ * @return the used accumulation strategy
+ */
+template <kernel_type kernel, typename real_type, typename... Args>
+accumulation_strategy device_kernel(const std::vector<real_type> &q, const std::vector<real_type *> &ret, const std::vector<const real_type *> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t requested_tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache, const Args... args) {
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+
+    const auto dept = static_cast<kernel_index_type>(q.size());
+    const auto tile_size = static_cast<kernel_index_type>(round_tile_size(requested_tile_size));
+    // the lower triangular tiles ordered by decreasing cost
+    const std::vector<std::pair<std::size_t, std::size_t>> tiles = lower_triangular_tiles(q.size(), static_cast<std::size_t>(tile_size));
+    const kernel_index_type num_features_simd = num_simd_features(data);
+    // O(n * d) compared to the O(n^2 * d) of the kernel matrix
+    const std::vector<real_type> squared_norms = kernel == kernel_type::rbf ? squared_row_norms(data) : std::vector<real_type>{};
+
+    PLSSVM_ASSERT(cache == nullptr || cache->num_tiles() == tiles.size(), "Number of tiles mismatch!: {} != {}", cache == nullptr ? 0 : cache->num_tiles(), tiles.size());
+    PLSSVM_ASSERT(cache == nullptr || cache->tile_size() == static_cast<std::size_t>(tile_size), "Tile sizes mismatch!: {} != {}", cache == nullptr ? 0 : cache->tile_size(), tile_size);
+
+    const accumulation_strategy used_strategy = tiled_device_kernel(ret, dept, tiles.size(), static_cast<std::size_t>(tile_size) * static_cast<std::size_t>(tile_size), strategy, [&](const std::size_t pos, real_type *tile_buffer, const std::vector<real_type *> &thread_ret, const auto use_atomics) {
+        const std::size_t t = cache != nullptr ? cache->tile_at(pos) : pos;
+        const auto i = static_cast<kernel_index_type>(tiles[t].first);
+        const auto j = static_cast<kernel_index_type>(tiles[t].second);
+
+        // only cache misses must be calculated; if no cache slot is available, the tile is calculated in the thread-local buffer
+        typename tile_cache<real_type>::lookup_result cached{ nullptr, false };
+        if (cache != nullptr) {
+            cached = cache->acquire(t);
+        }
+        real_type *tile = cached.tile != nullptr ? cached.tile : tile_buffer;
+        if (!cached.hit) {
+            compute_tile<kernel>(i, j, tile_size, tile, q, data, squared_norms, num_features_simd, QA_cost, cost, args...);
+        }
+        // the tile is still in the cache of the core -> reuse it for all right-hand sides
+        for (std::size_t c = 0; c < d.size(); ++c) {
+            accumulate_tile<decltype(use_atomics)::value>(i, j, tile_size, tile, thread_ret[c], d[c], dept, add);
+        }
+        if (cached.tile != nullptr) {
+            cache->release(t);
+        }
+    });
+
+    if (cache != nullptr) {
+        cache->finish_sweep();
+    }
+    return used_strategy;
+}
+
+/**
+ * @brief Calculate the C-SVM kernel for all right-hand sides @p d at once using the explicitly assembled @p matrix, i.e., each tile is read from memory only once.
+ * @tparam real_type the type of the data
+ * @param[in] matrix the explicitly assembled reduced kernel matrix
+ * @param[in,out] ret the result vectors, one for each right-hand side
+ * @param[in] d the right-hand sides of the equation
+ * @param[in] add denotes whether the values are added or subtracted from the result vectors
+ * @param[in] strategy the strategy used to accumulate the results
+ * @return the used accumulation strategy
+ */
+template <typename real_type>
+accumulation_strategy device_kernel_explicit(const kernel_matrix<real_type> &matrix, const std::vector<real_type *> &ret, const std::vector<const real_type *> &d, const real_type add, const accumulation_strategy strategy) {
+    PLSSVM_ASSERT(matrix.data != nullptr, "The kernel matrix hasn't been assembled!");
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+
+    const auto dept = static_cast<kernel_index_type>(matrix.dept);
+    const auto tile_size = static_cast<kernel_index_type>(matrix.tile_size);
+    const std::size_t tile_entries = matrix.tile_size * matrix.tile_size;
+    return tiled_device_kernel(ret, dept, matrix.tiles.size(), 0, strategy, [&](const std::size_t t, real_type *, const std::vector<real_type *> &thread_ret, const auto use_atomics) {
+        const auto i = static_cast<kernel_index_type>(matrix.tiles[t].first);
+        const auto j = static_cast<kernel_index_type>(matrix.tiles[t].second);
+        for (std::size_t c = 0; c < d.size(); ++c) {
+            accumulate_tile<decltype(use_atomics)::value>(i, j, tile_size, matrix.data.get() + t * tile_entries, thread_ret[c], d[c], dept, add);
+        }
+    });
+}
+
+template <kernel_type kernel, typename real_type, typename... Args>
+kernel_matrix<real_type> assemble_kernel_matrix(const std::vector<real_type> &q, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const std::size_t requested_tile_size, const Args... args) {
+    const auto tile_size = static_cast<kernel_index_type>(round_tile_size(requested_tile_size));
+    const std::size_t tile_entries = static_cast<std::size_t>(tile_size) * static_cast<std::size_t>(tile_size);
+    const kernel_index_type num_features_simd = num_simd_features(data);
+    const std::vector<real_type> squared_norms = kernel == kernel_type::rbf ? squared_row_norms(data) : std::vector<real_type>{};
+
+    kernel_matrix<real_type> matrix;
+    matrix.dept = q.size();
+    matrix.tile_size = static_cast<std::size_t>(tile_size);
+    matrix.tiles = lower_triangular_tiles(matrix.dept, matrix.tile_size);
+    // intentionally not value-initialized: each tile is first touched by the thread calculating it
+    matrix.data = std::unique_ptr<real_type[]>(new real_type[matrix.tiles.size() * tile_entries]);
+
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t t = 0; t < matrix.tiles.size(); ++t) {
+        compute_tile<kernel>(static_cast<kernel_index_type>(matrix.tiles[t].first), static_cast<kernel_index_type>(matrix.tiles[t].second), tile_size, matrix.data.get() + t * tile_entries, q, data, squared_norms, num_features_simd, QA_cost, cost, args...);
+    }
+
+    return matrix;
+}
+
+/**
+ * @brief Predict the decision values of all @p points using the rbf kernel function: the dot products between the points and the data points are calculated tile by tile
+ *        using the same GEMM micro-kernel as the kernel matrix and transformed to squared euclidean distances using the squared norms of the rows.
+ * @tparam real_type the type of the data
+ * @tparam Args additional parameters used in the rbf kernel function
+ * @param[in,out] out the decision values, the contributions of all data points are added
+ * @param[in] data the data points of the model
+ * @param[in] alpha the weights of the data points
+ * @param[in] points the points to predict
+ * @param[in] requested_tile_size the size of the tiles (rounded up to a multiple of the register block size)
+ * @param[in] args additional parameters
+ */
+template <typename real_type, typename... Args>
+void device_kernel_predict_radial(std::vector<real_type> &out, const aos_matrix<real_type> &data, const std::vector<real_type> &alpha, const aos_matrix<real_type> &points, const std::size_t requested_tile_size, const Args... args) {
+    using simd_type = simd::vec<real_type>;
+    // round the feature block size up to a multiple of the SIMD width
+    constexpr kernel_index_type FEATURE_BLOCK_SIZE = (OPENMP_FEATURE_BLOCK_SIZE + simd_type::width - 1) / simd_type::width * simd_type::width;
+
+    const auto tile_size = static_cast<kernel_index_type>(round_tile_size(requested_tile_size));
+    const auto num_data_points = static_cast<kernel_index_type>(data.num_rows());
+    const auto num_points = static_cast<kernel_index_type>(points.num_rows());
+    const auto num_features = static_cast<kernel_index_type>(data.num_cols());
+    // the padding of both matrices must be used
+    const kernel_index_type num_features_simd = std::min(num_simd_features(data), num_simd_features(points));
+
+    const std::vector<real_type> data_norms = squared_row_norms(data);
+    const std::vector<real_type> point_norms = squared_row_norms(points);
+
+    #pragma omp parallel
+    {
+        std::vector<real_type> tile(static_cast<std::size_t>(tile_size) * static_cast<std::size_t>(tile_size));
+
+        #pragma omp for schedule(dynamic)
+        for (kernel_index_type i = 0; i < num_points; i += tile_size) {
+            const kernel_index_type i_end = std::min(tile_size, num_points - i);
+            for (kernel_index_type j = 0; j < num_data_points; j += tile_size) {
+                const kernel_index_type j_end = std::min(tile_size, num_data_points - j);
+
+#if defined(PLSSVM_HAS_BLAS)
+                if (::plssvm::detail::blas::is_enabled_for(num_features, points.num_cols_padded(), data.num_cols_padded(), tile_size)) {
+                    ::plssvm::detail::blas::gemm_nt(static_cast<std::size_t>(i_end), static_cast<std::size_t>(j_end), static_cast<std::size_t>(num_features), real_type{ 1.0 }, points.row_data(i), points.num_cols_padded(), data.row_data(j), data.num_cols_padded(), real_type{ 0.0 }, tile.data(), static_cast<std::size_t>(tile_size));
+                } else
+#endif
+                {
+                    // accumulate the dot products of the current tile, feature block by feature block
+                    std::fill(tile.begin(), tile.end(), real_type{ 0.0 });
+                    for (kernel_index_type f = 0; f < num_features_simd; f += FEATURE_BLOCK_SIZE) {
+                        const kernel_index_type f_end = std::min(f + FEATURE_BLOCK_SIZE, num_features_simd);
+                        for (kernel_index_type ii = 0; ii < i_end; ii += REGISTER_BLOCK_SIZE) {
+                            for (kernel_index_type jj = 0; jj < j_end; jj += REGISTER_BLOCK_SIZE) {
+                                // points outside the matrices are clamped to the last point; their results are discarded
+                                std::array<const real_type *, REGISTER_BLOCK_SIZE> x_i{};
+                                std::array<const real_type *, REGISTER_BLOCK_SIZE> x_j{};
+                                for (kernel_index_type b = 0; b < REGISTER_BLOCK_SIZE; ++b) {
+                                    x_i[b] = points.row_data(std::min(i + ii + b, num_points - 1));
+                                    x_j[b] = data.row_data(std::min(j + jj + b, num_data_points - 1));
+                                }
+                                register_block(x_i, x_j, f, f_end, tile.data() + ii * tile_size + jj, tile_size);
+                            }
+                        }
+                    }
+                    // remaining features of an unpadded matrix
+                    for (kernel_index_type ii = 0; ii < i_end && num_features_simd < num_features; ++ii) {
+                        for (kernel_index_type jj = 0; jj < j_end; ++jj) {
+                            const real_type *x_i = points.row_data(i + ii);
+                            const real_type *x_j = data.row_data(j + jj);
+                            for (kernel_index_type f = num_features_simd; f < num_features; ++f) {
+                                tile[ii * tile_size + jj] += x_i[f] * x_j[f];
+                            }
+                        }
+                    }
+                }
+
+                // apply the kernel function and weight the data points
+                for (kernel_index_type ii = 0; ii < i_end; ++ii) {
+                    real_type temp{ 0.0 };
+                    #pragma omp simd reduction(+ : temp)
+                    for (kernel_index_type jj = 0; jj < j_end; ++jj) {
+                        const real_type value = squared_distance_from_dot(tile[ii * tile_size + jj], point_norms[i + ii], data_norms[j + jj]);
+                        temp += alpha[j + jj] * apply_kernel_function<kernel_type::rbf>(value, args...);
+                    }
+                    out[i + ii] += temp;
+                }
             }
         }
     }
@@ -48,25 +567,188 @@ void device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret,
 
 }  // namespace detail
 
+std::ostream &operator<<(std::ostream &out, const accumulation_strategy strategy) {
+    switch (strategy) {
+        case accumulation_strategy::automatic:
+            return out << "automatic";
+        case accumulation_strategy::thread_private:
+            return out << "thread_private";
+        case accumulation_strategy::atomic:
+            return out << "atomic";
+    }
+    return out << "unknown";
+}
+
+std::size_t round_tile_size(const std::size_t tile_size) {
+    PLSSVM_ASSERT(tile_size > 0, "The tile size must be greater than 0!");
+    constexpr auto block_size = static_cast<std::size_t>(detail::REGISTER_BLOCK_SIZE);
+    return (tile_size + block_size - 1) / block_size * block_size;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> lower_triangular_tiles(const std::size_t dept, const std::size_t tile_size) {
+    PLSSVM_ASSERT(tile_size > 0, "The tile size must be greater than 0!");
+
+    const std::size_t num_tile_rows = (dept + tile_size - 1) / tile_size;
+    std::vector<std::pair<std::size_t, std::size_t>> tiles;
+    tiles.reserve(num_tile_rows * (num_tile_rows + 1) / 2);
+    for (std::size_t row = 0; row < num_tile_rows; ++row) {
+        for (std::size_t col = 0; col <= row; ++col) {
+            tiles.emplace_back(row * tile_size, col * tile_size);
+        }
+    }
+
+    // the cost of a tile is the number of kernel matrix entries that must be calculated
+    const auto tile_cost = [=](const std::pair<std::size_t, std::size_t> &t) {
+        const std::size_t num_rows = std::min(tile_size, dept - t.first);
+        const std::size_t num_cols = std::min(tile_size, dept - t.second);
+        return t.first == t.second ? num_rows * (num_rows + 1) / 2 : num_rows * num_cols;
+    };
+    std::stable_sort(tiles.begin(), tiles.end(), [&](const auto &lhs, const auto &rhs) { return tile_cost(lhs) > tile_cost(rhs); });
+
+    return tiles;
+}
+
+template <typename real_type>
+accumulation_strategy resolve_accumulation_strategy(const accumulation_strategy strategy, const std::size_t dept, const int num_threads) {
+    // upper bound for the additional memory (in bytes) of all thread-private result vectors
+    constexpr std::size_t thread_private_memory_limit = std::size_t{ 1024 } * 1024 * 1024;
+
+    if (strategy != accumulation_strategy::automatic) {
+        return strategy;
+    }
+    return static_cast<std::size_t>(num_threads) * dept * sizeof(real_type) <= thread_private_memory_limit ? accumulation_strategy::thread_private : accumulation_strategy::atomic;
+}
+template accumulation_strategy resolve_accumulation_strategy<float>(const accumulation_strategy, const std::size_t, const int);
+template accumulation_strategy resolve_accumulation_strategy<double>(const accumulation_strategy, const std::size_t, const int);
+
+template <typename real_type>
+accumulation_strategy device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache) {
+    return detail::device_kernel<kernel_type::linear>(q, { ret.data() }, { d.data() }, data, QA_cost, cost, add, tile_size, strategy, cache);
+}
+template accumulation_strategy device_kernel_linear(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const aos_matrix<float> &, const float, const float, const float, const std::size_t, const accumulation_strategy, tile_cache<float> *);
+template accumulation_strategy device_kernel_linear(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const aos_matrix<double> &, const double, const double, const double, const std::size_t, const accumulation_strategy, tile_cache<double> *);
+
+template <typename real_type>
+accumulation_strategy device_kernel_linear(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache) {
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+    PLSSVM_ASSERT(std::all_of(d.begin(), d.end(), [&](const std::vector<real_type> &vec) { return vec.size() == q.size(); }), "All right-hand sides must have {} values!", q.size());
+    PLSSVM_ASSERT(std::all_of(ret.begin(), ret.end(), [&](const std::vector<real_type> &vec) { return vec.size() == q.size(); }), "All result vectors must have {} values!", q.size());
+
+    return detail::device_kernel<kernel_type::linear>(q, detail::data_pointers(ret), detail::data_pointers(d), data, QA_cost, cost, add, tile_size, strategy, cache);
+}
+template accumulation_strategy device_kernel_linear(const std::vector<float> &, std::vector<std::vector<float>> &, const std::vector<std::vector<float>> &, const aos_matrix<float> &, const float, const float, const float, const std::size_t, const accumulation_strategy, tile_cache<float> *);
+template accumulation_strategy device_kernel_linear(const std::vector<double> &, std::vector<std::vector<double>> &, const std::vector<std::vector<double>> &, const aos_matrix<double> &, const double, const double, const double, const std::size_t, const accumulation_strategy, tile_cache<double> *);
+
 template <typename real_type>
-void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add) {
-    detail::device_kernel<kernel_type::linear>(q, ret, d, data, QA_cost, cost, add);
+accumulation_strategy device_kernel_poly(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const int degree, const real_type gamma, const real_type coef0, const std::size_t tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache) {
+    return ::plssvm::detail::dispatch_degree(degree, [&](const auto degree_value) {
+        return detail::device_kernel<kernel_type::polynomial>(q, { ret.data() }, { d.data() }, data, QA_cost, cost, add, tile_size, strategy, cache, degree_value, gamma, coef0);
+    });
 }
-template void device_kernel_linear(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, const float, const float, const float);
-template void device_kernel_linear(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, const double, const double, const double);
+template accumulation_strategy device_kernel_poly(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const aos_matrix<float> &, const float, const float, const float, const int, const float, const float, const std::size_t, const accumulation_strategy, tile_cache<float> *);
+template accumulation_strategy device_kernel_poly(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const aos_matrix<double> &, const double, const double, const double, const int, const double, const double, const std::size_t, const accumulation_strategy, tile_cache<double> *);
 
 template <typename real_type>
-void device_kernel_poly(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const int degree, const real_type gamma, const real_type coef0) {
-    detail::device_kernel<kernel_type::polynomial>(q, ret, d, data, QA_cost, cost, add, degree, gamma, coef0);
+accumulation_strategy device_kernel_poly(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const int degree, const real_type gamma, const real_type coef0, const std::size_t tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache) {
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+    PLSSVM_ASSERT(std::all_of(d.begin(), d.end(), [&](const std::vector<real_type> &vec) { return vec.size() == q.size(); }), "All right-hand sides must have {} values!", q.size());
+    PLSSVM_ASSERT(std::all_of(ret.begin(), ret.end(), [&](const std::vector<real_type> &vec) { return vec.size() == q.size(); }), "All result vectors must have {} values!", q.size());
+
+    return ::plssvm::detail::dispatch_degree(degree, [&](const auto degree_value) {
+        return detail::device_kernel<kernel_type::polynomial>(q, detail::data_pointers(ret), detail::data_pointers(d), data, QA_cost, cost, add, tile_size, strategy, cache, degree_value, gamma, coef0);
+    });
+}
+template accumulation_strategy device_kernel_poly(const std::vector<float> &, std::vector<std::vector<float>> &, const std::vector<std::vector<float>> &, const aos_matrix<float> &, const float, const float, const float, const int, const float, const float, const std::size_t, const accumulation_strategy, tile_cache<float> *);
+template accumulation_strategy device_kernel_poly(const std::vector<double> &, std::vector<std::vector<double>> &, const std::vector<std::vector<double>> &, const aos_matrix<double> &, const double, const double, const double, const int, const double, const double, const std::size_t, const accumulation_strategy, tile_cache<double> *);
+
+template <typename real_type>
+accumulation_strategy device_kernel_radial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma, const std::size_t tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache, const bool fast_exp) {
+    return ::plssvm::detail::dispatch_fast_exp(fast_exp, [&](const auto fast_exp_value) {
+        return detail::device_kernel<kernel_type::rbf>(q, { ret.data() }, { d.data() }, data, QA_cost, cost, add, tile_size, strategy, cache, gamma, fast_exp_value);
+    });
 }
-template void device_kernel_poly(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, const float, const float, const float, const int, const float, const float);
-template void device_kernel_poly(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, const double, const double, const double, const int, const double, const double);
+template accumulation_strategy device_kernel_radial(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const aos_matrix<float> &, const float, const float, const float, const float, const std::size_t, const accumulation_strategy, tile_cache<float> *, const bool);
+template accumulation_strategy device_kernel_radial(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const aos_matrix<double> &, const double, const double, const double, const double, const std::size_t, const accumulation_strategy, tile_cache<double> *, const bool);
 
 template <typename real_type>
-void device_kernel_radial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma) {
-    detail::device_kernel<kernel_type::rbf>(q, ret, d, data, QA_cost, cost, add, gamma);
+accumulation_strategy device_kernel_radial(const std::vector<real_type> &q, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma, const std::size_t tile_size, const accumulation_strategy strategy, tile_cache<real_type> *cache, const bool fast_exp) {
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+    PLSSVM_ASSERT(std::all_of(d.begin(), d.end(), [&](const std::vector<real_type> &vec) { return vec.size() == q.size(); }), "All right-hand sides must have {} values!", q.size());
+    PLSSVM_ASSERT(std::all_of(ret.begin(), ret.end(), [&](const std::vector<real_type> &vec) { return vec.size() == q.size(); }), "All result vectors must have {} values!", q.size());
+
+    return ::plssvm::detail::dispatch_fast_exp(fast_exp, [&](const auto fast_exp_value) {
+        return detail::device_kernel<kernel_type::rbf>(q, detail::data_pointers(ret), detail::data_pointers(d), data, QA_cost, cost, add, tile_size, strategy, cache, gamma, fast_exp_value);
+    });
+}
+template accumulation_strategy device_kernel_radial(const std::vector<float> &, std::vector<std::vector<float>> &, const std::vector<std::vector<float>> &, const aos_matrix<float> &, const float, const float, const float, const float, const std::size_t, const accumulation_strategy, tile_cache<float> *, const bool);
+template accumulation_strategy device_kernel_radial(const std::vector<double> &, std::vector<std::vector<double>> &, const std::vector<std::vector<double>> &, const aos_matrix<double> &, const double, const double, const double, const double, const std::size_t, const accumulation_strategy, tile_cache<double> *, const bool);
+
+template <typename real_type>
+std::size_t kernel_matrix_size(const std::size_t dept, const std::size_t tile_size) {
+    const std::size_t used_tile_size = round_tile_size(tile_size);
+    const std::size_t num_tile_rows = (dept + used_tile_size - 1) / used_tile_size;
+    return num_tile_rows * (num_tile_rows + 1) / 2 * used_tile_size * used_tile_size * sizeof(real_type);
+}
+template std::size_t kernel_matrix_size<float>(const std::size_t, const std::size_t);
+template std::size_t kernel_matrix_size<double>(const std::size_t, const std::size_t);
+
+template <typename real_type>
+kernel_matrix<real_type> assemble_kernel_matrix_linear(const std::vector<real_type> &q, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const std::size_t tile_size) {
+    return detail::assemble_kernel_matrix<kernel_type::linear>(q, data, QA_cost, cost, tile_size);
+}
+template kernel_matrix<float> assemble_kernel_matrix_linear(const std::vector<float> &, const aos_matrix<float> &, const float, const float, const std::size_t);
+template kernel_matrix<double> assemble_kernel_matrix_linear(const std::vector<double> &, const aos_matrix<double> &, const double, const double, const std::size_t);
+
+template <typename real_type>
+kernel_matrix<real_type> assemble_kernel_matrix_poly(const std::vector<real_type> &q, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const int degree, const real_type gamma, const real_type coef0, const std::size_t tile_size) {
+    return ::plssvm::detail::dispatch_degree(degree, [&](const auto degree_value) {
+        return detail::assemble_kernel_matrix<kernel_type::polynomial>(q, data, QA_cost, cost, tile_size, degree_value, gamma, coef0);
+    });
+}
+template kernel_matrix<float> assemble_kernel_matrix_poly(const std::vector<float> &, const aos_matrix<float> &, const float, const float, const int, const float, const float, const std::size_t);
+template kernel_matrix<double> assemble_kernel_matrix_poly(const std::vector<double> &, const aos_matrix<double> &, const double, const double, const int, const double, const double, const std::size_t);
+
+template <typename real_type>
+kernel_matrix<real_type> assemble_kernel_matrix_radial(const std::vector<real_type> &q, const aos_matrix<real_type> &data, const real_type QA_cost, const real_type cost, const real_type gamma, const std::size_t tile_size, const bool fast_exp) {
+    return ::plssvm::detail::dispatch_fast_exp(fast_exp, [&](const auto fast_exp_value) {
+        return detail::assemble_kernel_matrix<kernel_type::rbf>(q, data, QA_cost, cost, tile_size, gamma, fast_exp_value);
+    });
+}
+template kernel_matrix<float> assemble_kernel_matrix_radial(const std::vector<float> &, const aos_matrix<float> &, const float, const float, const float, const std::size_t, const bool);
+template kernel_matrix<double> assemble_kernel_matrix_radial(const std::vector<double> &, const aos_matrix<double> &, const double, const double, const double, const std::size_t, const bool);
+
+template <typename real_type>
+void device_kernel_predict_radial(std::vector<real_type> &out, const aos_matrix<real_type> &data, const std::vector<real_type> &alpha, const aos_matrix<real_type> &points, const real_type gamma, const std::size_t tile_size, const bool fast_exp) {
+    PLSSVM_ASSERT(out.size() == points.num_rows(), "Sizes mismatch!: {} != {}", out.size(), points.num_rows());
+    PLSSVM_ASSERT(alpha.size() == data.num_rows(), "Sizes mismatch!: {} != {}", alpha.size(), data.num_rows());
+    PLSSVM_ASSERT(data.num_cols() == points.num_cols(), "Sizes mismatch!: {} != {}", data.num_cols(), points.num_cols());
+
+    ::plssvm::detail::dispatch_fast_exp(fast_exp, [&](const auto fast_exp_value) {
+        detail::device_kernel_predict_radial(out, data, alpha, points, tile_size, gamma, fast_exp_value);
+    });
+}
+template void device_kernel_predict_radial(std::vector<float> &, const aos_matrix<float> &, const std::vector<float> &, const aos_matrix<float> &, const float, const std::size_t, const bool);
+template void device_kernel_predict_radial(std::vector<double> &, const aos_matrix<double> &, const std::vector<double> &, const aos_matrix<double> &, const double, const std::size_t, const bool);
+
+template <typename real_type>
+accumulation_strategy device_kernel_explicit(const kernel_matrix<real_type> &matrix, std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add, const accumulation_strategy strategy) {
+    PLSSVM_ASSERT(matrix.dept == d.size(), "Sizes mismatch!: {} != {}", matrix.dept, d.size());
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+
+    return detail::device_kernel_explicit(matrix, { ret.data() }, { d.data() }, add, strategy);
+}
+template accumulation_strategy device_kernel_explicit(const kernel_matrix<float> &, std::vector<float> &, const std::vector<float> &, const float, const accumulation_strategy);
+template accumulation_strategy device_kernel_explicit(const kernel_matrix<double> &, std::vector<double> &, const std::vector<double> &, const double, const accumulation_strategy);
+
+template <typename real_type>
+accumulation_strategy device_kernel_explicit(const kernel_matrix<real_type> &matrix, std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const real_type add, const accumulation_strategy strategy) {
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+    PLSSVM_ASSERT(std::all_of(d.begin(), d.end(), [&](const std::vector<real_type> &vec) { return vec.size() == matrix.dept; }), "All right-hand sides must have {} values!", matrix.dept);
+    PLSSVM_ASSERT(std::all_of(ret.begin(), ret.end(), [&](const std::vector<real_type> &vec) { return vec.size() == matrix.dept; }), "All result vectors must have {} values!", matrix.dept);
+
+    return detail::device_kernel_explicit(matrix, detail::data_pointers(ret), detail::data_pointers(d), add, strategy);
 }
-template void device_kernel_radial(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, const float, const float, const float, const float);
-template void device_kernel_radial(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, const double, const double, const double, const double);
+template accumulation_strategy device_kernel_explicit(const kernel_matrix<float> &, std::vector<std::vector<float>> &, const std::vector<std::vector<float>> &, const float, const accumulation_strategy);
+template accumulation_strategy device_kernel_explicit(const kernel_matrix<double> &, std::vector<std::vector<double>> &, const std::vector<std::vector<double>> &, const double, const accumulation_strategy);
 
 }  // namespace plssvm::openmp
@@ -0,0 +1,85 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/tile_cache.hpp"
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include <algorithm>  // std::min
+#include <cstddef>    // std::size_t
+#include <mutex>      // std::lock_guard
+#include <vector>     // std::vector
+
+namespace plssvm::openmp {
+
+template <typename T>
+tile_cache<T>::tile_cache(const std::size_t num_tiles, const std::size_t tile_size, const std::size_t cache_size) :
+    num_tiles_{ num_tiles }, tile_size_{ tile_size } {
+    PLSSVM_ASSERT(tile_size_ > 0, "The tile size must be greater than 0!");
+
+    const std::size_t num_slots = std::min(num_tiles_, cache_size / (tile_size_ * tile_size_ * sizeof(real_type)));
+    slot_of_tile_.assign(num_tiles_, num_slots);
+    tile_of_slot_.assign(num_slots, num_tiles_);
+    pin_count_.assign(num_slots, 0);
+    lru_pos_.reserve(num_slots);
+    for (std::size_t slot = 0; slot < num_slots; ++slot) {
+        lru_pos_.push_back(lru_list_.insert(lru_list_.end(), slot));
+    }
+    // intentionally not value-initialized: each slot is first touched by the thread calculating the cached tile
+    data_ = std::unique_ptr<real_type[]>(new real_type[num_slots * tile_size_ * tile_size_]);
+}
+
+template <typename T>
+auto tile_cache<T>::acquire(const std::size_t tile) -> lookup_result {
+    PLSSVM_ASSERT(tile < num_tiles_, "Out-of-bounce access!: {} >= {}", tile, num_tiles_);
+
+    const std::lock_guard<std::mutex> lock{ mutex_ };
+    std::size_t slot = slot_of_tile_[tile];
+    const bool hit = slot < capacity();
+    if (hit) {
+        ++num_hits_;
+    } else {
+        ++num_misses_;
+        // find the least recently used slot that isn't pinned by another thread
+        auto it = lru_list_.rbegin();
+        while (it != lru_list_.rend() && pin_count_[*it] > 0) {
+            ++it;
+        }
+        if (it == lru_list_.rend()) {
+            // all slots are in use -> the tile can't be cached
+            return { nullptr, false };
+        }
+        slot = *it;
+        // evict the old tile
+        if (tile_of_slot_[slot] < num_tiles_) {
+            slot_of_tile_[tile_of_slot_[slot]] = capacity();
+        }
+        tile_of_slot_[slot] = tile;
+        slot_of_tile_[tile] = slot;
+    }
+    // mark the slot as the most recently used one
+    lru_list_.splice(lru_list_.begin(), lru_list_, lru_pos_[slot]);
+    ++pin_count_[slot];
+    return { data_.get() + slot * tile_size_ * tile_size_, hit };
+}
+
+template <typename T>
+void tile_cache<T>::release(const std::size_t tile) {
+    PLSSVM_ASSERT(tile < num_tiles_, "Out-of-bounce access!: {} >= {}", tile, num_tiles_);
+
+    const std::lock_guard<std::mutex> lock{ mutex_ };
+    PLSSVM_ASSERT(slot_of_tile_[tile] < capacity(), "Tile {} isn't cached!", tile);
+    PLSSVM_ASSERT(pin_count_[slot_of_tile_[tile]] > 0, "Tile {} isn't pinned!", tile);
+    --pin_count_[slot_of_tile_[tile]];
+}
+
+// explicitly instantiate template class
+template class tile_cache<float>;
+template class tile_cache<double>;
+
+}  // namespace plssvm::openmp
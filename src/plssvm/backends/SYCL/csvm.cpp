@@ -18,6 +18,7 @@
 #include "plssvm/constants.hpp"                        // plssvm::kernel_index_type
 #include "plssvm/detail/assert.hpp"                    // PLSSVM_ASSERT
 #include "plssvm/detail/execution_range.hpp"           // plssvm::detail::execution_range
+#include "plssvm/detail/integer_pow.hpp"               // plssvm::detail::dispatch_degree, plssvm::detail::unrolled_degree_v
 #include "plssvm/exceptions/exceptions.hpp"            // plssvm::exception
 #include "plssvm/kernel_types.hpp"                     // plssvm::kernel_type
 #include "plssvm/parameter.hpp"                        // plssvm::parameter
@@ -140,7 +141,9 @@ void csvm<T>::run_q_kernel(const std::size_t device, const ::plssvm::detail::exe
             break;
         case kernel_type::polynomial:
             PLSSVM_ASSERT(device == 0, "The polynomial kernel function currently only supports single GPU execution!");
-            devices_[device].parallel_for(execution_range, device_kernel_q_poly(q_d.get(), data_d_[device].get(), data_last_d_[device].get(), num_rows_, num_cols_, degree_, gamma_, coef0_));
+            ::plssvm::detail::dispatch_degree(degree_, [&](const auto degree) {
+                devices_[device].parallel_for(execution_range, device_kernel_q_poly<real_type, ::plssvm::detail::unrolled_degree_v<decltype(degree)>>(q_d.get(), data_d_[device].get(), data_last_d_[device].get(), num_rows_, num_cols_, degree_, gamma_, coef0_));
+            });
             break;
         case kernel_type::rbf:
             PLSSVM_ASSERT(device == 0, "The radial basis function kernel function currently only supports single GPU execution!");
@@ -160,8 +163,10 @@ void csvm<T>::run_svm_kernel(const std::size_t device, const ::plssvm::detail::e
             break;
         case kernel_type::polynomial:
             PLSSVM_ASSERT(device == 0, "The polynomial kernel function currently only supports single GPU execution!");
-            devices_[device].submit([&](::sycl::handler &cgh) {
-                cgh.parallel_for(execution_range, device_kernel_poly(cgh, q_d.get(), r_d.get(), x_d.get(), data_d_[device].get(), QA_cost_, 1 / cost_, num_rows_, num_cols_, add, degree_, gamma_, coef0_));
+            ::plssvm::detail::dispatch_degree(degree_, [&](const auto degree) {
+                devices_[device].submit([&](::sycl::handler &cgh) {
+                    cgh.parallel_for(execution_range, device_kernel_poly<real_type, ::plssvm::detail::unrolled_degree_v<decltype(degree)>>(cgh, q_d.get(), r_d.get(), x_d.get(), data_d_[device].get(), QA_cost_, 1 / cost_, num_rows_, num_cols_, add, degree_, gamma_, coef0_));
+                });
             });
             break;
         case kernel_type::rbf:
@@ -186,7 +191,9 @@ void csvm<T>::run_predict_kernel(const ::plssvm::detail::execution_range &range,
         case kernel_type::linear:
             break;
         case kernel_type::polynomial:
-            devices_[0].parallel_for(execution_range, device_kernel_predict_poly(out_d.get(), data_d_[0].get(), data_last_d_[0].get(), alpha_d.get(), num_data_points_, point_d.get(), num_predict_points, num_features_, degree_, gamma_, coef0_));
+            ::plssvm::detail::dispatch_degree(degree_, [&](const auto degree) {
+                devices_[0].parallel_for(execution_range, device_kernel_predict_poly<real_type, ::plssvm::detail::unrolled_degree_v<decltype(degree)>>(out_d.get(), data_d_[0].get(), data_last_d_[0].get(), alpha_d.get(), num_data_points_, point_d.get(), num_predict_points, num_features_, degree_, gamma_, coef0_));
+            });
             break;
         case kernel_type::rbf:
             devices_[0].parallel_for(execution_range, device_kernel_predict_radial(out_d.get(), data_d_[0].get(), data_last_d_[0].get(), alpha_d.get(), num_data_points_, point_d.get(), num_predict_points, num_features_, gamma_));
@@ -1,11 +1,16 @@
 #include "plssvm/backends/gpu_csvm.hpp"
 
-#include "plssvm/constants.hpp"               // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
-#include "plssvm/csvm.hpp"                    // plssvm::csvm
-#include "plssvm/detail/execution_range.hpp"  // plssvm::detail::execution_range
-#include "plssvm/detail/operators.hpp"        // various operator overloads for std::vector and scalars
-#include "plssvm/exceptions/exceptions.hpp"   // plssvm::exception
-#include "plssvm/parameter.hpp"               // plssvm::parameter
+#include "plssvm/constants.hpp"                    // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/csvm.hpp"                         // plssvm::csvm
+#include "plssvm/detail/execution_range.hpp"       // plssvm::detail::execution_range
+#include "plssvm/detail/operators.hpp"             // various operator overloads for std::vector and scalars
+#include "plssvm/detail/preconditioner.hpp"        // plssvm::detail::preconditioner
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::exception
+#include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix, plssvm::soa_matrix
+#include "plssvm/parameter.hpp"                    // plssvm::parameter
+#include "plssvm/solver_types.hpp"                 // plssvm::solver_type
 
 #if defined(PLSSVM_HAS_CUDA_BACKEND)
     // used for explicitly instantiating the CUDA backend
@@ -22,46 +27,52 @@
     #include "sycl/sycl.hpp"
 #endif
 
-#include <algorithm>  // std::all_of, std::min
+#include <algorithm>  // std::min
 #include <cmath>      // std::ceil
 #include <cstddef>    // std::size_t
+#include <memory>     // std::unique_ptr
 #include <vector>     // std::vector
 
 namespace plssvm::detail {
 
 template <typename T, typename device_ptr_t, typename queue_t>
 gpu_csvm<T, device_ptr_t, queue_t>::gpu_csvm(const parameter<T> &params) :
-    base_type{ params } {}
+    base_type{ params } {
+    // the explicit kernel matrix is currently only implemented in the OpenMP backend; automatic always resolves to the implicit solver
+    if (solver_ == solver_type::cg_explicit) {
+        throw exception{ "The cg_explicit solver is currently only supported by the OpenMP backend!" };
+    }
+}
 
 template <typename T, typename device_ptr_t, typename queue_t>
-auto gpu_csvm<T, device_ptr_t, queue_t>::predict(const std::vector<std::vector<real_type>> &points) -> std::vector<real_type> {
+auto gpu_csvm<T, device_ptr_t, queue_t>::predict(const aos_matrix<real_type> &points) -> std::vector<real_type> {
     using namespace plssvm::operators;
 
     PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
     PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
 
     // return empty vector if there are no points to predict
-    if (points.empty()) {
+    if (points.num_rows() == 0) {
         return std::vector<real_type>{};
     }
 
     // sanity checks
-    if (!std::all_of(points.begin(), points.end(), [&](const std::vector<real_type> &point) { return point.size() == points.front().size(); })) {
-        throw exception{ "All points in the prediction point vector must have the same number of features!" };
-    } else if (points.front().size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", data_ptr_->front().size(), points.front().size()) };
+    if (points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.num_cols()) };
     } else if (alpha_ptr_ == nullptr) {
         throw exception{ "No alphas provided for prediction!" };
     }
 
-    PLSSVM_ASSERT(data_ptr_->size() == alpha_ptr_->size(), "Sizes mismatch!: {} != {}", data_ptr_->size(), alpha_ptr_->size());  // exception in constructor
+    PLSSVM_ASSERT(num_data_points_ == alpha_ptr_->size(), "Sizes mismatch!: {} != {}", num_data_points_, alpha_ptr_->size());  // exception in constructor
+
+    const std::size_t num_predict_points = points.num_rows();
 
     // check if data already resides on the first device
     if (data_d_[0].empty()) {
         setup_data_on_device();
     }
 
-    std::vector<real_type> out(points.size());
+    std::vector<real_type> out(num_predict_points);
 
     if (kernel_ == kernel_type::linear) {
         // use faster methode in case of the linear kernel function
@@ -69,31 +80,31 @@ auto gpu_csvm<T, device_ptr_t, queue_t>::predict(const std::vector<std::vector<r
             update_w();
         }
         #pragma omp parallel for
-        for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < points.size(); ++i) {
-            out[i] = transposed<real_type>{ w_ } * points[i] + bias_;
+        for (std::size_t i = 0; i < num_predict_points; ++i) {
+            out[i] = dot(w_.data(), points.row_data(i), num_features_) + bias_;
         }
     } else {
         // create result vector on the device
-        device_ptr_type out_d{ points.size() + THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE, devices_[0] };
+        device_ptr_type out_d{ num_predict_points + THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE, devices_[0] };
         out_d.memset(0);
 
-        // transform prediction data
-        const std::vector<real_type> transformed_data = base_type::transform_data(points, THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE, points.size());
-        device_ptr_type point_d{ points[0].size() * (points.size() + THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE), devices_[0] };
-        point_d.memcpy_to_device(transformed_data, 0, transformed_data.size());
+        // transform prediction data to the SoA layout expected by the predict kernels
+        const soa_matrix<real_type> transformed_points{ points, THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE, 0 };
+        device_ptr_type point_d{ num_features_ * transformed_points.num_rows_padded(), devices_[0] };
+        point_d.memcpy_to_device(transformed_points.data(), 0, num_features_ * transformed_points.num_rows_padded());
 
         // create the weight vector on the device and copy data
         device_ptr_type alpha_d{ num_data_points_ + THREAD_BLOCK_SIZE, devices_[0] };
         alpha_d.memcpy_to_device(*alpha_ptr_.get(), 0, num_data_points_);
 
         const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_data_points_) / static_cast<real_type>(THREAD_BLOCK_SIZE))),
-                                              static_cast<std::size_t>(std::ceil(static_cast<real_type>(points.size()) / static_cast<real_type>(THREAD_BLOCK_SIZE))) },
-                                            { std::min<std::size_t>(THREAD_BLOCK_SIZE, num_data_points_), std::min<std::size_t>(THREAD_BLOCK_SIZE, points.size()) });
+                                              static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_predict_points) / static_cast<real_type>(THREAD_BLOCK_SIZE))) },
+                                            { std::min<std::size_t>(THREAD_BLOCK_SIZE, num_data_points_), std::min<std::size_t>(THREAD_BLOCK_SIZE, num_predict_points) });
 
         // perform prediction on the first device
-        run_predict_kernel(range, out_d, alpha_d, point_d, points.size());
+        run_predict_kernel(range, out_d, alpha_d, point_d, num_predict_points);
 
-        out_d.memcpy_to_host(out, 0, points.size());
+        out_d.memcpy_to_host(out, 0, num_predict_points);
 
         // add bias_ to all predictions
         out += bias_;
@@ -114,21 +125,27 @@ void gpu_csvm<T, device_ptr_t, queue_t>::setup_data_on_device() {
         feature_ranges_.push_back(device * num_cols_ / devices_.size());
     }
 
-    // transform 2D to 1D data
-    const std::vector<real_type> transformed_data = base_type::transform_data(*data_ptr_, boundary_size_, dept_);
-
-    #pragma omp parallel for
+    // only transform the features used on the current device to keep the additional host memory to a single feature slice
     for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
-        const std::size_t num_features = feature_ranges_[device + 1] - feature_ranges_[device];
+        const std::size_t first_feature = feature_ranges_[device];
+        const std::size_t num_features = feature_ranges_[device + 1] - first_feature;
 
         // initialize data_last on device
         data_last_d_[device] = device_ptr_type{ num_features + boundary_size_, devices_[device] };
         data_last_d_[device].memset(0);
-        data_last_d_[device].memcpy_to_device(data_ptr_->back().data() + feature_ranges_[device], 0, num_features);
+        data_last_d_[device].memcpy_to_device(data_ptr_->row_data(dept_) + first_feature, 0, num_features);
+
+        // transform the feature slice from the AoS matrix to a 1D SoA layout, the boundary values are zero
+        std::vector<real_type> transformed_data(num_features * num_rows_, real_type{ 0.0 });
+        #pragma omp parallel for collapse(2)
+        for (std::size_t feature = 0; feature < num_features; ++feature) {
+            for (std::size_t row = 0; row < dept_; ++row) {
+                transformed_data[feature * num_rows_ + row] = (*data_ptr_)(row, first_feature + feature);
+            }
+        }
 
-        const std::size_t device_data_size = num_features * (dept_ + boundary_size_);
-        data_d_[device] = device_ptr_type{ device_data_size, devices_[device] };
-        data_d_[device].memcpy_to_device(transformed_data.data() + feature_ranges_[device] * (dept_ + boundary_size_), 0, device_data_size);
+        data_d_[device] = device_ptr_type{ transformed_data.size(), devices_[device] };
+        data_d_[device].memcpy_to_device(transformed_data, 0, transformed_data.size());
     }
 }
 
@@ -159,13 +176,28 @@ auto gpu_csvm<T, device_ptr_t, queue_t>::generate_q() -> std::vector<real_type>
 }
 
 template <typename T, typename device_ptr_t, typename queue_t>
-auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG(const std::vector<real_type> &b, const std::size_t imax, const real_type eps, const std::vector<real_type> &q) -> std::vector<real_type> {
+auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG(const std::vector<real_type> &b, const std::vector<real_type> &x0, const std::size_t imax, const real_type eps, const std::vector<real_type> &q) -> std::vector<real_type> {
     using namespace plssvm::operators;
 
     PLSSVM_ASSERT(dept_ != 0, "dept_ not initialized! Maybe a call to setup_data_on_device() is missing?");
     PLSSVM_ASSERT(boundary_size_ != 0, "boundary_size_ not initialized! Maybe a call to setup_data_on_device() is missing?");
 
-    std::vector<real_type> x(dept_, 1.0);
+    if (kernel_ == kernel_type::linear) {
+        // the matrix-vector product in the primal space only needs two passes over the data (O(n * d)) per CG iteration
+        // -> computed on the host, since it is bound by the memory bandwidth and doesn't benefit from the O(n^2 * d) device kernels
+        if (print_info_) {
+            fmt::print("Using the primal-space matrix-vector product for the linear kernel.\n");
+        }
+        return base_type::conjugate_gradients(b, x0, imax, eps, q, [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+            base_type::linear_kernel_matvec(q, ret, d, add);
+        });
+    }
+
+    if (mixed_precision_ && print_info_) {
+        fmt::print("Mixed precision is only supported in the OpenMP backend and will be ignored.\n");
+    }
+
+    std::vector<real_type> x(x0);
     std::vector<device_ptr_type> x_d(devices_.size());
 
     std::vector<real_type> r(dept_, 0.0);
@@ -204,12 +236,44 @@ auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG(const std::vector<real_type>
         Ad_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
     }
 
-    std::vector<real_type> d(r);
+    // the tolerance is relative to the residual of the default initial guess (r_d and Ad_d are free until the first iteration)
+    const real_type tolerance = base_type::initial_guess_tolerance(b, x0, eps, [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+        #pragma omp parallel for
+        for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+            r_d[device].memcpy_to_device(d, 0, dept_);
+            r_d[device].memset(0, dept_);
+            Ad_d[device].memset(0);
+
+            run_device_kernel(device, q_d[device], Ad_d[device], r_d[device], add);
+        }
+        device_reduction(Ad_d, Ad);
+
+        ret += Ad;
+    });
+
+    // z = M^-1 * r (the preconditioner is applied on the host)
+    const std::unique_ptr<preconditioner<real_type>> precond = base_type::make_preconditioner(q);
+    std::vector<real_type> z(r);
+    if (precond != nullptr) {
+        precond->apply(r, z);
+    }
+    real_type delta_z = transposed{ r } * z;
+
+    std::vector<real_type> d(z);
+
+    // r_d = d
+    #pragma omp parallel for
+    for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+        r_d[device].memcpy_to_device(d, 0, dept_);
+    }
+
+    residual_replacement<real_type> replacement{ replace_threshold_, replace_interval_ };
+    replacement.reset(delta);
 
     std::size_t run = 0;
     for (; run < imax; ++run) {
         if (print_info_) {
-            fmt::print("Start Iteration {} (max: {}) with current residuum {} (target: {}).\n", run + 1, imax, delta, eps * eps * delta0);
+            fmt::print("Start Iteration {} (max: {}) with current residuum {} (target: {}).\n", run + 1, imax, delta, tolerance * tolerance * delta0);
         }
         // Ad = A * r (q = A * d)
         #pragma omp parallel for
@@ -223,7 +287,7 @@ auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG(const std::vector<real_type>
         device_reduction(Ad_d, Ad);
 
         // (alpha = delta_new / (d^T * q))
-        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+        const real_type alpha_cd = delta_z / (transposed{ d } * Ad);
 
         // (x = x + alpha * d)
         x += alpha_cd * d;
@@ -233,35 +297,49 @@ auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG(const std::vector<real_type>
             x_d[device].memcpy_to_device(x, 0, dept_);
         }
 
-        if (run % 50 == 49) {
+        // r -= alpha_cd * Ad (r = r - alpha * q)
+        r -= alpha_cd * Ad;
+
+        // (delta = r^T * r)
+        delta = transposed{ r } * r;
+
+        // replace the drifting recursively updated residual by the true residual; the convergence is always checked with the true residual
+        if (replacement.replace(delta) || delta <= tolerance * tolerance * delta0) {
             // r = b
             r_d[0].memcpy_to_device(b, 0, dept_);
             #pragma omp parallel for
-            for (typename std::vector<queue_type>::size_type device = 1; device < devices_.size(); ++device) {
-                r_d[device].memset(0);
+            for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+                if (device != 0) {
+                    r_d[device].memset(0);
+                }
 
                 // r -= A * x
                 run_device_kernel(device, q_d[device], r_d[device], x_d[device], -1);
             }
 
             device_reduction(r_d, r);
-        } else {
-            // r -= alpha_cd * Ad (r = r - alpha * q)
-            r -= alpha_cd * Ad;
-        }
 
-        // (delta = r^T * r)
-        const real_type delta_old = delta;
-        delta = transposed{ r } * r;
+            delta = transposed{ r } * r;
+            replacement.reset(delta);
+        }
         // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
+        if (delta <= tolerance * tolerance * delta0) {
             break;
         }
 
+        // (z = M^-1 * r)
+        if (precond != nullptr) {
+            precond->apply(r, z);
+        } else {
+            z = r;
+        }
+        const real_type delta_z_old = delta_z;
+        delta_z = transposed{ r } * z;
+
         // (beta = delta_new / delta_old)
-        const real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
+        const real_type beta = delta_z / delta_z_old;
+        // d = beta * d + z
+        d = beta * d + z;
 
         // r_d = d
         #pragma omp parallel for
@@ -270,12 +348,110 @@ auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG(const std::vector<real_type>
         }
     }
     if (print_info_) {
-        fmt::print("Finished after {} iterations with a residuum of {} (target: {}).\n", run + 1, delta, eps * eps * delta0);
+        fmt::print("Finished after {} iterations with a residuum of {} (target: {}).\n", run + 1, delta, tolerance * tolerance * delta0);
     }
 
     return std::vector<real_type>(x.begin(), x.begin() + dept_);
 }
 
+template <typename T, typename device_ptr_t, typename queue_t>
+auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG_cost_path(const std::vector<real_type> &b, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const std::vector<real_type> &costs) -> std::vector<std::vector<real_type>> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(dept_ != 0, "dept_ not initialized! Maybe a call to setup_data_on_device() is missing?");
+    PLSSVM_ASSERT(boundary_size_ != 0, "boundary_size_ not initialized! Maybe a call to setup_data_on_device() is missing?");
+
+    if (kernel_ == kernel_type::linear) {
+        // the matrix-vector product in the primal space is computed on the host (see solver_CG)
+        if (print_info_) {
+            fmt::print("Using the primal-space matrix-vector product for the linear kernel.\n");
+        }
+        return base_type::multi_shift_conjugate_gradients(b, imax, eps, costs, [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+            base_type::linear_kernel_matvec(q, ret, d, add);
+        });
+    }
+
+    std::vector<device_ptr_type> q_d(devices_.size());
+    std::vector<device_ptr_type> d_d(devices_.size());
+    std::vector<device_ptr_type> Ad_d(devices_.size());
+    #pragma omp parallel for
+    for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+        q_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
+        q_d[device].memset(0);
+        q_d[device].memcpy_to_device(q, 0, dept_);
+
+        d_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
+        d_d[device].memset(0);
+        Ad_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
+    }
+
+    // the multi-shift CG algorithm runs on the host, only the matrix-vector products are calculated on the device(s)
+    std::vector<real_type> Ad(dept_);
+    return base_type::multi_shift_conjugate_gradients(b, imax, eps, costs, [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+        #pragma omp parallel for
+        for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+            d_d[device].memcpy_to_device(d, 0, dept_);
+            Ad_d[device].memset(0);
+
+            run_device_kernel(device, q_d[device], Ad_d[device], d_d[device], add);
+        }
+        device_reduction(Ad_d, Ad);
+
+        ret += Ad;
+    });
+}
+
+template <typename T, typename device_ptr_t, typename queue_t>
+auto gpu_csvm<T, device_ptr_t, queue_t>::solver_CG_block(const std::vector<std::vector<real_type>> &B, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const std::vector<std::size_t> &folds) -> std::vector<std::vector<real_type>> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(dept_ != 0, "dept_ not initialized! Maybe a call to setup_data_on_device() is missing?");
+    PLSSVM_ASSERT(boundary_size_ != 0, "boundary_size_ not initialized! Maybe a call to setup_data_on_device() is missing?");
+
+    if (kernel_ == kernel_type::linear) {
+        // the matrix-vector product in the primal space is computed on the host (see solver_CG)
+        if (print_info_) {
+            fmt::print("Using the primal-space matrix-vector product for the linear kernel.\n");
+        }
+        return base_type::block_conjugate_gradients(B, imax, eps, q, [&](std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const real_type add) {
+            for (typename std::vector<std::vector<real_type>>::size_type c = 0; c < d.size(); ++c) {
+                base_type::linear_kernel_matvec(q, ret[c], d[c], add);
+            }
+        }, folds);
+    }
+
+    std::vector<device_ptr_type> q_d(devices_.size());
+    std::vector<device_ptr_type> d_d(devices_.size());
+    std::vector<device_ptr_type> Ad_d(devices_.size());
+    #pragma omp parallel for
+    for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+        q_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
+        q_d[device].memset(0);
+        q_d[device].memcpy_to_device(q, 0, dept_);
+
+        d_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
+        d_d[device].memset(0);
+        Ad_d[device] = device_ptr_type{ dept_ + boundary_size_, devices_[device] };
+    }
+
+    // the block CG algorithm runs on the host; the device kernels only support a single right-hand side, i.e., the matrix-vector products are calculated one after another
+    std::vector<real_type> Ad(dept_);
+    return base_type::block_conjugate_gradients(B, imax, eps, q, [&](std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const real_type add) {
+        for (typename std::vector<std::vector<real_type>>::size_type c = 0; c < d.size(); ++c) {
+            #pragma omp parallel for
+            for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+                d_d[device].memcpy_to_device(d[c], 0, dept_);
+                Ad_d[device].memset(0);
+
+                run_device_kernel(device, q_d[device], Ad_d[device], d_d[device], add);
+            }
+            device_reduction(Ad_d, Ad);
+
+            ret[c] += Ad;
+        }
+    }, folds);
+}
+
 template <typename T, typename device_ptr_t, typename queue_t>
 void gpu_csvm<T, device_ptr_t, queue_t>::update_w() {
     w_.resize(num_features_);
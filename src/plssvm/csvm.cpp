@@ -8,54 +8,145 @@
 
 #include "plssvm/csvm.hpp"
 
-#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
-#include "plssvm/detail/operators.hpp"       // dot product, plssvm::operators::sum, plssvm::operators::sign
-#include "plssvm/detail/utility.hpp"         // plssvm::detail::to_underlying
-#include "plssvm/exceptions/exceptions.hpp"  // plssvm::unsupported_kernel_type_exception, plssvm::exception
-#include "plssvm/kernel_types.hpp"           // plssvm::kernel_type, plssvm::kernel_function
-#include "plssvm/parameter.hpp"              // plssvm::parameter
+#include "plssvm/constants.hpp"                    // plssvm::FEATURE_SPACE_BLOCK_SIZE
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/blas.hpp"                  // plssvm::detail::blas::{is_enabled_for, syrk_lower, gemv_n}
+#include "plssvm/detail/cholesky.hpp"              // plssvm::detail::cholesky_decomposition, plssvm::detail::cholesky_solve, plssvm::detail::forward_substitution, plssvm::detail::backward_substitution
+#include "plssvm/detail/conjugate_gradients.hpp"   // plssvm::detail::conjugate_gradients
+#include "plssvm/detail/memory.hpp"                // plssvm::detail::available_memory
+#include "plssvm/detail/operators.hpp"             // dot product, plssvm::operators::sum, plssvm::operators::sign
+#include "plssvm/detail/polynomial_features.hpp"   // plssvm::detail::polynomial_feature_map
+#include "plssvm/detail/preconditioner.hpp"        // plssvm::detail::preconditioner, plssvm::detail::make_preconditioner
+#include "plssvm/detail/random_features.hpp"       // plssvm::detail::random_fourier_offsets, plssvm::detail::random_fourier_frequencies
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+#include "plssvm/detail/utility.hpp"               // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::unsupported_kernel_type_exception, plssvm::exception
+#include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type, plssvm::kernel_function
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix, plssvm::simd_padding
+#include "plssvm/parameter.hpp"                    // plssvm::parameter
+#include "plssvm/preconditioner_types.hpp"         // plssvm::preconditioner_type
+#include "plssvm/solver_types.hpp"                 // plssvm::solver_type
 
 #include "fmt/chrono.h"   // format std::chrono
 #include "fmt/core.h"     // fmt::print, fmt::format
+#include "fmt/format.h"   // fmt::join
 #include "fmt/ostream.h"  // can use fmt using operator<< overloads
 
 #ifdef _OPENMP
     #include <omp.h>  // omp_get_num_threads
 #endif
 
-#include <algorithm>  // std::all_of
-#include <chrono>     // std::chrono::stead_clock, std::chrono::duration_cast, std::chrono::milliseconds
-#include <cstddef>    // std::size_t
-#include <fstream>    // std::ofstream
-#include <ios>        // std:streamsize, std::ios
-#include <memory>     // std::make_shared
-#include <string>     // std::string
-#include <utility>    // std::move
-#include <vector>     // std::vector
+#include <algorithm>      // std::all_of, std::clamp, std::copy, std::fill, std::find, std::max, std::max_element, std::min, std::sort, std::unique
+#include <chrono>         // std::chrono::stead_clock, std::chrono::duration_cast, std::chrono::milliseconds
+#include <cmath>          // std::sqrt, std::cos, std::abs, std::ceil, std::log
+#include <cstddef>        // std::size_t
+#include <fstream>        // std::ofstream
+#include <functional>     // std::function
+#include <ios>            // std:streamsize, std::ios
+#include <limits>         // std::numeric_limits
+#include <memory>         // std::make_shared, std::unique_ptr
+#include <numeric>        // std::iota, std::accumulate
+#include <random>         // std::mt19937_64, std::bernoulli_distribution, std::uniform_int_distribution, std::discrete_distribution
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <utility>        // std::move, std::make_pair, std::pair, std::swap
+#include <vector>         // std::vector
 
 namespace plssvm {
 
 template <typename T>
 csvm<T>::csvm(const parameter<T> &params) :
-    target_{ params.target }, kernel_{ params.kernel }, degree_{ params.degree }, gamma_{ params.gamma }, coef0_{ params.coef0 }, cost_{ params.cost }, epsilon_{ params.epsilon }, print_info_{ params.print_info }, data_ptr_{ params.data_ptr }, value_ptr_{ params.value_ptr }, alpha_ptr_{ params.alpha_ptr }, bias_{ -params.rho } {
+    target_{ params.target }, kernel_{ params.kernel }, degree_{ params.degree }, gamma_{ params.gamma }, coef0_{ params.coef0 }, cost_{ params.cost }, epsilon_{ params.epsilon }, print_info_{ params.print_info }, solver_{ params.solver }, memory_budget_{ params.memory_budget }, replace_threshold_{ params.replace_threshold }, replace_interval_{ params.replace_interval }, preconditioner_{ params.preconditioner }, precond_size_{ params.precond_size }, mixed_precision_{ params.mixed_precision }, fast_math_kernels_{ params.fast_math_kernels }, feature_map_{ params.feature_map }, random_seed_{ params.random_seed }, data_ptr_{ params.data_ptr }, value_ptr_{ params.value_ptr }, label_ptr_{ params.label_ptr }, alpha_ptr_{ params.alpha_ptr }, class_alpha_ptr_{ params.class_alpha_ptr }, bias_{ -params.rho }, classes_{ params.classes } {
     if (data_ptr_ == nullptr) {
         throw exception{ "No data points provided!" };
-    } else if (data_ptr_->empty()) {
+    } else if (data_ptr_->num_rows() == 0) {
         throw exception{ "Data set is empty!" };
-    } else if (!std::all_of(data_ptr_->begin(), data_ptr_->end(), [&](const std::vector<real_type> &point) { return point.size() == data_ptr_->front().size(); })) {
-        throw exception{ "All points in the data vector must have the same number of features!" };
-    } else if (data_ptr_->front().empty()) {
+    } else if (data_ptr_->num_cols() == 0) {
         throw exception{ "No features provided for the data points!" };
-    } else if (alpha_ptr_ != nullptr && alpha_ptr_->size() != data_ptr_->size()) {
-        throw exception{ fmt::format("Number of weights ({}) must match the number of data points ({})!", alpha_ptr_->size(), data_ptr_->size()) };
+    } else if (alpha_ptr_ != nullptr && alpha_ptr_->size() != data_ptr_->num_rows()) {
+        throw exception{ fmt::format("Number of weights ({}) must match the number of data points ({})!", alpha_ptr_->size(), data_ptr_->num_rows()) };
+    } else if (replace_threshold_ < real_type{ 0.0 } || replace_threshold_ > real_type{ 1.0 }) {
+        throw exception{ fmt::format("The residual replacement threshold ({}) must be in the range [0, 1]!", replace_threshold_) };
     }
+    if (class_alpha_ptr_ != nullptr) {
+        if (class_alpha_ptr_->size() != classes_.size()) {
+            throw exception{ fmt::format("Number of weight vectors ({}) must match the number of classes ({})!", class_alpha_ptr_->size(), classes_.size()) };
+        } else if (params.class_rho.size() != classes_.size()) {
+            throw exception{ fmt::format("Number of rho values ({}) must match the number of classes ({})!", params.class_rho.size(), classes_.size()) };
+        }
+        for (const std::vector<real_type> &alpha : *class_alpha_ptr_) {
+            if (alpha.size() != data_ptr_->num_rows()) {
+                throw exception{ fmt::format("Number of weights ({}) must match the number of data points ({})!", alpha.size(), data_ptr_->num_rows()) };
+            }
+        }
+        class_bias_.resize(params.class_rho.size());
+        for (typename std::vector<real_type>::size_type c = 0; c < params.class_rho.size(); ++c) {
+            class_bias_[c] = -params.class_rho[c];
+        }
+    }
+
+    if (params.num_random_features != 0 && alpha_ptr_ != nullptr) {
+        // the data points are the random frequencies of a model using random Fourier features
+        if (kernel_ != kernel_type::rbf) {
+            throw exception{ fmt::format("Random Fourier features are only supported for the rbf kernel, but '{}' was given!", kernel_) };
+        } else if (alpha_ptr_->size() != params.num_random_features) {
+            throw exception{ fmt::format("Number of weights ({}) must match the number of random features ({})!", alpha_ptr_->size(), params.num_random_features) };
+        }
+        num_random_features_ = params.num_random_features;
+        random_offsets_ = detail::random_fourier_offsets<real_type>(num_random_features_, random_seed_);
+    }
+
+    num_data_points_ = data_ptr_->num_rows();
+    num_features_ = data_ptr_->num_cols();
+}
+
+template <typename T>
+std::string csvm<T>::kernel_model_header() const {
+    std::string libsvm_model_header = fmt::format("svm_type c_svc\n"
+                                                  "kernel_type {}\n",
+                                                  kernel_);
+    switch (kernel_) {
+        case kernel_type::linear:
+            break;
+        case kernel_type::polynomial:
+            libsvm_model_header += fmt::format(
+                "degree {}\n"
+                "gamma {}\n"
+                "coef0 {}\n",
+                degree_,
+                gamma_,
+                coef0_);
+            break;
+        case kernel_type::rbf:
+            libsvm_model_header += fmt::format(
+                "gamma {}\n",
+                gamma_);
+            break;
+    }
+    return libsvm_model_header;
+}
 
-    num_data_points_ = data_ptr_->size();
-    num_features_ = (*data_ptr_)[0].size();
+template <typename T>
+auto csvm<T>::distinct_classes() const -> std::vector<real_type> {
+    if (label_ptr_ == nullptr) {
+        return {};
+    }
+    std::vector<real_type> classes(*label_ptr_);
+    std::sort(classes.begin(), classes.end());
+    classes.erase(std::unique(classes.begin(), classes.end()), classes.end());
+    return classes;
 }
 
 template <typename T>
 void csvm<T>::write_model(const std::string &model_name) {
+    if (class_alpha_ptr_ != nullptr) {
+        write_one_vs_all_model(model_name);
+        return;
+    } else if (num_random_features_ != 0) {
+        write_random_features_model(model_name);
+        return;
+    }
+
     auto start_time = std::chrono::steady_clock::now();
 
     PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
@@ -64,14 +155,11 @@ void csvm<T>::write_model(const std::string &model_name) {
         throw exception{ "No alphas given! Maybe a call to 'learn()' is missing?" };
     } else if (value_ptr_ == nullptr) {
         throw exception{ "No labels given! Maybe the data is only usable for prediction?" };
-    } else if (data_ptr_->size() != value_ptr_->size()) {
-        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->size()) };
+    } else if (data_ptr_->num_rows() != value_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->num_rows()) };
     }
-    PLSSVM_ASSERT(data_ptr_->size() == alpha_ptr_->size(), "Sizes mismatch!: {} != {}", data_ptr_->size(), alpha_ptr_->size());  // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");                                                                    // exception in constructor
-    PLSSVM_ASSERT(std::all_of(data_ptr_->begin(), data_ptr_->end(), [&](const std::vector<real_type> &point) { return point.size() == data_ptr_->front().size(); }),
-                  "All points in the data vector must have the same number of features!");    // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->front().empty(), "No features provided for the data points!");  // exception in constructor
+    PLSSVM_ASSERT(data_ptr_->num_rows() == alpha_ptr_->size(), "Sizes mismatch!: {} != {}", data_ptr_->num_rows(), alpha_ptr_->size());  // exception in constructor
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");                                                                            // exception in constructor
 
     unsigned long long nBSV{ 0 };
     unsigned long long count_pos{ 0 };
@@ -89,27 +177,7 @@ void csvm<T>::write_model(const std::string &model_name) {
     }
 
     // create libsvm model header
-    std::string libsvm_model_header = fmt::format("svm_type c_svc\n"
-                                                  "kernel_type {}\n",
-                                                  kernel_);
-    switch (kernel_) {
-        case kernel_type::linear:
-            break;
-        case kernel_type::polynomial:
-            libsvm_model_header += fmt::format(
-                "degree {}\n"
-                "gamma {}\n"
-                "coef0 {}\n",
-                degree_,
-                gamma_,
-                coef0_);
-            break;
-        case kernel_type::rbf:
-            libsvm_model_header += fmt::format(
-                "gamma {}\n",
-                gamma_);
-            break;
-    }
+    std::string libsvm_model_header = kernel_model_header();
     libsvm_model_header += fmt::format(
         "nr_class 2\n"
         "total_sv {}\n"
@@ -132,10 +200,10 @@ void csvm<T>::write_model(const std::string &model_name) {
     model << libsvm_model_header;
 
     // format one output-line
-    auto format_libsvm_line = [](real_type a, const std::vector<real_type> &d) -> std::string {
+    auto format_libsvm_line = [num_features = num_features_](real_type a, const real_type *d) -> std::string {
         std::string line;
         line += fmt::format("{} ", a);
-        for (typename std::vector<real_type>::size_type j = 0; j < d.size(); ++j) {
+        for (std::size_t j = 0; j < num_features; ++j) {
             if (d[j] != real_type{ 0.0 }) {
                 line += fmt::format("{}:{:e} ", j, d[j]);
             }
@@ -152,7 +220,7 @@ void csvm<T>::write_model(const std::string &model_name) {
         #pragma omp for nowait
         for (typename std::vector<real_type>::size_type i = 0; i < alpha_ptr_->size(); ++i) {
             if ((*value_ptr_)[i] > 0) {
-                out_pos += format_libsvm_line((*alpha_ptr_)[i], (*data_ptr_)[i]);
+                out_pos += format_libsvm_line((*alpha_ptr_)[i], data_ptr_->row_data(i));
             }
         }
 
@@ -168,7 +236,7 @@ void csvm<T>::write_model(const std::string &model_name) {
         #pragma omp for nowait
         for (typename std::vector<real_type>::size_type i = 0; i < alpha_ptr_->size(); ++i) {
             if ((*value_ptr_)[i] < 0) {
-                out_neg += format_libsvm_line((*alpha_ptr_)[i], (*data_ptr_)[i]);
+                out_neg += format_libsvm_line((*alpha_ptr_)[i], data_ptr_->row_data(i));
             }
         }
 
@@ -193,206 +261,1902 @@ void csvm<T>::write_model(const std::string &model_name) {
 }
 
 template <typename T>
-void csvm<T>::learn() {
-    using namespace plssvm::operators;
+void csvm<T>::write_one_vs_all_model(const std::string &model_name) {
+    auto start_time = std::chrono::steady_clock::now();
 
-    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");                // exception in constructor
+    PLSSVM_ASSERT(class_alpha_ptr_ != nullptr, "No multi-class model given!");  // checked in write_model
 
-    if (value_ptr_ == nullptr) {
-        throw exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
-    } else if (data_ptr_->size() != value_ptr_->size()) {
-        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->size()) };
+    if (label_ptr_ == nullptr) {
+        throw exception{ "No labels given! Maybe the data is only usable for prediction?" };
+    } else if (data_ptr_->num_rows() != label_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", label_ptr_->size(), data_ptr_->num_rows()) };
     }
 
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");  // exception in constructor
-    PLSSVM_ASSERT(std::all_of(data_ptr_->begin(), data_ptr_->end(), [&](const std::vector<real_type> &point) { return point.size() == data_ptr_->front().size(); }),
-                  "All points in the data vector must have the same number of features!");    // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->front().empty(), "No features provided for the data points!");  // exception in constructor
+    // group the support vectors by their class
+    std::vector<std::vector<std::size_t>> class_indices(classes_.size());
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        const auto it = std::find(classes_.begin(), classes_.end(), (*label_ptr_)[i]);
+        if (it == classes_.end()) {
+            throw exception{ fmt::format("The label {} of data point {} isn't one of the classes of the model!", (*label_ptr_)[i], i) };
+        }
+        class_indices[static_cast<std::size_t>(it - classes_.begin())].push_back(i);
+    }
 
-    // setup the data on the device
-    setup_data_on_device();
+    std::vector<real_type> rho(class_bias_.size());
+    std::vector<std::size_t> num_sv(classes_.size());
+    for (std::size_t c = 0; c < classes_.size(); ++c) {
+        rho[c] = -class_bias_[c];
+        num_sv[c] = class_indices[c].size();
+    }
 
-    auto start_time = std::chrono::steady_clock::now();
+    // create libsvm model header
+    std::string libsvm_model_header = kernel_model_header();
+    libsvm_model_header += fmt::format(
+        "nr_class {}\n"
+        "multiclass one_vs_all\n"
+        "total_sv {}\n"
+        "rho {}\n"
+        "label {}\n"
+        "nr_sv {}\n"
+        "SV\n",
+        classes_.size(),
+        num_data_points_,
+        fmt::join(rho, " "),
+        fmt::join(classes_, " "),
+        fmt::join(num_sv, " "));
 
-    std::vector<real_type> q;
-    std::vector<real_type> b = *value_ptr_;
-    #pragma omp parallel sections
-    {
-        #pragma omp section  // generate q
-        {
-            q = generate_q();
+    // terminal output
+    if (print_info_) {
+        fmt::print("\nOptimization finished\n{}\n", libsvm_model_header);
+    }
+
+    // format all output-lines: the weights for all classes followed by the support vector
+    std::vector<std::string> lines(num_data_points_);
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        std::string &line = lines[i];
+        for (const std::vector<real_type> &alpha : *class_alpha_ptr_) {
+            line += fmt::format("{} ", alpha[i]);
         }
-        #pragma omp section  // generate right-hand side from equation
-        {
-            b.pop_back();
-            b -= value_ptr_->back();
+        const real_type *d = data_ptr_->row_data(i);
+        for (std::size_t j = 0; j < num_features_; ++j) {
+            if (d[j] != real_type{ 0.0 }) {
+                line += fmt::format("{}:{:e} ", j, d[j]);
+            }
         }
-        #pragma omp section  // generate bottom right from A
-        {
-            QA_cost_ = kernel_function(data_ptr_->back(), data_ptr_->back()) + 1 / cost_;
+        line.push_back('\n');
+    }
+
+    // create model file
+    std::ofstream model{ model_name.data(), std::ios::out | std::ios::trunc };
+    model << libsvm_model_header;
+    for (const std::vector<std::size_t> &indices : class_indices) {
+        for (const std::size_t i : indices) {
+            model.write(lines[i].data(), static_cast<std::streamsize>(lines[i].size()));
         }
     }
 
     auto end_time = std::chrono::steady_clock::now();
     if (print_info_) {
-        fmt::print("Setup for solving the optimization problem done in {}.\n", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+        fmt::print("Wrote model file with {} support vectors and {} classes in {}.\n",
+                   num_data_points_,
+                   classes_.size(),
+                   std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+}
+
+template <typename T>
+void csvm<T>::write_random_features_model(const std::string &model_name) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    PLSSVM_ASSERT(num_random_features_ != 0, "No model using random Fourier features given!");  // checked in write_model
+    PLSSVM_ASSERT(alpha_ptr_ != nullptr && alpha_ptr_->size() == num_random_features_, "No weights of the random Fourier features given!");
+
+    // create libsvm model header
+    std::string libsvm_model_header = kernel_model_header();
+    libsvm_model_header += fmt::format(
+        "nr_class 2\n"
+        "random_features {}\n"
+        "random_seed {}\n"
+        "num_features {}\n"
+        "rho {}\n"
+        "label 1 -1\n"
+        "W\n",
+        num_random_features_,
+        random_seed_,
+        num_features_,
+        -bias_);
+
+    // terminal output
+    if (print_info_) {
+        fmt::print("\nOptimization finished\n{}\n", libsvm_model_header);
+    }
+
+    // create model file: the random frequencies are regenerated from the seed, i.e., only the weights are written
+    std::ofstream model{ model_name.data(), std::ios::out | std::ios::trunc };
+    model << libsvm_model_header;
+    model << fmt::format("{}\n", fmt::join(*alpha_ptr_, "\n"));
+
+    auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Wrote model file with {} weights of random Fourier features in {}.\n",
+                   num_random_features_,
+                   std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+}
+
+template <typename T>
+void csvm<T>::learn() {
+    using namespace plssvm::operators;
+
+    // the weights of a previous model are only used once, regardless of how the model is learned
+    const std::vector<real_type> warm_start_alpha = std::move(warm_start_alpha_);
+    warm_start_alpha_.clear();
+
+    // more than two distinct original labels -> learn a one-vs-all multi-class model
+    if (std::vector<real_type> classes = distinct_classes(); classes.size() > 2) {
+        learn_one_vs_all(std::move(classes));
+        return;
+    }
+
+    // low-degree polynomial kernel functions have an exact finite feature map: solve the primal problem if it is estimated to be cheaper
+    if (use_polynomial_feature_map()) {
+        learn_polynomial_feature_map();
+        return;
+    }
+
+    auto [q, b] = setup_equation();
+
+    // start from the weights of a previous model if available
+    std::vector<real_type> x0(num_data_points_ - 1, real_type{ 1.0 });
+    if (warm_start_alpha.size() == num_data_points_) {
+        std::copy(warm_start_alpha.cbegin(), warm_start_alpha.cend() - 1, x0.begin());
     }
 
-    start_time = std::chrono::steady_clock::now();
+    const auto start_time = std::chrono::steady_clock::now();
 
     // solve minimization
     std::vector<real_type> alpha;
-    alpha = solver_CG(b, num_features_, epsilon_, q);
+    alpha = solver_CG(b, x0, num_features_, epsilon_, q);
     bias_ = value_ptr_->back() + QA_cost_ * sum(alpha) - (transposed{ q } * alpha);
     alpha.emplace_back(-sum(alpha));
 
     alpha_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(alpha));
+    class_alpha_ptr_ = nullptr;
     w_.clear();
+    feature_weights_.clear();
 
-    end_time = std::chrono::steady_clock::now();
+    const auto end_time = std::chrono::steady_clock::now();
     if (print_info_) {
         fmt::print("Solved minimization problem (r = b - Ax) using CG in {}.\n", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
     }
 }
 
 template <typename T>
-auto csvm<T>::accuracy() -> real_type {
-    if (value_ptr_ == nullptr) {
-        throw exception{ "No labels given! Maybe the data is only usable for prediction?" };
-    }
+void csvm<T>::learn(const aos_matrix<real_type> &support_vectors, const std::vector<real_type> &alpha) {
     PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
 
-    return accuracy(*data_ptr_, *value_ptr_);
-}
+    if (support_vectors.num_rows() != alpha.size()) {
+        throw exception{ fmt::format("Number of weights ({}) must match the number of support vectors ({})!", alpha.size(), support_vectors.num_rows()) };
+    } else if (support_vectors.num_cols() > num_features_) {
+        throw exception{ fmt::format("Number of features per support vector ({}) must not exceed the number of features per data point ({})!", support_vectors.num_cols(), num_features_) };
+    } else if (distinct_classes().size() > 2) {
+        throw exception{ "Warm-starting the CG solver is only supported for two classes!" };
+    }
 
-template <typename T>
-auto csvm<T>::accuracy(const std::vector<real_type> &point, const real_type correct_label) -> real_type {
-    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
-    if (point.size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features of the predict point ({})!", data_ptr_->front().size(), point.size()) };
+    // the support vectors are matched using the same representation as in the model file (trailing zero features may be missing in the model file)
+    const auto row_key = [](const real_type *row, const std::size_t num_features) {
+        std::string key;
+        for (std::size_t j = 0; j < num_features; ++j) {
+            if (row[j] != real_type{ 0.0 }) {
+                key += fmt::format("{}:{:e} ", j, row[j]);
+            }
+        }
+        return key;
+    };
+    std::unordered_map<std::string, std::vector<real_type>> sv_alpha;
+    for (std::size_t i = 0; i < support_vectors.num_rows(); ++i) {
+        sv_alpha[row_key(support_vectors.row_data(i), support_vectors.num_cols())].push_back(alpha[i]);
+    }
+
+    // data points matching a support vector keep its weight, all others start with zero
+    std::size_t num_matched = 0;
+    warm_start_alpha_.assign(num_data_points_, real_type{ 0.0 });
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        const auto it = sv_alpha.find(row_key(data_ptr_->row_data(i), num_features_));
+        if (it != sv_alpha.end() && !it->second.empty()) {
+            warm_start_alpha_[i] = it->second.back();
+            it->second.pop_back();
+            ++num_matched;
+        }
+    }
+
+    if (print_info_) {
+        fmt::print("Starting the CG solver from the weights of {} of {} data points matching the {} support vectors of the previous model.\n", num_matched, num_data_points_, support_vectors.num_rows());
     }
 
-    return accuracy(std::vector<std::vector<real_type>>(1, point), std::vector<real_type>(1, correct_label));
+    learn();
 }
 
 template <typename T>
-auto csvm<T>::accuracy(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &correct_labels) -> real_type {
-    if (points.size() != correct_labels.size()) {
-        throw exception{ fmt::format("Number of data points ({}) must match number of correct labels ({})!", points.size(), correct_labels.size()) };
-    }
+void csvm<T>::append_data(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &labels) {
+    using namespace plssvm::operators;
 
     PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
 
-    // return zero as accuracy for predicting no points
-    if (points.empty()) {
-        return real_type{ 0.0 };
+    if (value_ptr_ == nullptr || label_ptr_ == nullptr) {
+        throw exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    } else if (points.empty()) {
+        throw exception{ "No data points to append given!" };
+    } else if (points.size() != labels.size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points to append ({})!", labels.size(), points.size()) };
+    } else if (!std::all_of(points.begin(), points.end(), [&](const std::vector<real_type> &point) { return point.size() == num_features_; })) {
+        throw exception{ fmt::format("All data points to append must have {} features!", num_features_) };
     }
 
-    if (!std::all_of(points.begin(), points.end(), [&](const std::vector<real_type> &point) { return point.size() == points.front().size(); })) {
-        throw exception{ "All points in the prediction point vector must have the same number of features!" };
-    } else if (points.front().size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", data_ptr_->front().size(), points.front().size()) };
+    const std::size_t num_old_data_points = num_data_points_;
+
+    // the previous model is the initial guess of the next CG solve, the new data points start with a weight of zero
+    if (alpha_ptr_ != nullptr && class_alpha_ptr_ == nullptr && alpha_ptr_->size() == num_old_data_points) {
+        warm_start_alpha_ = *alpha_ptr_;
+        warm_start_alpha_.resize(num_old_data_points + points.size(), real_type{ 0.0 });
     }
 
-    unsigned long long correct{ 0 };
-    const std::vector<real_type> predictions = predict(points);
-    for (typename std::vector<real_type>::size_type index = 0; index < predictions.size(); ++index) {
-        if (predictions[index] * correct_labels[index] > real_type{ 0.0 }) {
-            ++correct;
-        }
+    // copy the old data points and append the new ones
+    aos_matrix<real_type> data{ num_old_data_points + points.size(), num_features_, data_ptr_->row_padding(), data_ptr_->col_padding() };
+    #pragma omp parallel for
+    for (std::size_t row = 0; row < data.num_rows(); ++row) {
+        const real_type *point = row < num_old_data_points ? data_ptr_->row_data(row) : points[row - num_old_data_points].data();
+        std::copy(point, point + num_features_, data.row_data(row));
     }
-    return static_cast<real_type>(correct) / static_cast<real_type>(points.size());
-}
 
-template <typename T>
-auto csvm<T>::predict(const std::vector<real_type> &point) -> real_type {
-    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
-    if (point.size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features of the predict point ({})!", data_ptr_->front().size(), point.size()) };
+    std::vector<real_type> all_labels(*label_ptr_);
+    all_labels.insert(all_labels.end(), labels.begin(), labels.end());
+    std::vector<real_type> values(*value_ptr_);
+    for (const real_type label : labels) {
+        values.push_back(sign(label));
     }
 
-    return predict(std::vector<std::vector<real_type>>(1, point))[0];
+    data_ptr_ = std::make_shared<const aos_matrix<real_type>>(std::move(data));
+    label_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(all_labels));
+    value_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(values));
+    num_data_points_ = data_ptr_->num_rows();
+
+    // the model isn't a model of the extended data set
+    alpha_ptr_ = nullptr;
+    class_alpha_ptr_ = nullptr;
+    w_.clear();
+    feature_weights_.clear();
+
+    if (print_info_) {
+        fmt::print("Appended {} data points to the {} data points used for training.\n", points.size(), num_old_data_points);
+    }
 }
 
 template <typename T>
-auto csvm<T>::predict_label(const std::vector<real_type> &point) -> real_type {
-    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
-    if (point.size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features of the predict point ({})!", data_ptr_->front().size(), point.size()) };
+void csvm<T>::learn_one_vs_all(std::vector<real_type> classes) {
+    PLSSVM_ASSERT(label_ptr_ != nullptr, "No labels given!");  // checked in learn
+
+    // one binary label set per class: +1 for the data points of the class, -1 for all others
+    std::vector<std::vector<real_type>> labels(classes.size(), std::vector<real_type>(label_ptr_->size()));
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < label_ptr_->size(); ++i) {
+        for (std::size_t c = 0; c < classes.size(); ++c) {
+            labels[c][i] = (*label_ptr_)[i] == classes[c] ? real_type{ 1.0 } : real_type{ -1.0 };
+        }
     }
 
-    return operators::sign(predict(point));
+    std::vector<std::pair<std::vector<real_type>, real_type>> models = learn_labels(labels);
+
+    std::vector<std::vector<real_type>> class_alpha(models.size());
+    class_bias_.resize(models.size());
+    for (typename std::vector<real_type>::size_type c = 0; c < models.size(); ++c) {
+        class_alpha[c] = std::move(models[c].first);
+        class_bias_[c] = models[c].second;
+    }
+
+    classes_ = std::move(classes);
+    class_alpha_ptr_ = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(class_alpha));
+    alpha_ptr_ = nullptr;
+    w_.clear();
+    feature_weights_.clear();
 }
 
 template <typename T>
-auto csvm<T>::predict_label(const std::vector<std::vector<real_type>> &points) -> std::vector<real_type> {
-    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
-    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
+auto csvm<T>::learn_cost_path(const std::vector<real_type> &costs) -> std::vector<std::pair<std::vector<real_type>, real_type>> {
+    using namespace plssvm::operators;
 
-    // return empty vector if there are no points to predict
-    if (points.empty()) {
-        return std::vector<real_type>{};
+    if (costs.empty()) {
+        throw exception{ "At least one cost must be given to learn a cost path!" };
     }
-
-    if (!std::all_of(points.begin(), points.end(), [&](const std::vector<real_type> &point) { return point.size() == points.front().size(); })) {
-        throw exception{ "All points in the prediction point vector must have the same number of features!" };
-    } else if (points.front().size() != data_ptr_->front().size()) {
-        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", data_ptr_->front().size(), points.front().size()) };
+    for (const real_type cost : costs) {
+        if (cost <= real_type{ 0.0 }) {
+            throw exception{ fmt::format("All costs of the cost path must be positive, but {} isn't!", cost) };
+        }
     }
 
-    std::vector<real_type> classes(predict(points));
+    const auto [q, b] = setup_equation();
 
-    // map prediction values to labels
-    #pragma omp parallel for
-    for (typename std::vector<real_type>::size_type i = 0; i < classes.size(); ++i) {
-        classes[i] = operators::sign(classes[i]);
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // solve the minimization problems for all costs at once
+    std::vector<std::vector<real_type>> alphas = solver_CG_cost_path(b, num_features_, epsilon_, q, costs);
+
+    // the bottom right entry of the least-squares matrix without the cost
+    const real_type kernel_QA = QA_cost_ - 1 / cost_;
+    std::vector<std::pair<std::vector<real_type>, real_type>> models(costs.size());
+    for (typename std::vector<real_type>::size_type i = 0; i < costs.size(); ++i) {
+        std::vector<real_type> &alpha = alphas[i];
+        const real_type bias = value_ptr_->back() + (kernel_QA + 1 / costs[i]) * sum(alpha) - (transposed{ q } * alpha);
+        alpha.emplace_back(-sum(alpha));
+        models[i] = std::make_pair(std::move(alpha), bias);
     }
-    return classes;
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Solved {} minimization problems (r = b - Ax) using multi-shift CG in {}.\n", costs.size(), std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    return models;
 }
 
 template <typename T>
-auto csvm<T>::kernel_function(const std::vector<real_type> &xi, const std::vector<real_type> &xj) -> real_type {
-    PLSSVM_ASSERT(xi.size() == xj.size(), "Sizes mismatch!: {} != {}", xi.size(), xj.size());
+auto csvm<T>::learn_labels(const std::vector<std::vector<real_type>> &labels) -> std::vector<std::pair<std::vector<real_type>, real_type>> {
+    using namespace plssvm::operators;
 
-    switch (kernel_) {
-        case kernel_type::linear:
-            return plssvm::kernel_function<kernel_type::linear>(xi, xj);
-        case kernel_type::polynomial:
-            return plssvm::kernel_function<kernel_type::polynomial>(xi, xj, degree_, gamma_, coef0_);
-        case kernel_type::rbf:
-            return plssvm::kernel_function<kernel_type::rbf>(xi, xj, gamma_);
+    if (labels.empty()) {
+        throw exception{ "At least one label set must be given to learn multiple models!" };
     }
-    throw unsupported_kernel_type_exception{ fmt::format("Unknown kernel type (value: {})!", detail::to_underlying(kernel_)) };
+
+    const auto [q, B] = setup_equation(labels);
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // solve the minimization problems for all label sets at once
+    std::vector<std::vector<real_type>> alphas = solver_CG_block(B, num_features_, epsilon_, q, {});
+
+    std::vector<std::pair<std::vector<real_type>, real_type>> models(labels.size());
+    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < labels.size(); ++i) {
+        std::vector<real_type> &alpha = alphas[i];
+        const real_type bias = labels[i].back() + QA_cost_ * sum(alpha) - (transposed{ q } * alpha);
+        alpha.emplace_back(-sum(alpha));
+        models[i] = std::make_pair(std::move(alpha), bias);
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Solved {} minimization problems (r = b - Ax) using block CG in {}.\n", labels.size(), std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    return models;
 }
 
 template <typename T>
-auto csvm<T>::transform_data(const std::vector<std::vector<real_type>> &matrix, const std::size_t boundary, const std::size_t num_points) -> std::vector<real_type> {
-    PLSSVM_ASSERT(!matrix.empty(), "Matrix is empty!");
-    PLSSVM_ASSERT(num_points <= matrix.size(), "Num points to transform can not exceed matrix size!");
+auto csvm<T>::cross_validate(const std::size_t num_folds) -> std::vector<real_type> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
 
-    const typename std::vector<real_type>::size_type num_features = matrix[0].size();
+    if (num_folds < 2 || num_folds > num_data_points_) {
+        throw exception{ fmt::format("The number of folds ({}) must be in the range [2, {}]!", num_folds, num_data_points_) };
+    }
+    // each fold needs at least two training data points
+    if (num_data_points_ - (num_data_points_ + num_folds - 1) / num_folds < 2) {
+        throw exception{ fmt::format("At least two training data points are necessary for each fold, but only {} data points are given!", num_data_points_) };
+    }
+    if (distinct_classes().size() > 2) {
+        throw exception{ "Cross-validation is only supported for two classes!" };
+    }
 
-    PLSSVM_ASSERT(std::all_of(matrix.begin(), matrix.end(), [=](const std::vector<real_type> &point) { return point.size() == num_features_; }), "Feature sizes mismatch! All features should have size {}!", num_features_);
+    const auto [q, b] = setup_equation();
+    const std::vector<real_type> &labels = *value_ptr_;
 
-    auto start_time = std::chrono::steady_clock::now();
+    // the data point i belongs to the fold i % num_folds
+    std::vector<std::size_t> folds(num_data_points_);
+    std::vector<std::size_t> pivots(num_folds);
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        folds[i] = i % num_folds;
+    }
+    for (std::size_t fold = 0; fold < num_folds; ++fold) {
+        pivots[fold] = fold_pivot(folds, fold);
+    }
 
-    std::vector<real_type> vec(num_features * (num_points + boundary));
-    #pragma omp parallel for collapse(2)
-    for (typename std::vector<real_type>::size_type col = 0; col < num_features; ++col) {
-        for (std::size_t row = 0; row < num_points; ++row) {
-            vec[col * (num_points + boundary) + row] = matrix[row][col];
+    // the right-hand side of each fold only contains the training data points except the pivot
+    std::vector<std::vector<real_type>> B(num_folds, std::vector<real_type>(num_data_points_ - 1, real_type{ 0.0 }));
+    for (std::size_t fold = 0; fold < num_folds; ++fold) {
+        for (std::size_t i = 0; i < num_data_points_ - 1; ++i) {
+            if (folds[i] != fold && i != pivots[fold]) {
+                B[fold][i] = labels[i] - labels[pivots[fold]];
+            }
         }
     }
 
-    auto end_time = std::chrono::steady_clock::now();
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // solve the training problems of all folds at once
+    const std::vector<std::vector<real_type>> alphas = solver_CG_block(B, num_features_, epsilon_, q, folds);
+
+    const auto end_time = std::chrono::steady_clock::now();
     if (print_info_) {
-        fmt::print("Transformed dataset from 2D AoS to 1D SoA in {}.\n", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+        fmt::print("Solved the minimization problems (r = b - Ax) of {} folds using block CG in {}.\n", num_folds, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    std::vector<real_type> accuracies(num_folds);
+    for (std::size_t fold = 0; fold < num_folds; ++fold) {
+        const auto fold_start_time = std::chrono::steady_clock::now();
+
+        // weights of all data points: zero for the held-out data points, the pivot balances the sum of all weights
+        const std::size_t pivot = pivots[fold];
+        std::vector<real_type> alpha(num_data_points_, real_type{ 0.0 });
+        real_type sum_alpha{ 0.0 };
+        for (std::size_t i = 0; i < num_data_points_ - 1; ++i) {
+            if (folds[i] != fold && i != pivot) {
+                alpha[i] = alphas[fold][i];
+                sum_alpha += alpha[i];
+            }
+        }
+        alpha[pivot] = -sum_alpha;
+
+        // the bias satisfies the equation of the pivot: sum_j k(x_pivot, x_j) * alpha_j + alpha_pivot / cost + bias = y_pivot
+        real_type bias = labels[pivot] - alpha[pivot] / cost_;
+        std::vector<std::vector<real_type>> validation_points;
+        std::vector<real_type> validation_labels;
+        for (std::size_t j = 0; j < num_data_points_; ++j) {
+            if (folds[j] != fold) {
+                bias -= kernel_function(data_ptr_->row_data(pivot), data_ptr_->row_data(j)) * alpha[j];
+            } else {
+                validation_points.emplace_back(data_ptr_->row_data(j), data_ptr_->row_data(j) + num_features_);
+                validation_labels.push_back(labels[j]);
+            }
+        }
+
+        // predict the held-out data points using the data already on the device(s)
+        set_model(cost_, std::move(alpha), bias);
+        accuracies[fold] = accuracy(validation_points, validation_labels);
+
+        const auto fold_end_time = std::chrono::steady_clock::now();
+        if (print_info_) {
+            fmt::print("Fold {}/{}: accuracy = {:.2f}% ({} data points), predicted in {}.\n", fold + 1, num_folds, accuracies[fold] * 100, validation_labels.size(), std::chrono::duration_cast<std::chrono::milliseconds>(fold_end_time - fold_start_time));
+        }
+    }
+
+    // the models of the folds aren't a model of the whole data set
+    alpha_ptr_ = nullptr;
+    w_.clear();
+    feature_weights_.clear();
+
+    return accuracies;
+}
+
+template <typename T>
+auto csvm<T>::loo_error(const std::size_t num_probes) -> real_type {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    if (num_probes == 0) {
+        throw exception{ "At least one probing vector is necessary to estimate the leave-one-out error!" };
+    }
+    if (num_data_points_ < 2) {
+        throw exception{ fmt::format("At least two data points are necessary for leave-one-out cross-validation, but only {} data point is given!", num_data_points_) };
+    }
+    if (distinct_classes().size() > 2) {
+        throw exception{ "Leave-one-out cross-validation is only supported for two classes!" };
+    }
+
+    auto [q, b] = setup_equation();
+    const std::vector<real_type> &labels = *value_ptr_;
+    const std::size_t dept = num_data_points_ - 1;
+
+    // the unit vectors yield the exact diagonal using no more right-hand sides than random probing vectors
+    const bool exact = num_probes >= dept;
+    const std::size_t num_rhs = exact ? dept : num_probes;
+
+    // right-hand sides: the labels, the vector of all ones, and the probing vectors
+    std::vector<std::vector<real_type>> B;
+    B.reserve(num_rhs + 2);
+    B.push_back(std::move(b));
+    B.emplace_back(dept, real_type{ 1.0 });
+    std::mt19937_64 generator{ random_seed_ };
+    std::bernoulli_distribution coin_flip{ 0.5 };
+    for (std::size_t k = 0; k < num_rhs; ++k) {
+        std::vector<real_type> z(dept, real_type{ 0.0 });
+        if (exact) {
+            z[k] = real_type{ 1.0 };
+        } else {
+            for (real_type &z_i : z) {
+                z_i = coin_flip(generator) ? real_type{ 1.0 } : real_type{ -1.0 };
+            }
+        }
+        B.push_back(std::move(z));
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // solve the minimization problem and the probing problems at once
+    std::vector<std::vector<real_type>> X = solver_CG_block(B, num_features_, epsilon_, q, {});
+
+    std::vector<real_type> alpha = std::move(X.front());
+    bias_ = labels.back() + QA_cost_ * sum(alpha) - (transposed{ q } * alpha);
+    alpha.emplace_back(-sum(alpha));
+
+    // estimate the diagonal of the inverse of the full least-squares matrix (the probing vectors satisfy z_i * z_i = 1)
+    std::vector<real_type> diag(num_data_points_, real_type{ 0.0 });
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < dept; ++i) {
+        real_type temp{ 0.0 };
+        for (std::size_t k = 0; k < num_rhs; ++k) {
+            temp += B[k + 2][i] * X[k + 2][i];
+        }
+        temp /= exact ? real_type{ 1.0 } : static_cast<real_type>(num_rhs);
+        // 1 / A_ii <= (A^-1)_ii <= cost, since A is symmetric positive definite with A >= I / cost
+        const real_type A_ii = kernel_function(data_ptr_->row_data(i), data_ptr_->row_data(i)) - 2 * q[i] + QA_cost_ + 1 / cost_;
+        diag[i] = std::min(std::max(temp, 1 / A_ii), cost_);
+    }
+    diag.back() = std::accumulate(X[1].cbegin(), X[1].cend(), real_type{ 0.0 });
+
+    // the leave-one-out prediction of the data point i is y_i - alpha_i / (H^-1)_ii
+    std::size_t num_misclassified = 0;
+    #pragma omp parallel for reduction(+ : num_misclassified)
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        if ((labels[i] - alpha[i] / diag[i]) * labels[i] <= real_type{ 0.0 }) {
+            ++num_misclassified;
+        }
+    }
+
+    alpha_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(alpha));
+    class_alpha_ptr_ = nullptr;
+    w_.clear();
+    feature_weights_.clear();
+
+    const real_type error = static_cast<real_type>(num_misclassified) / static_cast<real_type>(num_data_points_);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Estimated the leave-one-out accuracy of {:.2f}% using {} {} probing vectors and block CG in {}.\n",
+                   (1 - error) * 100,
+                   num_rhs,
+                   exact ? "unit" : "random",
+                   std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    return error;
+}
+
+template <typename T>
+void csvm<T>::learn_nystrom(const std::size_t num_landmarks, const landmark_selection_type selection) {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    if (value_ptr_ == nullptr) {
+        throw exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    } else if (data_ptr_->num_rows() != value_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->num_rows()) };
+    } else if (num_landmarks == 0) {
+        throw exception{ "At least one landmark is necessary for the Nyström approximation!" };
+    } else if (distinct_classes().size() > 2) {
+        throw exception{ "The Nyström approximation is only supported for two classes!" };
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // keep the labels alive, since the landmarks replace them
+    const std::shared_ptr<const std::vector<real_type>> labels = value_ptr_;
+    const std::size_t num_old_data_points = num_data_points_;
+    const std::size_t num_selected = fit_nystrom(num_landmarks, *labels, selection);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Learned the Nyström approximation using {} of {} data points as landmarks in {}.\n", num_selected, num_old_data_points, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+}
+
+template <typename T>
+void csvm<T>::learn_random_features(const std::size_t num_random_features) {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    if (value_ptr_ == nullptr) {
+        throw exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    } else if (data_ptr_->num_rows() != value_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->num_rows()) };
+    } else if (num_random_features == 0) {
+        throw exception{ "At least one random feature is necessary!" };
+    } else if (kernel_ != kernel_type::rbf) {
+        throw exception{ fmt::format("Random Fourier features are only supported for the rbf kernel, but '{}' was given!", kernel_) };
+    } else if (distinct_classes().size() > 2) {
+        throw exception{ "Random Fourier features are only supported for two classes!" };
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // keep the labels alive, since the random frequencies replace them
+    const std::shared_ptr<const std::vector<real_type>> labels = value_ptr_;
+    const std::size_t num_old_data_points = num_data_points_;
+    fit_random_features(num_random_features, *labels);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Learned the model using {} random Fourier features of {} data points in {}.\n", num_random_features, num_old_data_points, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+}
+
+template <typename T>
+auto csvm<T>::compress_nystrom(const std::size_t num_landmarks, const aos_matrix<real_type> &validation_points, const landmark_selection_type selection) -> real_type {
+    if (num_landmarks == 0) {
+        throw exception{ "At least one landmark is necessary for the Nyström approximation!" };
+    } else if (alpha_ptr_ != nullptr && class_alpha_ptr_ == nullptr && value_ptr_ == nullptr) {
+        // the remaining models are rejected in compress_model
+        throw exception{ "No labels of the support vectors given! The Nyström approximation keeps the labels of its landmarks." };
+    }
+
+    return compress_model(validation_points, [&](const std::vector<real_type> &targets) {
+        return fmt::format("the Nyström approximation using {} landmarks", fit_nystrom(num_landmarks, targets, selection));
+    });
+}
+
+template <typename T>
+auto csvm<T>::compress_random_features(const std::size_t num_random_features, const aos_matrix<real_type> &validation_points) -> real_type {
+    if (num_random_features == 0) {
+        throw exception{ "At least one random feature is necessary!" };
+    } else if (kernel_ != kernel_type::rbf) {
+        throw exception{ fmt::format("Random Fourier features are only supported for the rbf kernel, but '{}' was given!", kernel_) };
+    }
+
+    return compress_model(validation_points, [&](const std::vector<real_type> &targets) {
+        fit_random_features(num_random_features, targets);
+        return fmt::format("{} random Fourier features", num_random_features);
+    });
+}
+
+template <typename T>
+std::size_t csvm<T>::fit_nystrom(const std::size_t num_landmarks, const std::vector<real_type> &targets, const landmark_selection_type selection) {
+    PLSSVM_ASSERT(value_ptr_ != nullptr, "No labels given!");  // checked in the callers
+    PLSSVM_ASSERT(targets.size() == num_data_points_, "Sizes mismatch!: {} != {}", targets.size(), num_data_points_);
+
+    const std::size_t max_num_landmarks = std::min(num_landmarks, num_data_points_);
+    std::vector<std::size_t> landmarks;
+    landmarks.reserve(max_num_landmarks);
+    std::mt19937_64 generator{ random_seed_ };
+    if (selection == landmark_selection_type::uniform) {
+        // select the landmarks uniformly at random without replacement using a partial Fisher-Yates shuffle
+        std::vector<std::size_t> indices(num_data_points_);
+        std::iota(indices.begin(), indices.end(), std::size_t{ 0 });
+        for (std::size_t i = 0; i < max_num_landmarks; ++i) {
+            std::swap(indices[i], indices[std::uniform_int_distribution<std::size_t>{ i, num_data_points_ - 1 }(generator)]);
+            landmarks.push_back(indices[i]);
+        }
+    } else {
+        // select the landmarks using kernel k-means++ seeding: the squared distance of the data point i to the landmark z in the kernel feature space is k(i, i) + k(z, z) - 2 k(i, z)
+        std::vector<real_type> self_kernel(num_data_points_);
+        #pragma omp parallel for
+        for (std::size_t i = 0; i < num_data_points_; ++i) {
+            self_kernel[i] = kernel_function(data_ptr_->row_data(i), data_ptr_->row_data(i));
+        }
+        std::vector<real_type> distance(num_data_points_, std::numeric_limits<real_type>::max());
+        landmarks.push_back(std::uniform_int_distribution<std::size_t>{ 0, num_data_points_ - 1 }(generator));
+        while (true) {
+            const std::size_t z = landmarks.back();
+            #pragma omp parallel for
+            for (std::size_t i = 0; i < num_data_points_; ++i) {
+                const real_type dist = self_kernel[i] + self_kernel[z] - 2 * kernel_function(data_ptr_->row_data(i), data_ptr_->row_data(z));
+                distance[i] = std::min(distance[i], std::max(dist, real_type{ 0.0 }));
+            }
+            distance[z] = real_type{ 0.0 };
+            // stop if enough landmarks are selected or all data points coincide with a landmark
+            if (landmarks.size() == num_landmarks || !(*std::max_element(distance.begin(), distance.end()) > real_type{ 0.0 })) {
+                break;
+            }
+            landmarks.push_back(std::discrete_distribution<std::size_t>{ distance.begin(), distance.end() }(generator));
+        }
+    }
+    const std::size_t num_selected = landmarks.size();
+
+    // Cholesky factor L of the kernel matrix of the landmarks, slightly shifted to cope with (almost) linearly dependent landmarks in the kernel feature space
+    std::vector<real_type> factor(num_selected * num_selected, real_type{ 0.0 });
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < num_selected; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            factor[i * num_selected + j] = kernel_function(data_ptr_->row_data(landmarks[i]), data_ptr_->row_data(landmarks[j]));
+        }
+    }
+    real_type max_diagonal{ 0.0 };
+    for (std::size_t i = 0; i < num_selected; ++i) {
+        max_diagonal = std::max(max_diagonal, factor[i * num_selected + i]);
+    }
+    for (std::size_t i = 0; i < num_selected; ++i) {
+        factor[i * num_selected + i] += std::sqrt(std::numeric_limits<real_type>::epsilon()) * max_diagonal;
+    }
+    if (!detail::cholesky_decomposition(factor.data(), num_selected, num_selected)) {
+        throw exception{ fmt::format("The kernel matrix of the {} landmarks isn't positive definite!", num_selected) };
+    }
+
+    // solve the least-squares problem in the feature space phi_i = L^-1 K_mi
+    std::vector<real_type> solution = feature_space_least_squares(num_selected, targets, [&](const std::size_t i, real_type *phi) {
+        for (std::size_t j = 0; j < num_selected; ++j) {
+            phi[j] = kernel_function(data_ptr_->row_data(i), data_ptr_->row_data(landmarks[j]));
+        }
+        detail::forward_substitution(factor.data(), num_selected, num_selected, phi);
+    });
+
+    // transform the weights w of the features back to the weights beta = L^-T w of the landmarks
+    const real_type bias = solution.back();
+    solution.pop_back();
+    detail::backward_substitution(factor.data(), num_selected, num_selected, solution.data());
+
+    // the landmarks replace the data points used for training
+    aos_matrix<real_type> data{ num_selected, num_features_, data_ptr_->row_padding(), data_ptr_->col_padding() };
+    std::vector<real_type> values(num_selected);
+    std::vector<real_type> labels(num_selected);
+    for (std::size_t j = 0; j < num_selected; ++j) {
+        std::copy(data_ptr_->row_data(landmarks[j]), data_ptr_->row_data(landmarks[j]) + num_features_, data.row_data(j));
+        values[j] = (*value_ptr_)[landmarks[j]];
+        labels[j] = label_ptr_ != nullptr ? (*label_ptr_)[landmarks[j]] : values[j];
+    }
+    data_ptr_ = std::make_shared<const aos_matrix<real_type>>(std::move(data));
+    value_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(values));
+    label_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(labels));
+    num_data_points_ = num_selected;
+
+    alpha_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(solution));
+    class_alpha_ptr_ = nullptr;
+    bias_ = bias;
+    w_.clear();
+    feature_weights_.clear();
+    warm_start_alpha_.clear();
+
+    // the data on the device is used for predicting
+    setup_data_on_device();
+
+    return num_selected;
+}
+
+template <typename T>
+void csvm<T>::fit_random_features(const std::size_t num_random_features, const std::vector<real_type> &targets) {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(kernel_ == kernel_type::rbf, "Random Fourier features are only supported for the rbf kernel!");  // checked in the callers
+    PLSSVM_ASSERT(targets.size() == num_data_points_, "Sizes mismatch!: {} != {}", targets.size(), num_data_points_);
+
+    aos_matrix<real_type> frequencies = detail::random_fourier_frequencies(num_features_, num_random_features, gamma_, random_seed_);
+    std::vector<real_type> offsets = detail::random_fourier_offsets<real_type>(num_random_features, random_seed_);
+
+    // solve the least-squares problem in the feature space phi_k(x_i) = sqrt(2 / D) cos(omega_k^T x_i + b_k)
+    const real_type scale = std::sqrt(real_type{ 2.0 } / static_cast<real_type>(num_random_features));
+    std::vector<real_type> solution = feature_space_least_squares(num_random_features, targets, [&](const std::size_t i, real_type *phi) {
+        for (std::size_t k = 0; k < num_random_features; ++k) {
+            phi[k] = scale * std::cos(dot(frequencies.row_data(k), data_ptr_->row_data(i), num_features_) + offsets[k]);
+        }
+    });
+    bias_ = solution.back();
+    solution.pop_back();
+
+    // the random frequencies replace the data points used for training
+    data_ptr_ = std::make_shared<const aos_matrix<real_type>>(std::move(frequencies));
+    value_ptr_ = nullptr;
+    label_ptr_ = nullptr;
+    num_data_points_ = num_random_features;
+    num_random_features_ = num_random_features;
+    random_offsets_ = std::move(offsets);
+
+    alpha_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(solution));
+    class_alpha_ptr_ = nullptr;
+    w_.clear();
+    feature_weights_.clear();
+    warm_start_alpha_.clear();
+}
+
+template <typename T>
+void csvm<T>::learn_polynomial_feature_map() {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    if (value_ptr_ == nullptr) {
+        throw exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    } else if (data_ptr_->num_rows() != value_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->num_rows()) };
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // solve the primal least-squares problem in the feature space of the polynomial kernel function
+    const detail::polynomial_feature_map<real_type> feature_map{ num_features_, degree_, gamma_, coef0_ };
+    std::vector<real_type> solution = feature_space_least_squares(feature_map.size(), *value_ptr_, [&](const std::size_t i, real_type *phi) {
+        feature_map(data_ptr_->row_data(i), phi);
+    });
+    bias_ = solution.back();
+    solution.pop_back();
+
+    // the weights of the dual problem are alpha_i = cost * (y_i - f(x_i)), i.e., the model is the same as the one of the dual problem
+    std::vector<real_type> alpha(num_data_points_);
+    #pragma omp parallel
+    {
+        std::vector<real_type> phi(feature_map.size());
+        #pragma omp for
+        for (std::size_t i = 0; i < num_data_points_; ++i) {
+            feature_map(data_ptr_->row_data(i), phi.data());
+            alpha[i] = cost_ * ((*value_ptr_)[i] - (transposed{ solution } * phi) - bias_);
+        }
+    }
+
+    alpha_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(alpha));
+    class_alpha_ptr_ = nullptr;
+    w_.clear();
+    feature_weights_ = std::move(solution);
+    warm_start_alpha_.clear();
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Solved the primal minimization problem using the exact feature map of the polynomial kernel with {} features in {}.\n", feature_map.size(), std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+}
+
+template <typename T>
+auto csvm<T>::compress_model(const aos_matrix<real_type> &validation_points, const std::function<std::string(const std::vector<real_type> &)> &fit) -> real_type {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    if (class_alpha_ptr_ != nullptr) {
+        throw exception{ "Compressing a model is only supported for two classes!" };
+    } else if (alpha_ptr_ == nullptr) {
+        throw exception{ "No model given to compress! Maybe learn() wasn't called?" };
+    } else if (num_random_features_ != 0) {
+        throw exception{ "The model is already compressed using random Fourier features!" };
+    } else if (validation_points.num_rows() == 0) {
+        throw exception{ "At least one validation point is necessary to measure the approximation error!" };
+    } else if (validation_points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per validation point ({})!", num_features_, validation_points.num_cols()) };
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // the compressed model is fitted to the decision values of the model on its support vectors
+    const std::vector<real_type> targets = predict_decision_values(*data_ptr_);
+    const std::vector<real_type> reference = predict_decision_values(validation_points);
+    const std::size_t num_support_vectors = num_data_points_;
+    const std::string approximation = fit(targets);
+    const std::vector<real_type> approximated = predict_decision_values(validation_points);
+
+    const auto end_time = std::chrono::steady_clock::now();
+
+    // compare the decision values of both models on the validation points
+    real_type squared_error{ 0.0 };
+    real_type max_error{ 0.0 };
+    unsigned long long equal_labels{ 0 };
+    for (typename std::vector<real_type>::size_type i = 0; i < reference.size(); ++i) {
+        const real_type diff = approximated[i] - reference[i];
+        squared_error += diff * diff;
+        max_error = std::max(max_error, std::abs(diff));
+        if (operators::sign(approximated[i]) == operators::sign(reference[i])) {
+            ++equal_labels;
+        }
+    }
+    const real_type error = std::sqrt(squared_error / static_cast<real_type>(reference.size()));
+
+    if (print_info_) {
+        fmt::print("Compressed the model with {} support vectors into {} in {}.\n", num_support_vectors, approximation, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+        fmt::print("Approximation error on {} validation points: rmse = {}, max = {}, equal labels = {:.2f}%\n",
+                   reference.size(),
+                   error,
+                   max_error,
+                   static_cast<real_type>(equal_labels) / static_cast<real_type>(reference.size()) * real_type{ 100 });
+    }
+
+    return error;
+}
+
+template <typename T>
+auto csvm<T>::feature_space_least_squares(const std::size_t num_features, const std::vector<real_type> &targets, const std::function<void(std::size_t, real_type *)> &features) const -> std::vector<real_type> {
+    PLSSVM_ASSERT(targets.size() == num_data_points_, "Sizes mismatch!: {} != {}", targets.size(), num_data_points_);
+
+    // normal equations [Phi^T Phi + I / cost, Phi^T 1; 1^T Phi, n] [w; b] = [Phi^T y; 1^T y] (only the lower triangle is assembled)
+    const std::size_t size = num_features + 1;
+    std::vector<real_type> normal_matrix(size * size, real_type{ 0.0 });
+    std::vector<real_type> solution(size, real_type{ 0.0 });
+
+    // the features of a block of data points are accumulated in the single shared normal matrix, i.e., only O(D^2 + D * block size) memory is necessary
+    constexpr auto block_size = static_cast<std::size_t>(FEATURE_SPACE_BLOCK_SIZE);
+    std::vector<real_type> phi_block(size * block_size);  // transposed, i.e., one row per feature
+    for (std::size_t block = 0; block < num_data_points_; block += block_size) {
+        const std::size_t num_block_points = std::min(block_size, num_data_points_ - block);
+        #pragma omp parallel
+        {
+            std::vector<real_type> phi(size);
+            #pragma omp for
+            for (std::size_t b = 0; b < num_block_points; ++b) {
+                features(block + b, phi.data());
+                phi[num_features] = real_type{ 1.0 };
+                for (std::size_t j = 0; j < size; ++j) {
+                    phi_block[j * block_size + b] = phi[j];
+                }
+            }
+        }
+
+#if defined(PLSSVM_HAS_BLAS)
+        if (detail::blas::is_enabled_for(size, num_block_points, block_size)) {
+            detail::blas::syrk_lower(size, num_block_points, real_type{ 1.0 }, phi_block.data(), block_size, real_type{ 1.0 }, normal_matrix.data(), size);
+            detail::blas::gemv_n(size, num_block_points, real_type{ 1.0 }, phi_block.data(), block_size, targets.data() + block, real_type{ 1.0 }, solution.data());
+        } else
+#endif
+        {
+            #pragma omp parallel for schedule(dynamic)
+            for (std::size_t j = 0; j < size; ++j) {
+                const real_type *phi_j = phi_block.data() + j * block_size;
+                for (std::size_t k = 0; k <= j; ++k) {
+                    const real_type *phi_k = phi_block.data() + k * block_size;
+                    real_type temp{ 0.0 };
+                    for (std::size_t b = 0; b < num_block_points; ++b) {
+                        temp += phi_j[b] * phi_k[b];
+                    }
+                    normal_matrix[j * size + k] += temp;
+                }
+                real_type temp{ 0.0 };
+                for (std::size_t b = 0; b < num_block_points; ++b) {
+                    temp += targets[block + b] * phi_j[b];
+                }
+                solution[j] += temp;
+            }
+        }
+    }
+    for (std::size_t j = 0; j < num_features; ++j) {
+        normal_matrix[j * size + j] += 1 / cost_;
+    }
+    if (!detail::cholesky_decomposition(normal_matrix.data(), size, size)) {
+        throw exception{ "The normal equations of the least-squares problem in the feature space aren't positive definite!" };
+    }
+    detail::cholesky_solve(normal_matrix.data(), size, size, solution.data());
+    return solution;
+}
+
+template <typename T>
+void csvm<T>::set_model(const real_type cost, std::vector<real_type> alpha, const real_type bias) {
+    if (alpha.size() != num_data_points_) {
+        throw exception{ fmt::format("Number of weights ({}) must match the number of data points ({})!", alpha.size(), num_data_points_) };
+    }
+
+    cost_ = cost;
+    alpha_ptr_ = std::make_shared<const std::vector<real_type>>(std::move(alpha));
+    class_alpha_ptr_ = nullptr;
+    bias_ = bias;
+    w_.clear();
+    feature_weights_.clear();
+}
+
+template <typename T>
+auto csvm<T>::setup_equation() -> std::pair<std::vector<real_type>, std::vector<real_type>> {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    if (value_ptr_ == nullptr) {
+        throw exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    } else if (data_ptr_->num_rows() != value_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->num_rows()) };
+    }
+
+    auto [q, B] = setup_equation(std::vector<std::vector<real_type>>{ *value_ptr_ });
+    return std::make_pair(std::move(q), std::move(B.front()));
+}
+
+template <typename T>
+auto csvm<T>::setup_equation(const std::vector<std::vector<real_type>> &labels) -> std::pair<std::vector<real_type>, std::vector<std::vector<real_type>>> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < labels.size(); ++i) {
+        if (data_ptr_->num_rows() != labels[i].size()) {
+            throw exception{ fmt::format("Number of labels ({}) of label set {} must match the number of data points ({})!", labels[i].size(), i, data_ptr_->num_rows()) };
+        }
+    }
+
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");  // exception in constructor
+
+    // setup the data on the device
+    setup_data_on_device();
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    std::vector<real_type> q;
+    std::vector<std::vector<real_type>> B = labels;
+    #pragma omp parallel sections
+    {
+        #pragma omp section  // generate q
+        {
+            q = generate_q();
+        }
+        #pragma omp section  // generate right-hand sides from equation
+        {
+            for (std::vector<real_type> &b : B) {
+                const real_type last_label = b.back();
+                b.pop_back();
+                b -= last_label;
+            }
+        }
+        #pragma omp section  // generate bottom right from A
+        {
+            QA_cost_ = kernel_function(data_ptr_->row_data(num_data_points_ - 1), data_ptr_->row_data(num_data_points_ - 1)) + 1 / cost_;
+        }
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Setup for solving the optimization problem done in {}.\n", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    return std::make_pair(std::move(q), std::move(B));
+}
+
+template <typename T>
+auto csvm<T>::accuracy() -> real_type {
+    // a multi-class model is evaluated using the original labels
+    const std::shared_ptr<const std::vector<real_type>> &labels = class_alpha_ptr_ != nullptr ? label_ptr_ : value_ptr_;
+    if (labels == nullptr) {
+        throw exception{ "No labels given! Maybe the data is only usable for prediction?" };
+    }
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+
+    return accuracy(*data_ptr_, *labels);
+}
+
+template <typename T>
+auto csvm<T>::accuracy(const std::vector<real_type> &point, const real_type correct_label) -> real_type {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
+    if (point.size() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features of the predict point ({})!", num_features_, point.size()) };
+    }
+
+    return accuracy(aos_matrix<real_type>{ std::vector<std::vector<real_type>>(1, point) }, std::vector<real_type>(1, correct_label));
+}
+
+template <typename T>
+auto csvm<T>::accuracy(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &correct_labels) -> real_type {
+    if (points.size() != correct_labels.size()) {
+        throw exception{ fmt::format("Number of data points ({}) must match number of correct labels ({})!", points.size(), correct_labels.size()) };
+    }
+
+    // return zero as accuracy for predicting no points
+    if (points.empty()) {
+        return real_type{ 0.0 };
+    }
+
+    return accuracy(to_matrix(points), correct_labels);
+}
+
+template <typename T>
+auto csvm<T>::accuracy(const aos_matrix<real_type> &points, const std::vector<real_type> &correct_labels) -> real_type {
+    if (points.num_rows() != correct_labels.size()) {
+        throw exception{ fmt::format("Number of data points ({}) must match number of correct labels ({})!", points.num_rows(), correct_labels.size()) };
+    }
+
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
+
+    // return zero as accuracy for predicting no points
+    if (points.num_rows() == 0) {
+        return real_type{ 0.0 };
+    }
+
+    if (points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.num_cols()) };
+    }
+
+    unsigned long long correct{ 0 };
+    if (class_alpha_ptr_ != nullptr) {
+        // a multi-class prediction must match the correct class
+        const std::vector<real_type> predictions = predict_one_vs_all(points);
+        for (typename std::vector<real_type>::size_type index = 0; index < predictions.size(); ++index) {
+            if (predictions[index] == correct_labels[index]) {
+                ++correct;
+            }
+        }
+        return static_cast<real_type>(correct) / static_cast<real_type>(points.num_rows());
+    }
+
+    const std::vector<real_type> predictions = predict_decision_values(points);
+    for (typename std::vector<real_type>::size_type index = 0; index < predictions.size(); ++index) {
+        if (predictions[index] * correct_labels[index] > real_type{ 0.0 }) {
+            ++correct;
+        }
+    }
+    return static_cast<real_type>(correct) / static_cast<real_type>(points.num_rows());
+}
+
+template <typename T>
+auto csvm<T>::predict(const std::vector<real_type> &point) -> real_type {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
+    if (point.size() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features of the predict point ({})!", num_features_, point.size()) };
+    }
+
+    const aos_matrix<real_type> points{ std::vector<std::vector<real_type>>(1, point) };
+    return predict_decision_values(points)[0];
+}
+
+template <typename T>
+auto csvm<T>::predict(const std::vector<std::vector<real_type>> &points) -> std::vector<real_type> {
+    // return empty vector if there are no points to predict
+    if (points.empty()) {
+        return std::vector<real_type>{};
+    }
+
+    return predict_decision_values(to_matrix(points));
+}
+
+template <typename T>
+auto csvm<T>::predict_label(const std::vector<real_type> &point) -> real_type {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
+    if (point.size() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features of the predict point ({})!", num_features_, point.size()) };
+    }
+
+    return predict_label(aos_matrix<real_type>{ std::vector<std::vector<real_type>>(1, point) })[0];
+}
+
+template <typename T>
+auto csvm<T>::predict_label(const std::vector<std::vector<real_type>> &points) -> std::vector<real_type> {
+    // return empty vector if there are no points to predict
+    if (points.empty()) {
+        return std::vector<real_type>{};
+    }
+
+    return predict_label(to_matrix(points));
+}
+
+template <typename T>
+auto csvm<T>::predict_label(const aos_matrix<real_type> &points) -> std::vector<real_type> {
+    PLSSVM_ASSERT(data_ptr_ != nullptr, "No data is provided!");  // exception in constructor
+    PLSSVM_ASSERT(!data_ptr_->empty(), "Data set is empty!");     // exception in constructor
+
+    // return empty vector if there are no points to predict
+    if (points.num_rows() == 0) {
+        return std::vector<real_type>{};
+    }
+
+    if (points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.num_cols()) };
+    }
+
+    if (class_alpha_ptr_ != nullptr) {
+        return predict_one_vs_all(points);
+    }
+
+    std::vector<real_type> classes = predict_decision_values(points);
+
+    // map prediction values to labels
+    #pragma omp parallel for
+    for (typename std::vector<real_type>::size_type i = 0; i < classes.size(); ++i) {
+        classes[i] = operators::sign(classes[i]);
+    }
+    return classes;
+}
+
+template <typename T>
+auto csvm<T>::predict_random_features(const aos_matrix<real_type> &points) const -> std::vector<real_type> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(num_random_features_ != 0, "No model using random Fourier features given!");
+    PLSSVM_ASSERT(data_ptr_->num_rows() == num_random_features_, "Sizes mismatch!: {} != {}", data_ptr_->num_rows(), num_random_features_);
+
+    // return empty vector if there are no points to predict
+    if (points.num_rows() == 0) {
+        return std::vector<real_type>{};
+    }
+
+    if (points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.num_cols()) };
+    }
+
+    // f(x) = sqrt(2 / D) sum_k w_k cos(omega_k^T x + b_k) + bias
+    const real_type scale = std::sqrt(real_type{ 2.0 } / static_cast<real_type>(num_random_features_));
+    std::vector<real_type> out(points.num_rows());
+    #pragma omp parallel for
+    for (std::size_t point_index = 0; point_index < points.num_rows(); ++point_index) {
+        real_type temp{ 0.0 };
+        for (std::size_t k = 0; k < num_random_features_; ++k) {
+            temp += (*alpha_ptr_)[k] * std::cos(dot(data_ptr_->row_data(k), points.row_data(point_index), num_features_) + random_offsets_[k]);
+        }
+        out[point_index] = scale * temp + bias_;
+    }
+    return out;
+}
+
+template <typename T>
+std::size_t csvm<T>::polynomial_feature_map_size() const {
+    if (kernel_ != kernel_type::polynomial || !detail::polynomial_feature_map<real_type>::is_supported(degree_, gamma_, coef0_)) {
+        return 0;
+    }
+    return detail::polynomial_feature_map<real_type>::size(num_features_, degree_, coef0_);
+}
+
+template <typename T>
+bool csvm<T>::use_polynomial_feature_map() const {
+    // an explicitly requested configuration of the CG solver always solves the dual problem
+    if (!feature_map_ || solver_ != solver_type::automatic || preconditioner_ != preconditioner_type::none || mixed_precision_) {
+        return false;
+    }
+    const std::size_t num_monomials = polynomial_feature_map_size();
+    if (num_monomials == 0) {
+        return false;
+    }
+
+    // the shared normal matrix and the features of one block of data points must fit into the memory budget
+    const std::size_t size = num_monomials + 1;
+    if ((size * size + size * FEATURE_SPACE_BLOCK_SIZE) * sizeof(real_type) > memory_budget_bytes()) {
+        return false;
+    }
+
+    // the largest eigenvalue of the kernel matrix is bounded by its trace and the smallest eigenvalue of the least-squares matrix is at least 1 / cost
+    double trace = 0.0;
+    #pragma omp parallel for reduction(+ : trace)
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        trace += static_cast<double>(plssvm::kernel_function<kernel_type::polynomial>(data_ptr_->row_data(i), data_ptr_->row_data(i), num_features_, degree_, gamma_, coef0_));
+    }
+    const double condition = 1.0 + static_cast<double>(cost_) * trace;
+
+    const auto n = static_cast<double>(num_data_points_);
+    const auto D = static_cast<double>(num_monomials);
+    const auto d = static_cast<double>(num_features_);
+    // CG needs at most sqrt(condition) / 2 * ln(2 / eps) iterations to reduce the residual by eps, but stops after d iterations
+    const double num_iterations = std::clamp(std::ceil(std::sqrt(condition) / 2 * std::log(2 / static_cast<double>(epsilon_))), 1.0, d);
+
+    // the explicit solver assembles the lower triangle of the kernel matrix once, the implicit solver recomputes it in every CG iteration
+    const auto kernel_matrix_bytes = static_cast<std::size_t>(n * (n - 1) / 2 * sizeof(real_type));
+    const double dual_operations = resolve_solver(kernel_matrix_bytes) == solver_type::cg_explicit ? n * n * d + num_iterations * n * n : num_iterations * n * n * d;
+    return (n + D) * D * D < dual_operations;
+}
+
+template <typename T>
+void csvm<T>::update_feature_weights() {
+    PLSSVM_ASSERT(alpha_ptr_ != nullptr, "No model given!");
+    PLSSVM_ASSERT(alpha_ptr_->size() == num_data_points_, "Sizes mismatch!: {} != {}", alpha_ptr_->size(), num_data_points_);
+
+    // w = sum_i alpha_i phi(x_i)
+    const detail::polynomial_feature_map<real_type> feature_map{ num_features_, degree_, gamma_, coef0_ };
+    feature_weights_.assign(feature_map.size(), real_type{ 0.0 });
+    #pragma omp parallel
+    {
+        std::vector<real_type> thread_weights(feature_map.size(), real_type{ 0.0 });
+        std::vector<real_type> phi(feature_map.size());
+        #pragma omp for nowait
+        for (std::size_t i = 0; i < num_data_points_; ++i) {
+            feature_map(data_ptr_->row_data(i), phi.data());
+            for (std::size_t m = 0; m < phi.size(); ++m) {
+                thread_weights[m] += (*alpha_ptr_)[i] * phi[m];
+            }
+        }
+
+        #pragma omp critical
+        {
+            for (std::size_t m = 0; m < thread_weights.size(); ++m) {
+                feature_weights_[m] += thread_weights[m];
+            }
+        }
+    }
+}
+
+template <typename T>
+auto csvm<T>::predict_polynomial_feature_map(const aos_matrix<real_type> &points) const -> std::vector<real_type> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(!feature_weights_.empty(), "No weights of the polynomial feature map given!");
+
+    // return empty vector if there are no points to predict
+    if (points.num_rows() == 0) {
+        return std::vector<real_type>{};
+    }
+
+    if (points.num_cols() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.num_cols()) };
+    }
+
+    // f(x) = w^T phi(x) + bias
+    const detail::polynomial_feature_map<real_type> feature_map{ num_features_, degree_, gamma_, coef0_ };
+    std::vector<real_type> out(points.num_rows());
+    #pragma omp parallel
+    {
+        std::vector<real_type> phi(feature_map.size());
+        #pragma omp for
+        for (std::size_t point_index = 0; point_index < points.num_rows(); ++point_index) {
+            feature_map(points.row_data(point_index), phi.data());
+            out[point_index] = (transposed{ feature_weights_ } * phi) + bias_;
+        }
+    }
+    return out;
+}
+
+template <typename T>
+auto csvm<T>::predict_decision_values(const aos_matrix<real_type> &points) -> std::vector<real_type> {
+    if (num_random_features_ != 0) {
+        return predict_random_features(points);
+    }
+
+    // a single weight vector in the exact feature map of a low-degree polynomial kernel function is cheaper than evaluating the kernel function for all support vectors
+    if (const std::size_t num_monomials = polynomial_feature_map_size(); feature_map_ && alpha_ptr_ != nullptr && num_monomials != 0 && num_monomials < num_data_points_ * num_features_) {
+        if (feature_weights_.empty()) {
+            update_feature_weights();
+        }
+        return predict_polynomial_feature_map(points);
+    }
+    return predict(points);
+}
+
+template <typename T>
+auto csvm<T>::predict_one_vs_all(const aos_matrix<real_type> &points) -> std::vector<real_type> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(class_alpha_ptr_ != nullptr, "No multi-class model given!");
+    PLSSVM_ASSERT(points.num_cols() == num_features_, "Sizes mismatch!: {} != {}", points.num_cols(), num_features_);
+
+    const std::size_t num_classes = classes_.size();
+    const std::vector<std::vector<real_type>> &class_alpha = *class_alpha_ptr_;
+
+    std::vector<real_type> weights;
+    if (kernel_ == kernel_type::linear) {
+        // use the normal vectors of all classes in case of the linear kernel function
+        weights.assign(num_classes * num_features_, real_type{ 0.0 });
+        #pragma omp parallel for collapse(2)
+        for (std::size_t c = 0; c < num_classes; ++c) {
+            for (std::size_t feature_index = 0; feature_index < num_features_; ++feature_index) {
+                real_type temp{ 0.0 };
+                for (std::size_t data_index = 0; data_index < num_data_points_; ++data_index) {
+                    temp += class_alpha[c][data_index] * (*data_ptr_)(data_index, feature_index);
+                }
+                weights[c * num_features_ + feature_index] = temp;
+            }
+        }
+    } else {
+        // store the weights of all classes of a support vector contiguously
+        weights.resize(num_data_points_ * num_classes);
+        #pragma omp parallel for
+        for (std::size_t data_index = 0; data_index < num_data_points_; ++data_index) {
+            for (std::size_t c = 0; c < num_classes; ++c) {
+                weights[data_index * num_classes + c] = class_alpha[c][data_index];
+            }
+        }
+    }
+
+    std::vector<real_type> labels(points.num_rows());
+    #pragma omp parallel
+    {
+        std::vector<real_type> decision(num_classes);
+        #pragma omp for
+        for (std::size_t point_index = 0; point_index < points.num_rows(); ++point_index) {
+            decision = class_bias_;
+            if (kernel_ == kernel_type::linear) {
+                for (std::size_t c = 0; c < num_classes; ++c) {
+                    decision[c] += dot(weights.data() + c * num_features_, points.row_data(point_index), num_features_);
+                }
+            } else {
+                // evaluate the kernel function only once for all classes
+                for (std::size_t data_index = 0; data_index < num_data_points_; ++data_index) {
+                    const real_type kernel_value = kernel_function(data_ptr_->row_data(data_index), points.row_data(point_index));
+                    const real_type *weight = weights.data() + data_index * num_classes;
+                    for (std::size_t c = 0; c < num_classes; ++c) {
+                        decision[c] += weight[c] * kernel_value;
+                    }
+                }
+            }
+            // the class with the largest decision value wins
+            labels[point_index] = classes_[static_cast<std::size_t>(std::max_element(decision.begin(), decision.end()) - decision.begin())];
+        }
+    }
+    return labels;
+}
+
+template <typename T>
+auto csvm<T>::kernel_function(const std::vector<real_type> &xi, const std::vector<real_type> &xj) -> real_type {
+    PLSSVM_ASSERT(xi.size() == xj.size(), "Sizes mismatch!: {} != {}", xi.size(), xj.size());
+
+    switch (kernel_) {
+        case kernel_type::linear:
+            return plssvm::kernel_function<kernel_type::linear>(xi, xj);
+        case kernel_type::polynomial:
+            return plssvm::kernel_function<kernel_type::polynomial>(xi, xj, degree_, gamma_, coef0_);
+        case kernel_type::rbf:
+            return plssvm::kernel_function<kernel_type::rbf>(xi, xj, gamma_, fast_math_kernels_);
+    }
+    throw unsupported_kernel_type_exception{ fmt::format("Unknown kernel type (value: {})!", detail::to_underlying(kernel_)) };
+}
+
+template <typename T>
+auto csvm<T>::kernel_function(const real_type *xi, const real_type *xj) -> real_type {
+    switch (kernel_) {
+        case kernel_type::linear:
+            return plssvm::kernel_function<kernel_type::linear>(xi, xj, num_features_);
+        case kernel_type::polynomial:
+            return plssvm::kernel_function<kernel_type::polynomial>(xi, xj, num_features_, degree_, gamma_, coef0_);
+        case kernel_type::rbf:
+            return plssvm::kernel_function<kernel_type::rbf>(xi, xj, num_features_, gamma_, fast_math_kernels_);
+    }
+    throw unsupported_kernel_type_exception{ fmt::format("Unknown kernel type (value: {})!", detail::to_underlying(kernel_)) };
+}
+
+template <typename T>
+auto csvm<T>::to_matrix(const std::vector<std::vector<real_type>> &points) const -> aos_matrix<real_type> {
+    PLSSVM_ASSERT(!points.empty(), "No points to convert!");
+
+    if (!std::all_of(points.begin(), points.end(), [&](const std::vector<real_type> &point) { return point.size() == points.front().size(); })) {
+        throw exception{ "All points in the prediction point vector must have the same number of features!" };
+    } else if (points.front().size() != num_features_) {
+        throw exception{ fmt::format("Number of features per data point ({}) must match the number of features per predict point ({})!", num_features_, points.front().size()) };
+    }
+
+    return aos_matrix<real_type>{ points, 0, simd_padding<real_type>(num_features_) };
+}
+
+template <typename T>
+solver_type csvm<T>::resolve_solver(const std::size_t kernel_matrix_bytes) const {
+    if (solver_ != solver_type::automatic) {
+        return solver_;
+    }
+    // if the available memory can't be determined and no budget has been provided, the budget is 0 -> always use the implicit solver
+    return kernel_matrix_bytes <= memory_budget_bytes() ? solver_type::cg_explicit : solver_type::cg_implicit;
+}
+
+template <typename T>
+std::size_t csvm<T>::memory_budget_bytes() const {
+    return memory_budget_ > 0 ? memory_budget_ * 1024 * 1024 : detail::available_memory() / 2;
+}
+
+template <typename T>
+auto csvm<T>::conjugate_gradients(const std::vector<real_type> &b, const std::vector<real_type> &x0, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const matvec_type &matvec) -> std::vector<real_type> {
+    const std::unique_ptr<detail::preconditioner<real_type>> precond = make_preconditioner(q);
+
+    std::size_t num_iterations = 0;
+    return conjugate_gradients(b, x0, imax, initial_guess_tolerance(b, x0, eps, matvec), precond.get(), matvec, num_iterations);
+}
+
+template <typename T>
+auto csvm<T>::conjugate_gradients(const std::vector<real_type> &b, std::vector<real_type> alpha, const std::size_t imax, const real_type eps, const detail::preconditioner<real_type> *precond, const matvec_type &matvec, std::size_t &num_iterations) -> std::vector<real_type> {
+    return detail::conjugate_gradients(b, std::move(alpha), imax, eps, precond, detail::residual_replacement<real_type>{ replace_threshold_, replace_interval_ }, matvec, num_iterations, print_info_);
+}
+
+template <typename T>
+auto csvm<T>::initial_guess_tolerance(const std::vector<real_type> &b, const std::vector<real_type> &x0, const real_type eps, const matvec_type &matvec) const -> real_type {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(b.size() == x0.size(), "Sizes mismatch!: {} != {}", b.size(), x0.size());
+
+    if (std::all_of(x0.begin(), x0.end(), [](const real_type x) { return x == real_type{ 1.0 }; })) {
+        return eps;
+    }
+
+    // r = b - A * 1
+    std::vector<real_type> r_default(b);
+    matvec(r_default, std::vector<real_type>(b.size(), 1.0), -1);
+    // r = b - A * x0
+    std::vector<real_type> r(b);
+    matvec(r, x0, -1);
+
+    const real_type delta = transposed{ r } * r;
+    if (delta == real_type{ 0.0 }) {
+        return eps;
+    }
+    const real_type tolerance = eps * std::sqrt((transposed{ r_default } * r_default) / delta);
+    if (print_info_) {
+        fmt::print("The initial guess reduces the residual of the default initial guess by a factor of {}.\n", tolerance / eps);
+    }
+    return tolerance;
+}
+
+template <typename T>
+auto csvm<T>::mixed_precision_conjugate_gradients(const std::vector<real_type> &b, const std::vector<real_type> &x0, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const matvec_type &matvec, const matvec_type &low_precision_matvec) -> std::vector<real_type> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(b.size() == x0.size(), "Sizes mismatch!: {} != {}", b.size(), x0.size());
+
+    const typename std::vector<real_type>::size_type dept = b.size();
+    std::vector<real_type> alpha(x0);
+    const real_type tolerance = initial_guess_tolerance(b, x0, eps, matvec);
+
+    const std::unique_ptr<detail::preconditioner<real_type>> precond = make_preconditioner(q);
+
+    // r = b - (A * alpha) using the accurate matrix-vector product
+    std::vector<real_type> r(b);
+    matvec(r, alpha, -1);
+    real_type delta = transposed{ r } * r;
+    const real_type delta0 = delta;
+
+    // the relative residual reduction a single precision CG solve can reliably achieve
+    const real_type min_inner_eps = 10 * static_cast<real_type>(std::numeric_limits<float>::epsilon());
+
+    std::size_t run = 0;
+    std::size_t refinement = 0;
+    while (run < imax && delta > tolerance * tolerance * delta0) {
+        // solve the correction equation A * e = r only as accurate as necessary to reach the target residuum
+        const real_type inner_eps = std::max(tolerance * std::sqrt(delta0 / delta), min_inner_eps);
+        std::size_t num_iterations = 0;
+        alpha += conjugate_gradients(r, std::vector<real_type>(dept, 0.0), imax - run, inner_eps, precond.get(), low_precision_matvec, num_iterations);
+        run += num_iterations;
+        ++refinement;
+
+        // r = b - (A * alpha) using the accurate matrix-vector product
+        r = b;
+        matvec(r, alpha, -1);
+        const real_type delta_old = delta;
+        delta = transposed{ r } * r;
+        if (print_info_) {
+            fmt::print("Refinement step {} finished with a residuum of {} (target: {}).\n", refinement, delta, tolerance * tolerance * delta0);
+        }
+        // the low precision matrix-vector product can't reduce the residual any further
+        if (delta >= delta_old) {
+            break;
+        }
+    }
+    if (print_info_) {
+        fmt::print("Finished after {} refinement steps and {} iterations with a residuum of {} (target: {}).\n", refinement, run, delta, tolerance * tolerance * delta0);
+    }
+
+    return alpha;
+}
+
+template <typename T>
+auto csvm<T>::multi_shift_conjugate_gradients(const std::vector<real_type> &b, const std::size_t imax, const real_type eps, const std::vector<real_type> &costs, const matvec_type &matvec) -> std::vector<std::vector<real_type>> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(!costs.empty(), "At least one cost must be given!");
+
+    const typename std::vector<real_type>::size_type dept = b.size();
+    const typename std::vector<real_type>::size_type num_shifts = costs.size();
+
+    // the shift already contained in matvec
+    const real_type matvec_shift = 1 / cost_;
+    // iterate on the smallest shift, i.e., the slowest converging system
+    const real_type base_shift = 1 / *std::max_element(costs.begin(), costs.end());
+
+    // v = M^-1/2 * v with M = I + 1 * 1^T
+    const real_type c = (1 - 1 / std::sqrt(static_cast<real_type>(dept + 1))) / static_cast<real_type>(dept);
+    const auto apply_inv_sqrt_M = [c](std::vector<real_type> &v) {
+        v -= c * sum(v);
+    };
+    // Ap = (M^-1/2 * (A - matvec_shift * M) * M^-1/2 + base_shift * I) * p
+    std::vector<real_type> t(dept);
+    const auto shifted_matvec = [&](std::vector<real_type> &Ap, const std::vector<real_type> &p) {
+        t = p;
+        apply_inv_sqrt_M(t);
+        std::fill(Ap.begin(), Ap.end(), real_type{ 0.0 });
+        matvec(Ap, t, 1);
+        Ap -= matvec_shift * t;
+        Ap -= matvec_shift * sum(t);
+        apply_inv_sqrt_M(Ap);
+        Ap += base_shift * p;
+    };
+
+    // r = M^-1/2 * b - A * 0
+    std::vector<real_type> r(b);
+    apply_inv_sqrt_M(r);
+    std::vector<real_type> d(r);
+    std::vector<real_type> Ad(dept);
+
+    // the solutions, directions, and residual scaling factors (r_i = zeta_i * r) of all shifted systems
+    std::vector<std::vector<real_type>> x(num_shifts, std::vector<real_type>(dept, 0.0));
+    std::vector<std::vector<real_type>> d_shifted(num_shifts, d);
+    std::vector<real_type> zeta(num_shifts, 1.0);
+    std::vector<real_type> zeta_old(num_shifts, 1.0);
+    std::vector<real_type> zeta_new(num_shifts, 1.0);
+    std::vector<bool> converged(num_shifts, false);
+    std::size_t num_converged = 0;
+
+    real_type delta = transposed{ r } * r;
+    const real_type delta0 = delta;
+    real_type alpha_cd_old = 1.0;
+    real_type beta_old = 0.0;
+
+    std::size_t run = 0;
+    for (; run < imax && num_converged < num_shifts; ++run) {
+        if (print_info_) {
+            fmt::print("Start Iteration {} (max: {}) with current residuum {} (target: {}, converged: {}/{}).\n", run + 1, imax, delta, eps * eps * delta0, num_converged, num_shifts);
+        }
+        // Ad = A * d
+        shifted_matvec(Ad, d);
+
+        // (alpha = delta_new / (d^T * q))
+        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+
+        // update the solutions of the shifted systems
+        for (typename std::vector<real_type>::size_type i = 0; i < num_shifts; ++i) {
+            if (!converged[i]) {
+                const real_type shift = 1 / costs[i] - base_shift;
+                zeta_new[i] = zeta[i] * zeta_old[i] * alpha_cd_old / (alpha_cd * beta_old * (zeta_old[i] - zeta[i]) + zeta_old[i] * alpha_cd_old * (1 + alpha_cd * shift));
+                x[i] += (alpha_cd * zeta_new[i] / zeta[i]) * d_shifted[i];
+            }
+        }
+
+        // r -= alpha_cd * Ad (r = r - alpha * q)
+        r -= alpha_cd * Ad;
+
+        // (delta = r^T * r)
+        const real_type delta_old = delta;
+        delta = transposed{ r } * r;
+
+        // (beta = delta_new / delta_old)
+        const real_type beta = delta / delta_old;
+
+        // update the directions of the shifted systems and check for convergence
+        for (typename std::vector<real_type>::size_type i = 0; i < num_shifts; ++i) {
+            if (!converged[i]) {
+                const real_type beta_shifted = beta * (zeta_new[i] / zeta[i]) * (zeta_new[i] / zeta[i]);
+                d_shifted[i] = zeta_new[i] * r + beta_shifted * d_shifted[i];
+                zeta_old[i] = zeta[i];
+                zeta[i] = zeta_new[i];
+                if (zeta[i] * zeta[i] * delta <= eps * eps * delta0) {
+                    converged[i] = true;
+                    ++num_converged;
+                }
+            }
+        }
+
+        // d = beta * d + r
+        d = beta * d + r;
+        alpha_cd_old = alpha_cd;
+        beta_old = beta;
+    }
+    if (print_info_) {
+        fmt::print("Finished after {} iterations with {} of {} converged systems (residuum: {}, target: {}).\n", run, num_converged, num_shifts, delta, eps * eps * delta0);
+    }
+
+    // x = M^-1/2 * y
+    for (std::vector<real_type> &alpha : x) {
+        apply_inv_sqrt_M(alpha);
+    }
+    return x;
+}
+
+template <typename T>
+auto csvm<T>::block_conjugate_gradients(const std::vector<std::vector<real_type>> &B, const std::size_t imax, const real_type eps, const std::vector<real_type> &q, const block_matvec_type &block_matvec, const std::vector<std::size_t> &folds) -> std::vector<std::vector<real_type>> {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(!B.empty(), "At least one right-hand side must be given!");
+    PLSSVM_ASSERT(folds.empty() || folds.size() == q.size() + 1, "Sizes mismatch!: {} != {}", folds.size(), q.size() + 1);
+
+    const typename std::vector<real_type>::size_type dept = q.size();
+    const typename std::vector<std::vector<real_type>>::size_type num_rhs = B.size();
+
+    const std::unique_ptr<detail::preconditioner<real_type>> precond = make_preconditioner(q);
+
+    // the pivot of each cross-validation fold
+    std::vector<std::size_t> pivots;
+    if (!folds.empty()) {
+        pivots.resize(num_rhs);
+        for (std::size_t c = 0; c < num_rhs; ++c) {
+            pivots[c] = fold_pivot(folds, c);
+        }
+    }
+
+    // calculate the matrix-vector products of the right-hand sides given by cols with a single call to block_matvec
+    std::vector<std::vector<real_type>> ret_block;
+    std::vector<std::vector<real_type>> d_block;
+    const auto block_matvec_cols = [&](const std::vector<std::size_t> &cols, std::vector<std::vector<real_type>> &ret, std::vector<std::vector<real_type>> &d, const real_type add) {
+        ret_block.resize(cols.size());
+        d_block.resize(cols.size());
+        if (!folds.empty()) {
+            // ret_c = ret_c + add * (T_c^T * P_c * A * P_c^T * T_c * d_c)
+            for (std::size_t k = 0; k < cols.size(); ++k) {
+                const std::size_t c = cols[k];
+                const bool change_pivot = pivots[c] != dept;
+                d_block[k].assign(dept, real_type{ 0.0 });
+                real_type sum_d{ 0.0 };
+                for (std::size_t i = 0; i < dept; ++i) {
+                    if (folds[i] != c && i != pivots[c]) {
+                        d_block[k][i] = d[c][i];
+                        sum_d += d[c][i];
+                    }
+                }
+                if (change_pivot) {
+                    d_block[k][pivots[c]] = -sum_d;
+                }
+                ret_block[k].assign(dept, real_type{ 0.0 });
+            }
+            block_matvec(ret_block, d_block, 1);
+            for (std::size_t k = 0; k < cols.size(); ++k) {
+                const std::size_t c = cols[k];
+                const real_type pivot_value = pivots[c] != dept ? ret_block[k][pivots[c]] : real_type{ 0.0 };
+                for (std::size_t i = 0; i < dept; ++i) {
+                    if (folds[i] != c && i != pivots[c]) {
+                        ret[c][i] += add * (ret_block[k][i] - pivot_value);
+                    }
+                }
+            }
+            return;
+        }
+        for (std::size_t k = 0; k < cols.size(); ++k) {
+            ret_block[k].swap(ret[cols[k]]);
+            d_block[k].swap(d[cols[k]]);
+        }
+        block_matvec(ret_block, d_block, add);
+        for (std::size_t k = 0; k < cols.size(); ++k) {
+            ret_block[k].swap(ret[cols[k]]);
+            d_block[k].swap(d[cols[k]]);
+        }
+    };
+
+    std::vector<std::size_t> active(num_rhs);
+    std::iota(active.begin(), active.end(), 0);
+
+    // solve: r = b - (A * alpha_)
+    std::vector<std::vector<real_type>> alpha(num_rhs, std::vector<real_type>(dept, 1.0));
+    std::vector<std::vector<real_type>> r(B);
+    block_matvec_cols(active, r, alpha, -1);
+
+    // delta = r.T * r and z = M^-1 * r
+    std::vector<real_type> delta(num_rhs);
+    std::vector<real_type> delta0(num_rhs);
+    std::vector<real_type> delta_z(num_rhs);
+    std::vector<std::vector<real_type>> z(r);
+    std::vector<detail::residual_replacement<real_type>> replacements;
+    replacements.reserve(num_rhs);
+    for (std::size_t c = 0; c < num_rhs; ++c) {
+        delta[c] = transposed{ r[c] } * r[c];
+        delta0[c] = delta[c];
+        if (precond != nullptr) {
+            precond->apply(r[c], z[c]);
+        }
+        delta_z[c] = transposed{ r[c] } * z[c];
+        replacements.emplace_back(replace_threshold_, replace_interval_);
+        replacements.back().reset(delta[c]);
+    }
+
+    std::vector<std::vector<real_type>> d(z);
+    std::vector<std::vector<real_type>> Ad(num_rhs);
+    // the largest residuum relative to the initial residuum of all right-hand sides
+    const auto max_relative_delta = [&]() {
+        real_type max_delta{ 0.0 };
+        for (std::size_t c = 0; c < num_rhs; ++c) {
+            max_delta = std::max(max_delta, delta[c] / delta0[c]);
+        }
+        return max_delta;
+    };
+
+    std::size_t run = 0;
+    for (; run < imax && !active.empty(); ++run) {
+        if (print_info_) {
+            fmt::print("Start Iteration {} (max: {}) with current relative residuum {} (target: {}, converged: {}/{}).\n", run + 1, imax, max_relative_delta(), eps * eps, num_rhs - active.size(), num_rhs);
+        }
+        // Ad = A * d for all active right-hand sides
+        for (const std::size_t c : active) {
+            Ad[c].assign(dept, real_type{ 0.0 });
+        }
+        block_matvec_cols(active, Ad, d, 1);
+
+        std::vector<std::size_t> replace;
+        for (const std::size_t c : active) {
+            // (alpha = delta_new / (d^T * q))
+            const real_type alpha_cd = delta_z[c] / (transposed{ d[c] } * Ad[c]);
+
+            // (x = x + alpha * d)
+            alpha[c] += alpha_cd * d[c];
+
+            // r -= alpha_cd * Ad (r = r - alpha * q)
+            r[c] -= alpha_cd * Ad[c];
+
+            // (delta = r^T * r)
+            delta[c] = transposed{ r[c] } * r[c];
+
+            // replace the drifting recursively updated residual by the true residual; the convergence is always checked with the true residual
+            if (replacements[c].replace(delta[c]) || delta[c] <= eps * eps * delta0[c]) {
+                replace.push_back(c);
+            }
+        }
+        if (!replace.empty()) {
+            // (r = b - A * x) for all right-hand sides at once
+            for (const std::size_t c : replace) {
+                r[c] = B[c];
+            }
+            block_matvec_cols(replace, r, alpha, -1);
+            for (const std::size_t c : replace) {
+                delta[c] = transposed{ r[c] } * r[c];
+                replacements[c].reset(delta[c]);
+            }
+        }
+
+        std::vector<std::size_t> still_active;
+        for (const std::size_t c : active) {
+            // if we are exact enough stop the CG iterations of this right-hand side
+            if (delta[c] <= eps * eps * delta0[c]) {
+                continue;
+            }
+            still_active.push_back(c);
+
+            // (z = M^-1 * r)
+            if (precond != nullptr) {
+                precond->apply(r[c], z[c]);
+            } else {
+                z[c] = r[c];
+            }
+            const real_type delta_z_old = delta_z[c];
+            delta_z[c] = transposed{ r[c] } * z[c];
+
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta_z[c] / delta_z_old;
+            // d = beta * d + z
+            d[c] = beta * d[c] + z[c];
+        }
+        active = std::move(still_active);
+    }
+    if (print_info_) {
+        fmt::print("Finished after {} iterations with {} of {} converged systems (relative residuum: {}, target: {}).\n", run, num_rhs - active.size(), num_rhs, max_relative_delta(), eps * eps);
+    }
+
+    return alpha;
+}
+
+template <typename T>
+std::size_t csvm<T>::fold_pivot(const std::vector<std::size_t> &folds, const std::size_t fold) {
+    PLSSVM_ASSERT(!folds.empty(), "No folds given!");
+
+    std::size_t pivot = folds.size() - 1;
+    while (folds[pivot] == fold) {
+        PLSSVM_ASSERT(pivot > 0, "The fold {} contains all data points!", fold);
+        --pivot;
+    }
+    return pivot;
+}
+
+template <typename T>
+auto csvm<T>::make_preconditioner(const std::vector<real_type> &q) -> std::unique_ptr<detail::preconditioner<real_type>> {
+    PLSSVM_ASSERT(q.size() == num_data_points_ - 1, "Sizes mismatch!: {} != {}", q.size(), num_data_points_ - 1);
+
+    if (preconditioner_ == preconditioner_type::none) {
+        return nullptr;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // the entries of the least-squares matrix: Q_ij = k(x_i, x_j) + QA_cost - q_i - q_j (+ 1 / cost on the diagonal)
+    const real_type cost = real_type{ 1.0 } / cost_;
+    const auto entry = [&](const std::size_t i, const std::size_t j) {
+        return kernel_function(data_ptr_->row_data(i), data_ptr_->row_data(j)) + QA_cost_ - q[i] - q[j] + (i == j ? cost : real_type{ 0.0 });
+    };
+    // the regularization on the diagonal is the shift of the pivoted Cholesky preconditioner
+    std::unique_ptr<detail::preconditioner<real_type>> precond = detail::make_preconditioner<real_type>(preconditioner_, q.size(), precond_size_, cost, entry);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Set up the {} preconditioner in {}.\n", preconditioner_, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    return precond;
+}
+
+template <typename T>
+void csvm<T>::linear_kernel_matvec(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) const {
+    using namespace plssvm::operators;
+
+    PLSSVM_ASSERT(q.size() == d.size(), "Sizes mismatch!: {} != {}", q.size(), d.size());
+    PLSSVM_ASSERT(ret.size() == d.size(), "Sizes mismatch!: {} != {}", ret.size(), d.size());
+    PLSSVM_ASSERT(d.size() < data_ptr_->num_rows(), "Too many data points!: {} >= {}", d.size(), data_ptr_->num_rows());
+
+    const std::size_t dept = d.size();
+    const aos_matrix<real_type> &data = *data_ptr_;
+
+    // first pass over the data: w = sum_j d_j * x_j, sum(d), and q^T * d
+    std::vector<real_type> w(num_features_, real_type{ 0.0 });
+    real_type d_sum{ 0.0 };
+    real_type qd{ 0.0 };
+    #pragma omp parallel
+    {
+        std::vector<real_type> thread_w(num_features_, real_type{ 0.0 });
+        #pragma omp for reduction(+ : d_sum, qd) nowait
+        for (std::size_t i = 0; i < dept; ++i) {
+            const real_type *x_i = data.row_data(i);
+            #pragma omp simd
+            for (std::size_t f = 0; f < num_features_; ++f) {
+                thread_w[f] += d[i] * x_i[f];
+            }
+            d_sum += d[i];
+            qd += q[i] * d[i];
+        }
+        #pragma omp critical
+        w += thread_w;
+    }
+
+    // second pass over the data: ret_i += add * (x_i^T * w + (QA_cost - q_i) * sum(d) - q^T * d + d_i / cost)
+    const real_type cost = real_type{ 1.0 } / cost_;
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < dept; ++i) {
+        ret[i] += add * (dot(data.row_data(i), w.data(), num_features_) + (QA_cost_ - q[i]) * d_sum - qd + cost * d[i]);
     }
-    return vec;
 }
 
 // explicitly instantiate template class
@@ -0,0 +1,173 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/blas.hpp"
+
+#if defined(PLSSVM_HAS_BLAS)
+
+    #include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+    #include <atomic>       // std::atomic
+    #include <cstddef>      // std::size_t
+    #include <cstdlib>      // std::getenv
+    #include <limits>       // std::numeric_limits
+    #include <type_traits>  // std::is_same_v
+
+// the Fortran interface of the reference BLAS and LAPACK is provided by all implementations (OpenBLAS, BLIS, MKL, ...) -> no implementation specific header necessary
+// the 32-bit integers of the LP64 interface are assumed
+extern "C" {
+void sgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const float *alpha, const float *A, const int *lda, const float *B, const int *ldb, const float *beta, float *C, const int *ldc);
+void dgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const double *alpha, const double *A, const int *lda, const double *B, const int *ldb, const double *beta, double *C, const int *ldc);
+void ssyrk_(const char *uplo, const char *trans, const int *n, const int *k, const float *alpha, const float *A, const int *lda, const float *beta, float *C, const int *ldc);
+void dsyrk_(const char *uplo, const char *trans, const int *n, const int *k, const double *alpha, const double *A, const int *lda, const double *beta, double *C, const int *ldc);
+void sgemv_(const char *trans, const int *m, const int *n, const float *alpha, const float *A, const int *lda, const float *x, const int *incx, const float *beta, float *y, const int *incy);
+void dgemv_(const char *trans, const int *m, const int *n, const double *alpha, const double *A, const int *lda, const double *x, const int *incx, const double *beta, double *y, const int *incy);
+void spotrf_(const char *uplo, const int *n, float *A, const int *lda, int *info);
+void dpotrf_(const char *uplo, const int *n, double *A, const int *lda, int *info);
+}
+
+namespace plssvm::detail::blas {
+
+// A row-major matrix is the transposed column-major matrix with the same leading dimension
+// -> all routines are called on the transposed matrices, e.g., C^T = B A^T for C = A B^T.
+
+namespace {
+
+/**
+ * @brief Convert the size @p value to the integer type of the Fortran interface.
+ * @details The callers guarantee that @p value fits into an `int` by checking plssvm::detail::blas::is_enabled_for() first.
+ * @param[in] value the size
+ * @return the converted size (`[[nodiscard]]`)
+ */
+[[nodiscard]] int to_int(const std::size_t value) {
+    PLSSVM_ASSERT(value <= static_cast<std::size_t>(std::numeric_limits<int>::max()), "The size {} is too large for the BLAS interface!", value);
+    return static_cast<int>(value);
+}
+
+/**
+ * @brief Return the runtime switch between the BLAS/LAPACK routines and the built-in loops.
+ * @return the switch (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::atomic<bool> &enabled_flag() noexcept {
+    static std::atomic<bool> enabled{ std::getenv("PLSSVM_DISABLE_BLAS") == nullptr };
+    return enabled;
+}
+
+}  // namespace
+
+bool is_enabled() noexcept {
+    return enabled_flag().load(std::memory_order_relaxed);
+}
+
+void set_enabled(const bool enabled) noexcept {
+    enabled_flag().store(enabled, std::memory_order_relaxed);
+}
+
+template <typename T>
+void gemm_nt(const std::size_t m, const std::size_t n, const std::size_t k, const T alpha, const T *A, const std::size_t lda, const T *B, const std::size_t ldb, const T beta, T *C, const std::size_t ldc) {
+    if (m == 0 || n == 0) {
+        return;
+    }
+    const int m_int = to_int(m);
+    const int n_int = to_int(n);
+    const int k_int = to_int(k);
+    const int lda_int = to_int(lda);
+    const int ldb_int = to_int(ldb);
+    const int ldc_int = to_int(ldc);
+    if constexpr (std::is_same_v<T, float>) {
+        sgemm_("T", "N", &n_int, &m_int, &k_int, &alpha, B, &ldb_int, A, &lda_int, &beta, C, &ldc_int);
+    } else {
+        dgemm_("T", "N", &n_int, &m_int, &k_int, &alpha, B, &ldb_int, A, &lda_int, &beta, C, &ldc_int);
+    }
+}
+
+template void gemm_nt(std::size_t, std::size_t, std::size_t, float, const float *, std::size_t, const float *, std::size_t, float, float *, std::size_t);
+template void gemm_nt(std::size_t, std::size_t, std::size_t, double, const double *, std::size_t, const double *, std::size_t, double, double *, std::size_t);
+
+template <typename T>
+void syrk_lower(const std::size_t n, const std::size_t k, const T alpha, const T *A, const std::size_t lda, const T beta, T *C, const std::size_t ldc) {
+    if (n == 0) {
+        return;
+    }
+    const int n_int = to_int(n);
+    const int k_int = to_int(k);
+    const int lda_int = to_int(lda);
+    const int ldc_int = to_int(ldc);
+    // the lower triangle of the row-major matrix is the upper triangle of the column-major matrix
+    if constexpr (std::is_same_v<T, float>) {
+        ssyrk_("U", "T", &n_int, &k_int, &alpha, A, &lda_int, &beta, C, &ldc_int);
+    } else {
+        dsyrk_("U", "T", &n_int, &k_int, &alpha, A, &lda_int, &beta, C, &ldc_int);
+    }
+}
+
+template void syrk_lower(std::size_t, std::size_t, float, const float *, std::size_t, float, float *, std::size_t);
+template void syrk_lower(std::size_t, std::size_t, double, const double *, std::size_t, double, double *, std::size_t);
+
+template <typename T>
+void gemv_n(const std::size_t m, const std::size_t n, const T alpha, const T *A, const std::size_t lda, const T *x, const T beta, T *y) {
+    if (m == 0) {
+        return;
+    }
+    const int m_int = to_int(m);
+    const int n_int = to_int(n);
+    const int lda_int = to_int(lda);
+    const int inc = 1;
+    if constexpr (std::is_same_v<T, float>) {
+        sgemv_("T", &n_int, &m_int, &alpha, A, &lda_int, x, &inc, &beta, y, &inc);
+    } else {
+        dgemv_("T", &n_int, &m_int, &alpha, A, &lda_int, x, &inc, &beta, y, &inc);
+    }
+}
+
+template void gemv_n(std::size_t, std::size_t, float, const float *, std::size_t, const float *, float, float *);
+template void gemv_n(std::size_t, std::size_t, double, const double *, std::size_t, const double *, double, double *);
+
+template <typename T>
+void gemv_t(const std::size_t m, const std::size_t n, const T alpha, const T *A, const std::size_t lda, const T *x, const T beta, T *y) {
+    if (n == 0) {
+        return;
+    }
+    const int m_int = to_int(m);
+    const int n_int = to_int(n);
+    const int lda_int = to_int(lda);
+    const int inc = 1;
+    if constexpr (std::is_same_v<T, float>) {
+        sgemv_("N", &n_int, &m_int, &alpha, A, &lda_int, x, &inc, &beta, y, &inc);
+    } else {
+        dgemv_("N", &n_int, &m_int, &alpha, A, &lda_int, x, &inc, &beta, y, &inc);
+    }
+}
+
+template void gemv_t(std::size_t, std::size_t, float, const float *, std::size_t, const float *, float, float *);
+template void gemv_t(std::size_t, std::size_t, double, const double *, std::size_t, const double *, double, double *);
+
+template <typename T>
+bool potrf_lower(T *A, const std::size_t n, const std::size_t ld) {
+    if (n == 0) {
+        return true;
+    }
+    const int n_int = to_int(n);
+    const int ld_int = to_int(ld);
+    int info = 0;
+    // the lower triangle of the row-major matrix is the upper triangle of the column-major matrix
+    if constexpr (std::is_same_v<T, float>) {
+        spotrf_("U", &n_int, A, &ld_int, &info);
+    } else {
+        dpotrf_("U", &n_int, A, &ld_int, &info);
+    }
+    PLSSVM_ASSERT(info >= 0, "Illegal argument {} in the call to potrf!", -info);
+    return info == 0;
+}
+
+template bool potrf_lower(float *, std::size_t, std::size_t);
+template bool potrf_lower(double *, std::size_t, std::size_t);
+
+}  // namespace plssvm::detail::blas
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/memory.hpp"
+
+#if defined(__linux__)
+    #include <unistd.h>  // sysconf, _SC_AVPHYS_PAGES, _SC_PAGESIZE
+#elif defined(_WIN32)
+    #include <windows.h>  // MEMORYSTATUSEX, GlobalMemoryStatusEx
+#endif
+
+#include <cstddef>  // std::size_t
+
+namespace plssvm::detail {
+
+std::size_t available_memory() noexcept {
+#if defined(__linux__)
+    const long num_pages = sysconf(_SC_AVPHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGESIZE);
+    if (num_pages > 0 && page_size > 0) {
+        return static_cast<std::size_t>(num_pages) * static_cast<std::size_t>(page_size);
+    }
+#elif defined(_WIN32)
+    MEMORYSTATUSEX status{};
+    status.dwLength = sizeof(status);
+    if (GlobalMemoryStatusEx(&status)) {
+        return static_cast<std::size_t>(status.ullAvailPhys);
+    }
+#endif
+    return 0;
+}
+
+}  // namespace plssvm::detail
@@ -0,0 +1,145 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/polynomial_features.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::exception
+
+#include "fmt/core.h"  // fmt::format
+
+#include <array>    // std::array
+#include <cmath>    // std::sqrt, std::pow
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
+
+namespace plssvm::detail {
+
+namespace {
+
+/**
+ * @brief Calculate the binomial coefficient \f$\binom{n}{k}\f$.
+ * @param[in] n the size of the set
+ * @param[in] k the size of the subsets
+ * @return the binomial coefficient (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t binomial(const std::size_t n, const std::size_t k) noexcept {
+    std::size_t result = 1;
+    for (std::size_t i = 1; i <= k; ++i) {
+        // exact, since the product of i consecutive integers is divisible by i!
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+/**
+ * @brief Calculate the factorial \f$n!\f$.
+ * @param[in] n the number
+ * @return the factorial (`[[nodiscard]]`)
+ */
+[[nodiscard]] double factorial(const int n) noexcept {
+    double result = 1.0;
+    for (int i = 2; i <= n; ++i) {
+        result *= i;
+    }
+    return result;
+}
+
+}  // namespace
+
+template <typename T>
+bool polynomial_feature_map<T>::is_supported(const int degree, const T gamma, const T coef0) noexcept {
+    return degree >= 1 && degree <= max_degree && gamma > T{ 0.0 } && coef0 >= T{ 0.0 };
+}
+
+template <typename T>
+std::size_t polynomial_feature_map<T>::size(const std::size_t num_features, const int degree, const T coef0) noexcept {
+    const auto p = static_cast<std::size_t>(degree);
+    // number of monomials of total degree exactly p or at most p
+    return coef0 == T{ 0.0 } ? binomial(num_features + p - 1, p) : binomial(num_features + p, p);
+}
+
+template <typename T>
+polynomial_feature_map<T>::polynomial_feature_map(const std::size_t num_features, const int degree, const T gamma, const T coef0) {
+    if (!is_supported(degree, gamma, coef0)) {
+        throw exception{ fmt::format("The polynomial kernel function with degree {}, gamma {}, and coef0 {} has no supported feature map!", degree, gamma, coef0) };
+    }
+
+    const std::size_t num_monomials = size(num_features, degree, coef0);
+    scales_.reserve(num_monomials);
+    indices_.reserve(num_monomials);
+
+    // add the monomial of total degree t multiplying the features with the first t (sorted) indices
+    const auto add_monomial = [&](const int t, const std::array<std::size_t, max_degree> &indices) {
+        // product of the factorials of the multiplicities of the (sorted) indices
+        double multiplicities = 1.0;
+        int run = 1;
+        for (int i = 1; i < t; ++i) {
+            run = indices[i] == indices[i - 1] ? run + 1 : 1;
+            multiplicities *= run;
+        }
+        const double scale = factorial(degree) / (factorial(degree - t) * multiplicities) * std::pow(static_cast<double>(coef0), degree - t) * std::pow(static_cast<double>(gamma), t);
+        scales_.push_back(static_cast<T>(std::sqrt(scale)));
+        indices_.push_back(indices);
+    };
+
+    // enumerate all monomials with non-decreasing indices grouped by their total degree
+    for (int t = 0; t <= max_degree; ++t) {
+        degree_begin_[t] = scales_.size();
+        if (t > degree || (t < degree && coef0 == T{ 0.0 })) {
+            continue;
+        }
+        switch (t) {
+            case 0:
+                add_monomial(t, { 0, 0, 0 });
+                break;
+            case 1:
+                for (std::size_t i = 0; i < num_features; ++i) {
+                    add_monomial(t, { i, 0, 0 });
+                }
+                break;
+            case 2:
+                for (std::size_t i = 0; i < num_features; ++i) {
+                    for (std::size_t j = i; j < num_features; ++j) {
+                        add_monomial(t, { i, j, 0 });
+                    }
+                }
+                break;
+            default:
+                for (std::size_t i = 0; i < num_features; ++i) {
+                    for (std::size_t j = i; j < num_features; ++j) {
+                        for (std::size_t k = j; k < num_features; ++k) {
+                            add_monomial(t, { i, j, k });
+                        }
+                    }
+                }
+                break;
+        }
+    }
+    degree_begin_[max_degree + 1] = scales_.size();
+}
+
+template <typename T>
+void polynomial_feature_map<T>::operator()(const T *point, T *features) const {
+    for (std::size_t m = degree_begin_[0]; m < degree_begin_[1]; ++m) {
+        features[m] = scales_[m];
+    }
+    for (std::size_t m = degree_begin_[1]; m < degree_begin_[2]; ++m) {
+        features[m] = scales_[m] * point[indices_[m][0]];
+    }
+    for (std::size_t m = degree_begin_[2]; m < degree_begin_[3]; ++m) {
+        features[m] = scales_[m] * point[indices_[m][0]] * point[indices_[m][1]];
+    }
+    for (std::size_t m = degree_begin_[3]; m < degree_begin_[4]; ++m) {
+        features[m] = scales_[m] * point[indices_[m][0]] * point[indices_[m][1]] * point[indices_[m][2]];
+    }
+}
+
+template class polynomial_feature_map<float>;
+template class polynomial_feature_map<double>;
+
+}  // namespace plssvm::detail
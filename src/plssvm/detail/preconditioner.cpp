@@ -0,0 +1,261 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/preconditioner.hpp"
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/detail/cholesky.hpp"        // plssvm::detail::cholesky_decomposition, plssvm::detail::cholesky_solve
+#include "plssvm/detail/utility.hpp"         // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::exception
+#include "plssvm/preconditioner_types.hpp"   // plssvm::preconditioner_type
+
+#include "fmt/core.h"  // fmt::format
+
+#include <algorithm>  // std::copy, std::max_element, std::min
+#include <cmath>      // std::sqrt
+#include <cstddef>    // std::size_t
+#include <iterator>   // std::distance
+#include <limits>     // std::numeric_limits
+#include <memory>     // std::unique_ptr, std::make_unique
+#include <vector>     // std::vector
+
+namespace plssvm::detail {
+
+//*************************************************************************************************************************************//
+//                                                                jacobi                                                               //
+//*************************************************************************************************************************************//
+template <typename T>
+jacobi_preconditioner<T>::jacobi_preconditioner(const std::size_t size, const entry_function_type &entry) :
+    inverse_diagonal_(size) {
+    bool positive = true;
+    #pragma omp parallel for reduction(&& : positive)
+    for (std::size_t i = 0; i < size; ++i) {
+        const real_type diag = entry(i, i);
+        positive = positive && diag > real_type{ 0.0 };
+        inverse_diagonal_[i] = real_type{ 1.0 } / diag;
+    }
+    if (!positive) {
+        throw exception{ "The Jacobi preconditioner requires a positive diagonal!" };
+    }
+}
+
+template <typename T>
+void jacobi_preconditioner<T>::apply(const std::vector<real_type> &r, std::vector<real_type> &z) const {
+    PLSSVM_ASSERT(r.size() == inverse_diagonal_.size(), "Sizes mismatch!: {} != {}", r.size(), inverse_diagonal_.size());
+    PLSSVM_ASSERT(z.size() == r.size(), "Sizes mismatch!: {} != {}", z.size(), r.size());
+
+    #pragma omp parallel for simd
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        z[i] = inverse_diagonal_[i] * r[i];
+    }
+}
+
+template class jacobi_preconditioner<float>;
+template class jacobi_preconditioner<double>;
+
+//*************************************************************************************************************************************//
+//                                                             block jacobi                                                            //
+//*************************************************************************************************************************************//
+template <typename T>
+block_jacobi_preconditioner<T>::block_jacobi_preconditioner(const std::size_t size, const std::size_t block_size, const entry_function_type &entry) :
+    size_{ size }, block_size_{ std::min(block_size, size) } {
+    if (block_size == 0) {
+        throw exception{ "The block size of the block-Jacobi preconditioner must be greater than 0!" };
+    }
+    if (size_ == 0) {
+        return;
+    }
+
+    const std::size_t num_blocks = (size_ + block_size_ - 1) / block_size_;
+    factors_.resize(num_blocks * block_size_ * block_size_);
+
+    // the first block that isn't positive definite (num_blocks if all blocks are positive definite)
+    std::size_t failed_block = num_blocks;
+    #pragma omp parallel for schedule(dynamic) reduction(min : failed_block)
+    for (std::size_t block = 0; block < num_blocks; ++block) {
+        const std::size_t offset = block * block_size_;
+        const std::size_t num_rows = std::min(block_size_, size_ - offset);
+        real_type *factor = factors_.data() + block * block_size_ * block_size_;
+
+        // fill the lower triangle of the diagonal block and decompose it
+        for (std::size_t i = 0; i < num_rows; ++i) {
+            for (std::size_t j = 0; j <= i; ++j) {
+                factor[i * block_size_ + j] = entry(offset + i, offset + j);
+            }
+        }
+        if (!cholesky_decomposition(factor, num_rows, block_size_)) {
+            failed_block = std::min(failed_block, block);
+        }
+    }
+    if (failed_block != num_blocks) {
+        throw exception{ fmt::format("The diagonal block {} of the block-Jacobi preconditioner isn't positive definite!", failed_block) };
+    }
+}
+
+template <typename T>
+void block_jacobi_preconditioner<T>::apply(const std::vector<real_type> &r, std::vector<real_type> &z) const {
+    PLSSVM_ASSERT(r.size() == size_, "Sizes mismatch!: {} != {}", r.size(), size_);
+    PLSSVM_ASSERT(z.size() == r.size(), "Sizes mismatch!: {} != {}", z.size(), r.size());
+
+    if (size_ == 0) {
+        return;
+    }
+
+    const std::size_t num_blocks = (size_ + block_size_ - 1) / block_size_;
+    #pragma omp parallel for
+    for (std::size_t block = 0; block < num_blocks; ++block) {
+        const std::size_t offset = block * block_size_;
+        const std::size_t num_rows = std::min(block_size_, size_ - offset);
+        std::copy(r.data() + offset, r.data() + offset + num_rows, z.data() + offset);
+        cholesky_solve(factors_.data() + block * block_size_ * block_size_, num_rows, block_size_, z.data() + offset);
+    }
+}
+
+template class block_jacobi_preconditioner<float>;
+template class block_jacobi_preconditioner<double>;
+
+//*************************************************************************************************************************************//
+//                                                           pivoted cholesky                                                          //
+//*************************************************************************************************************************************//
+template <typename T>
+pivoted_cholesky_preconditioner<T>::pivoted_cholesky_preconditioner(const std::size_t size, const std::size_t rank, const real_type shift, const entry_function_type &entry) :
+    size_{ size }, max_rank_{ std::min(rank, size) }, shift_{ shift } {
+    if (rank == 0) {
+        throw exception{ "The rank of the pivoted Cholesky preconditioner must be greater than 0!" };
+    } else if (!(shift > real_type{ 0.0 })) {
+        throw exception{ fmt::format("The shift of the pivoted Cholesky preconditioner must be positive, but is {}!", shift) };
+    }
+    if (size_ == 0) {
+        return;
+    }
+
+    // the remaining diagonal of A - shift * I - L * L^T
+    std::vector<real_type> diag(size_);
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < size_; ++i) {
+        diag[i] = entry(i, i) - shift_;
+    }
+    // stop if the remaining diagonal is negligible compared to the initial one (e.g., if the rank of the matrix is smaller than the requested rank)
+    const real_type tolerance = std::sqrt(std::numeric_limits<real_type>::epsilon()) * *std::max_element(diag.begin(), diag.end());
+
+    factor_.resize(size_ * max_rank_);
+    for (; rank_ < max_rank_; ++rank_) {
+        // select the largest remaining diagonal entry as pivot
+        const std::size_t pivot = static_cast<std::size_t>(std::distance(diag.begin(), std::max_element(diag.begin(), diag.end())));
+        if (!(diag[pivot] > tolerance)) {
+            break;
+        }
+        const real_type pivot_value = std::sqrt(diag[pivot]);
+        const real_type *pivot_row = factor_.data() + pivot * max_rank_;
+
+        // calculate the next column of L using the column of the pivot
+        #pragma omp parallel for
+        for (std::size_t i = 0; i < size_; ++i) {
+            real_type *row = factor_.data() + i * max_rank_;
+            real_type temp = entry(i, pivot) - (i == pivot ? shift_ : real_type{ 0.0 });
+            #pragma omp simd reduction(+ : temp)
+            for (std::size_t l = 0; l < rank_; ++l) {
+                temp -= row[l] * pivot_row[l];
+            }
+            row[rank_] = temp / pivot_value;
+            diag[i] -= row[rank_] * row[rank_];
+        }
+        diag[pivot] = real_type{ 0.0 };
+    }
+
+    // decompose the small matrix shift * I + L^T * L used in the Woodbury identity
+    inner_factor_.assign(rank_ * rank_, real_type{ 0.0 });
+    #pragma omp parallel
+    {
+        std::vector<real_type> thread_inner(rank_ * rank_, real_type{ 0.0 });
+        #pragma omp for nowait
+        for (std::size_t k = 0; k < size_; ++k) {
+            const real_type *row = factor_.data() + k * max_rank_;
+            for (std::size_t i = 0; i < rank_; ++i) {
+                #pragma omp simd
+                for (std::size_t j = 0; j <= i; ++j) {
+                    thread_inner[i * rank_ + j] += row[i] * row[j];
+                }
+            }
+        }
+        #pragma omp critical
+        for (std::size_t i = 0; i < thread_inner.size(); ++i) {
+            inner_factor_[i] += thread_inner[i];
+        }
+    }
+    for (std::size_t i = 0; i < rank_; ++i) {
+        inner_factor_[i * rank_ + i] += shift_;
+    }
+    if (!cholesky_decomposition(inner_factor_.data(), rank_, rank_)) {
+        throw exception{ "The pivoted Cholesky preconditioner is numerically singular!" };
+    }
+}
+
+template <typename T>
+void pivoted_cholesky_preconditioner<T>::apply(const std::vector<real_type> &r, std::vector<real_type> &z) const {
+    PLSSVM_ASSERT(r.size() == size_, "Sizes mismatch!: {} != {}", r.size(), size_);
+    PLSSVM_ASSERT(z.size() == r.size(), "Sizes mismatch!: {} != {}", z.size(), r.size());
+
+    // t = (shift * I + L^T * L)^-1 * L^T * r
+    std::vector<real_type> t(rank_, real_type{ 0.0 });
+    #pragma omp parallel
+    {
+        std::vector<real_type> thread_t(rank_, real_type{ 0.0 });
+        #pragma omp for nowait
+        for (std::size_t i = 0; i < size_; ++i) {
+            const real_type *row = factor_.data() + i * max_rank_;
+            #pragma omp simd
+            for (std::size_t l = 0; l < rank_; ++l) {
+                thread_t[l] += row[l] * r[i];
+            }
+        }
+        #pragma omp critical
+        for (std::size_t l = 0; l < rank_; ++l) {
+            t[l] += thread_t[l];
+        }
+    }
+    cholesky_solve(inner_factor_.data(), rank_, rank_, t.data());
+
+    // z = (r - L * t) / shift
+    #pragma omp parallel for
+    for (std::size_t i = 0; i < size_; ++i) {
+        const real_type *row = factor_.data() + i * max_rank_;
+        real_type temp = r[i];
+        #pragma omp simd reduction(+ : temp)
+        for (std::size_t l = 0; l < rank_; ++l) {
+            temp -= row[l] * t[l];
+        }
+        z[i] = temp / shift_;
+    }
+}
+
+template class pivoted_cholesky_preconditioner<float>;
+template class pivoted_cholesky_preconditioner<double>;
+
+//*************************************************************************************************************************************//
+//                                                                factory                                                              //
+//*************************************************************************************************************************************//
+template <typename T>
+std::unique_ptr<preconditioner<T>> make_preconditioner(const preconditioner_type type, const std::size_t size, const std::size_t precond_size, const T shift, const typename preconditioner<T>::entry_function_type &entry) {
+    switch (type) {
+        case preconditioner_type::none:
+            return nullptr;
+        case preconditioner_type::jacobi:
+            return std::make_unique<jacobi_preconditioner<T>>(size, entry);
+        case preconditioner_type::block_jacobi:
+            return std::make_unique<block_jacobi_preconditioner<T>>(size, precond_size, entry);
+        case preconditioner_type::pivoted_cholesky:
+            return std::make_unique<pivoted_cholesky_preconditioner<T>>(size, precond_size, shift, entry);
+    }
+    throw exception{ fmt::format("Unknown preconditioner type (value: {})!", detail::to_underlying(type)) };
+}
+
+template std::unique_ptr<preconditioner<float>> make_preconditioner(preconditioner_type, std::size_t, std::size_t, float, const typename preconditioner<float>::entry_function_type &);
+template std::unique_ptr<preconditioner<double>> make_preconditioner(preconditioner_type, std::size_t, std::size_t, double, const typename preconditioner<double>::entry_function_type &);
+
+}  // namespace plssvm::detail
@@ -0,0 +1,71 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/random_features.hpp"
+
+#include "plssvm/constants.hpp"  // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/matrix.hpp"     // plssvm::aos_matrix, plssvm::simd_padding
+
+#include <cmath>    // std::sqrt, std::log, std::cos
+#include <cstddef>  // std::size_t
+#include <random>   // std::mt19937_64
+#include <vector>   // std::vector
+
+namespace plssvm::detail {
+
+namespace {
+
+/// 2 * pi
+constexpr double two_pi = 6.283185307179586476925286766559;
+
+/**
+ * @brief Draw a uniformly distributed random number in \f$[0, 1)\f$ using the upper 53 bits of the next number of @p generator.
+ * @param[in,out] generator the random number generator
+ * @return the random number (`[[nodiscard]]`)
+ */
+[[nodiscard]] double uniform(std::mt19937_64 &generator) {
+    return static_cast<double>(generator() >> 11) * 0x1.0p-53;
+}
+
+}  // namespace
+
+template <typename T>
+std::vector<T> random_fourier_offsets(const std::size_t num_random_features, const unsigned long long seed) {
+    std::mt19937_64 generator{ seed };
+    std::vector<T> offsets(num_random_features);
+    for (T &offset : offsets) {
+        offset = static_cast<T>(two_pi * uniform(generator));
+    }
+    return offsets;
+}
+
+template std::vector<float> random_fourier_offsets(std::size_t, unsigned long long);
+template std::vector<double> random_fourier_offsets(std::size_t, unsigned long long);
+
+template <typename T>
+aos_matrix<T> random_fourier_frequencies(const std::size_t num_features, const std::size_t num_random_features, const T gamma, const unsigned long long seed) {
+    std::mt19937_64 generator{ seed };
+    // skip the offsets
+    generator.discard(num_random_features);
+
+    // the Fourier transform of exp(-gamma * |x|^2) is the density of N(0, 2 * gamma * I), sampled using the Box-Muller transform
+    const double stddev = std::sqrt(2.0 * static_cast<double>(gamma));
+    aos_matrix<T> frequencies{ num_random_features, num_features, static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE), simd_padding<T>(num_features) };
+    for (std::size_t feature = 0; feature < num_features; ++feature) {
+        for (std::size_t k = 0; k < num_random_features; ++k) {
+            const double radius = std::sqrt(-2.0 * std::log(1.0 - uniform(generator)));
+            frequencies(k, feature) = static_cast<T>(stddev * radius * std::cos(two_pi * uniform(generator)));
+        }
+    }
+    return frequencies;
+}
+
+template aos_matrix<float> random_fourier_frequencies(std::size_t, std::size_t, float, unsigned long long);
+template aos_matrix<double> random_fourier_frequencies(std::size_t, std::size_t, double, unsigned long long);
+
+}  // namespace plssvm::detail
@@ -0,0 +1,428 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/grid_search.hpp"
+
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/conjugate_gradients.hpp"   // plssvm::detail::conjugate_gradients
+#include "plssvm/detail/fast_exp.hpp"              // plssvm::detail::kernel_exp, plssvm::detail::dispatch_fast_exp
+#include "plssvm/detail/integer_pow.hpp"           // plssvm::detail::integer_pow
+#include "plssvm/detail/operators.hpp"             // dot product
+#include "plssvm/detail/preconditioner.hpp"        // plssvm::detail::preconditioner, plssvm::detail::make_preconditioner
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+#include "plssvm/detail/utility.hpp"               // plssvm::detail::always_false_v, plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::exception, plssvm::unsupported_kernel_type_exception
+#include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type, plssvm::kernel_function
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix
+#include "plssvm/parameter.hpp"                    // plssvm::parameter
+
+#include "fmt/chrono.h"   // format std::chrono
+#include "fmt/core.h"     // fmt::print, fmt::format
+#include "fmt/ostream.h"  // can use fmt using operator<< overloads
+
+#include <algorithm>    // std::max, std::sort, std::unique
+#include <chrono>       // std::chrono::stead_clock, std::chrono::duration_cast, std::chrono::milliseconds
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <exception>    // std::exception_ptr, std::exception, std::current_exception, std::rethrow_exception
+#include <fstream>      // std::ifstream, std::ofstream
+#include <ios>          // std::ios, std::streamsize
+#include <memory>       // std::unique_ptr
+#include <string>       // std::string
+#include <type_traits>  // std::bool_constant
+#include <vector>       // std::vector
+
+namespace plssvm {
+
+namespace detail {
+
+/**
+ * @brief Return the index of the entry (@p i, @p j) with @p j <= @p i in a lower triangular matrix stored packed row by row.
+ */
+[[nodiscard]] inline std::size_t packed_index(const std::size_t i, const std::size_t j) noexcept {
+    PLSSVM_ASSERT(j <= i, "Not in the lower triangle!: {} > {}", j, i);
+    return i * (i + 1) / 2 + j;
+}
+
+/**
+ * @brief Transform the Gram matrix entry @p gram_ij with the diagonal entries @p gram_ii and @p gram_jj to the kernel matrix entry of the @p kernel function with the parameters of @p point.
+ * @details The rbf kernel function uses fast_exp() instead of `std::exp` if @p use_fast_exp is `true` (see dispatch_fast_exp()).
+ */
+template <kernel_type kernel, typename real_type, bool use_fast_exp>
+[[nodiscard]] inline real_type kernel_from_gram(const real_type gram_ij, const real_type gram_ii, const real_type gram_jj, const grid_point<real_type> &point, [[maybe_unused]] const std::bool_constant<use_fast_exp> fast_exp) {
+    if constexpr (kernel == kernel_type::linear) {
+        return gram_ij;
+    } else if constexpr (kernel == kernel_type::polynomial) {
+        return integer_pow(point.gamma * gram_ij + point.coef0, point.degree);
+    } else if constexpr (kernel == kernel_type::rbf) {
+        // the squared euclidean distance may become slightly negative due to cancellation
+        return kernel_exp(-point.gamma * std::max(gram_ii + gram_jj - 2 * gram_ij, real_type{ 0.0 }), fast_exp);
+    } else {
+        static_assert(always_false_v<real_type>, "Unknown kernel type!");
+    }
+}
+
+/**
+ * @brief Compute the kernel matrix of all @p num_data_points data points of the @p kernel function with the parameters of @p point from the Gram matrix @p gram.
+ * @details If @p fast_exp is `true`, the rbf kernel function uses fast_exp() instead of `std::exp`.
+ * @return the lower triangle of the kernel matrix, stored packed row by row (see packed_index())
+ */
+template <kernel_type kernel, typename real_type>
+[[nodiscard]] std::vector<real_type> kernel_matrix_from_gram(const std::vector<real_type> &gram, const std::size_t num_data_points, const grid_point<real_type> &point, const bool fast_exp) {
+    std::vector<real_type> diagonal(num_data_points);
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        diagonal[i] = gram[packed_index(i, i)];
+    }
+
+    std::vector<real_type> kernel_matrix(gram.size());
+    dispatch_fast_exp(fast_exp, [&](const auto fast_exp_value) {
+        #pragma omp parallel for schedule(dynamic)
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            const std::size_t row = packed_index(i, 0);
+            for (std::size_t j = 0; j <= i; ++j) {
+                kernel_matrix[row + j] = kernel_from_gram<kernel>(gram[row + j], diagonal[i], diagonal[j], point, fast_exp_value);
+            }
+        }
+    });
+    return kernel_matrix;
+}
+
+/**
+ * @brief Calculate the 64-bit FNV-1a hash of the bytes of all values in @p data (without padding).
+ * @details Identifies the data set a cached Gram matrix belongs to. Not suited for cryptographic purposes.
+ */
+template <typename real_type>
+[[nodiscard]] std::uint64_t hash_data(const aos_matrix<real_type> &data) {
+    std::uint64_t hash{ 14695981039346656037ULL };
+    for (std::size_t i = 0; i < data.num_rows(); ++i) {
+        const auto *bytes = reinterpret_cast<const unsigned char *>(data.row_data(i));
+        for (std::size_t b = 0; b < data.num_cols() * sizeof(real_type); ++b) {
+            hash = (hash ^ bytes[b]) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+/// The identifier of the current Gram matrix cache file format ("PLSSVM" followed by the format version 2, i.e., the packed lower triangle).
+constexpr std::uint64_t gram_cache_format{ 0x504C5353564D0002ULL };
+
+/// The header of a Gram matrix cache file.
+struct gram_cache_header {
+    /// The format of the cache file (see gram_cache_format).
+    std::uint64_t format;
+    /// The number of data points.
+    std::uint64_t num_data_points;
+    /// The number of features per data point.
+    std::uint64_t num_features;
+    /// The size of a single Gram matrix entry in bytes.
+    std::uint64_t value_size;
+    /// The hash of the data points the Gram matrix has been computed for (see hash_data()).
+    std::uint64_t data_hash;
+};
+
+}  // namespace detail
+
+template <typename T>
+grid_search<T>::grid_search(const parameter<T> &params, const std::string &gram_cache_filename) :
+    kernel_{ params.kernel }, epsilon_{ params.epsilon }, replace_threshold_{ params.replace_threshold }, replace_interval_{ params.replace_interval }, preconditioner_{ params.preconditioner }, precond_size_{ params.precond_size }, fast_math_kernels_{ params.fast_math_kernels }, print_info_{ params.print_info }, data_ptr_{ params.data_ptr }, value_ptr_{ params.value_ptr } {
+    if (data_ptr_ == nullptr) {
+        throw exception{ "No data points provided!" };
+    } else if (data_ptr_->num_rows() == 0) {
+        throw exception{ "Data set is empty!" };
+    } else if (value_ptr_ == nullptr) {
+        throw exception{ "No labels given for the grid search! Maybe the data is only usable for prediction?" };
+    } else if (data_ptr_->num_rows() != value_ptr_->size()) {
+        throw exception{ fmt::format("Number of labels ({}) must match the number of data points ({})!", value_ptr_->size(), data_ptr_->num_rows()) };
+    }
+    // the values are only the signs of the original labels -> check the original labels for more than two classes
+    if (params.label_ptr != nullptr) {
+        std::vector<real_type> classes(*params.label_ptr);
+        std::sort(classes.begin(), classes.end());
+        if (std::unique(classes.begin(), classes.end()) - classes.begin() > 2) {
+            throw exception{ "Grid search is only supported for two classes!" };
+        }
+    }
+
+    num_data_points_ = data_ptr_->num_rows();
+
+    if (!gram_cache_filename.empty() && read_gram_matrix(gram_cache_filename)) {
+        return;
+    }
+    compute_gram_matrix();
+    if (!gram_cache_filename.empty()) {
+        write_gram_matrix(gram_cache_filename);
+    }
+}
+
+template <typename T>
+auto grid_search<T>::make_grid(const kernel_type kernel, const std::vector<real_type> &gammas, const std::vector<real_type> &coef0s, const std::vector<int> &degrees, const std::vector<real_type> &costs) -> std::vector<grid_point<real_type>> {
+    if (gammas.empty() || coef0s.empty() || degrees.empty() || costs.empty()) {
+        throw exception{ "At least one value must be given for each hyperparameter of the grid!" };
+    }
+    for (const real_type cost : costs) {
+        if (cost <= real_type{ 0.0 }) {
+            throw exception{ fmt::format("All costs of the grid must be positive, but {} isn't!", cost) };
+        }
+    }
+
+    // only vary the hyperparameters used by the kernel function
+    const std::size_t num_gammas = kernel == kernel_type::linear ? 1 : gammas.size();
+    const std::size_t num_coef0s = kernel == kernel_type::polynomial ? coef0s.size() : 1;
+    const std::size_t num_degrees = kernel == kernel_type::polynomial ? degrees.size() : 1;
+
+    std::vector<grid_point<real_type>> grid;
+    grid.reserve(num_gammas * num_coef0s * num_degrees * costs.size());
+    for (std::size_t g = 0; g < num_gammas; ++g) {
+        for (std::size_t r = 0; r < num_coef0s; ++r) {
+            for (std::size_t d = 0; d < num_degrees; ++d) {
+                for (const real_type cost : costs) {
+                    grid.push_back(grid_point<real_type>{ gammas[g], coef0s[r], degrees[d], cost, real_type{ 0.0 } });
+                }
+            }
+        }
+    }
+    return grid;
+}
+
+template <typename T>
+auto grid_search<T>::evaluate(std::vector<grid_point<real_type>> grid, const std::size_t num_folds) const -> std::vector<grid_point<real_type>> {
+    if (num_folds < 2 || num_folds > num_data_points_) {
+        throw exception{ fmt::format("The number of folds ({}) must be in the range [2, {}]!", num_folds, num_data_points_) };
+    }
+    // each fold needs at least two training data points
+    if (num_data_points_ - (num_data_points_ + num_folds - 1) / num_folds < 2) {
+        throw exception{ fmt::format("At least two training data points are necessary for each fold, but only {} data points are given!", num_data_points_) };
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    // the grid points only differing in the cost share the same kernel matrix; the kernel matrix of the linear kernel function is the Gram matrix itself
+    std::vector<bool> evaluated(grid.size(), false);
+    for (std::size_t first = 0; first < grid.size(); ++first) {
+        if (evaluated[first]) {
+            continue;
+        }
+        std::vector<std::size_t> group;
+        for (std::size_t i = first; i < grid.size(); ++i) {
+            if (!evaluated[i] && same_kernel_matrix(grid[first], grid[i])) {
+                group.push_back(i);
+                evaluated[i] = true;
+            }
+        }
+
+        // compute the kernel matrix once and evaluate all folds of all costs concurrently
+        const std::vector<real_type> transformed_gram = kernel_ == kernel_type::linear ? std::vector<real_type>{} : compute_kernel_matrix(grid[first]);
+        const std::vector<real_type> &kernel_matrix = kernel_ == kernel_type::linear ? gram_ : transformed_gram;
+        const std::size_t num_tasks = group.size() * num_folds;
+        std::vector<std::size_t> correct(num_tasks);
+        std::exception_ptr parallel_exception;
+        #pragma omp parallel for schedule(dynamic)
+        for (std::size_t task = 0; task < num_tasks; ++task) {
+            try {
+                correct[task] = evaluate_fold(kernel_matrix, grid[group[task / num_folds]].cost, task % num_folds, num_folds);
+            } catch (const std::exception &) {
+                // catch the first exception (e.g., of the preconditioner) and store it
+                #pragma omp critical
+                {
+                    if (!parallel_exception) {
+                        parallel_exception = std::current_exception();
+                    }
+                }
+            }
+        }
+        // rethrow if an exception occurred inside the parallel region
+        if (parallel_exception) {
+            std::rethrow_exception(parallel_exception);
+        }
+
+        for (std::size_t g = 0; g < group.size(); ++g) {
+            std::size_t num_correct = 0;
+            for (std::size_t fold = 0; fold < num_folds; ++fold) {
+                num_correct += correct[g * num_folds + fold];
+            }
+            grid[group[g]].accuracy = static_cast<real_type>(num_correct) / static_cast<real_type>(num_data_points_);
+        }
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Evaluated {} grid points using {}-fold cross-validation in {}.\n", grid.size(), num_folds, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+
+    return grid;
+}
+
+template <typename T>
+std::size_t grid_search<T>::evaluate_fold(const std::vector<real_type> &kernel_matrix, const real_type cost, const std::size_t fold, const std::size_t num_folds) const {
+    using namespace plssvm::operators;
+
+    const std::vector<real_type> &labels = *value_ptr_;
+
+    // split the data points into the training and validation data points
+    std::vector<std::size_t> train;
+    std::vector<std::size_t> validation;
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        (i % num_folds == fold ? validation : train).push_back(i);
+    }
+    PLSSVM_ASSERT(train.size() >= 2, "At least two training data points are necessary!");
+
+    const std::size_t last = train.back();
+    const std::size_t dept = train.size() - 1;
+    const auto kernel_value = [&](const std::size_t i, const std::size_t j) {
+        return i >= j ? kernel_matrix[detail::packed_index(i, j)] : kernel_matrix[detail::packed_index(j, i)];
+    };
+
+    // setup the least-squares matrix equation
+    std::vector<real_type> q(dept);
+    std::vector<real_type> b(dept);
+    for (std::size_t i = 0; i < dept; ++i) {
+        q[i] = kernel_value(train[i], last);
+        b[i] = labels[train[i]] - labels[last];
+    }
+    const real_type QA_cost = kernel_value(last, last) + 1 / cost;
+
+    // ret += add * (K - q 1^T - 1 q^T + QA_cost 1 1^T + I / cost) * d
+    const auto matvec = [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+        const real_type sum_d = sum(d);
+        const real_type q_d = transposed{ q } * d;
+        for (std::size_t i = 0; i < dept; ++i) {
+            ret[i] += add * ((QA_cost - q[i]) * sum_d - q_d + d[i] / cost);
+        }
+        // the training data points are sorted, i.e., each off-diagonal entry of their rows in the lower triangle contributes to both rows
+        for (std::size_t i = 0; i < dept; ++i) {
+            const real_type *kernel_row = kernel_matrix.data() + detail::packed_index(train[i], 0);
+            real_type temp = kernel_row[train[i]] * d[i];
+            for (std::size_t j = 0; j < i; ++j) {
+                temp += kernel_row[train[j]] * d[j];
+                ret[j] += add * kernel_row[train[j]] * d[i];
+            }
+            ret[i] += add * temp;
+        }
+    };
+
+    // solve the equation like plssvm::csvm::learn(): same initial guess, maximum number of iterations, preconditioner, and residual replacement
+    const auto entry = [&](const std::size_t i, const std::size_t j) {
+        return kernel_value(train[i], train[j]) + QA_cost - q[i] - q[j] + (i == j ? 1 / cost : real_type{ 0.0 });
+    };
+    const std::unique_ptr<detail::preconditioner<real_type>> precond = detail::make_preconditioner<real_type>(preconditioner_, dept, precond_size_, 1 / cost, entry);
+    std::size_t num_iterations = 0;
+    std::vector<real_type> alpha = detail::conjugate_gradients(b, std::vector<real_type>(dept, real_type{ 1.0 }), data_ptr_->num_cols(), epsilon_, precond.get(), detail::residual_replacement<real_type>{ replace_threshold_, replace_interval_ }, matvec, num_iterations, false);
+
+    const real_type bias = labels[last] + QA_cost * sum(alpha) - (transposed{ q } * alpha);
+    alpha.push_back(-sum(alpha));
+
+    // predict the validation data points
+    std::size_t correct = 0;
+    for (const std::size_t v : validation) {
+        real_type decision = bias;
+        for (std::size_t i = 0; i < train.size(); ++i) {
+            decision += alpha[i] * kernel_value(train[i], v);
+        }
+        if (decision * labels[v] > real_type{ 0.0 }) {
+            ++correct;
+        }
+    }
+    return correct;
+}
+
+template <typename T>
+bool grid_search<T>::same_kernel_matrix(const grid_point<real_type> &lhs, const grid_point<real_type> &rhs) const noexcept {
+    switch (kernel_) {
+        case kernel_type::linear:
+            return true;
+        case kernel_type::polynomial:
+            return lhs.gamma == rhs.gamma && lhs.coef0 == rhs.coef0 && lhs.degree == rhs.degree;
+        case kernel_type::rbf:
+            return lhs.gamma == rhs.gamma;
+    }
+    return false;
+}
+
+template <typename T>
+auto grid_search<T>::compute_kernel_matrix(const grid_point<real_type> &point) const -> std::vector<real_type> {
+    switch (kernel_) {
+        case kernel_type::linear:
+            return gram_;
+        case kernel_type::polynomial:
+            return detail::kernel_matrix_from_gram<kernel_type::polynomial>(gram_, num_data_points_, point, fast_math_kernels_);
+        case kernel_type::rbf:
+            return detail::kernel_matrix_from_gram<kernel_type::rbf>(gram_, num_data_points_, point, fast_math_kernels_);
+    }
+    throw unsupported_kernel_type_exception{ fmt::format("Unknown kernel type (value: {})!", detail::to_underlying(kernel_)) };
+}
+
+template <typename T>
+void grid_search<T>::compute_gram_matrix() {
+    const auto start_time = std::chrono::steady_clock::now();
+
+    const std::size_t num_features = data_ptr_->num_cols();
+    gram_.resize(num_data_points_ * (num_data_points_ + 1) / 2);
+
+    // compute the lower triangular matrix
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t i = 0; i < num_data_points_; ++i) {
+        const std::size_t row = detail::packed_index(i, 0);
+        for (std::size_t j = 0; j <= i; ++j) {
+            gram_[row + j] = kernel_function<kernel_type::linear>(data_ptr_->row_data(i), data_ptr_->row_data(j), num_features);
+        }
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (print_info_) {
+        fmt::print("Computed the {}x{} Gram matrix in {}.\n", num_data_points_, num_data_points_, std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+    }
+}
+
+template <typename T>
+bool grid_search<T>::read_gram_matrix(const std::string &filename) {
+    std::ifstream in{ filename, std::ios::binary };
+    if (!in) {
+        return false;
+    }
+
+    detail::gram_cache_header header{};
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || header.format != detail::gram_cache_format || header.num_data_points != num_data_points_ || header.num_features != data_ptr_->num_cols() || header.value_size != sizeof(real_type) || header.data_hash != detail::hash_data(*data_ptr_)) {
+        if (print_info_) {
+            fmt::print("The Gram matrix cache '{}' doesn't match the data set and is recomputed.\n", filename);
+        }
+        return false;
+    }
+
+    std::vector<real_type> gram(num_data_points_ * (num_data_points_ + 1) / 2);
+    in.read(reinterpret_cast<char *>(gram.data()), static_cast<std::streamsize>(gram.size() * sizeof(real_type)));
+    if (!in) {
+        if (print_info_) {
+            fmt::print("The Gram matrix cache '{}' is incomplete and is recomputed.\n", filename);
+        }
+        return false;
+    }
+
+    gram_ = std::move(gram);
+    if (print_info_) {
+        fmt::print("Read the {}x{} Gram matrix from '{}'.\n", num_data_points_, num_data_points_, filename);
+    }
+    return true;
+}
+
+template <typename T>
+void grid_search<T>::write_gram_matrix(const std::string &filename) const {
+    std::ofstream out{ filename, std::ios::binary | std::ios::trunc };
+    const detail::gram_cache_header header{ detail::gram_cache_format, num_data_points_, data_ptr_->num_cols(), sizeof(real_type), detail::hash_data(*data_ptr_) };
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(gram_.data()), static_cast<std::streamsize>(gram_.size() * sizeof(real_type)));
+    if (!out) {
+        throw exception{ fmt::format("Couldn't write the Gram matrix cache '{}'!", filename) };
+    }
+}
+
+// explicitly instantiate template class
+template class grid_search<float>;
+template class grid_search<double>;
+
+}  // namespace plssvm
@@ -8,25 +8,30 @@
 
 #include "plssvm/parameter.hpp"
 
+#include "plssvm/constants.hpp"                     // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 #include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
 #include "plssvm/detail/file_reader.hpp"           // plssvm::detail::file_reader
+#include "plssvm/detail/random_features.hpp"       // plssvm::detail::random_fourier_frequencies
 #include "plssvm/detail/string_conversion.hpp"     // plssvm::detail::convert_to
 #include "plssvm/detail/string_utility.hpp"        // plssvm::detail::starts_with, plssvm::detail::ends_with, plssvm::detail::trim_left,
                                                    // plssvm::detail::to_lower_case, plssvm::detail::to_upper_case
 #include "plssvm/detail/operators.hpp"             // plssvm::operators::sign
 #include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_file_format_exception
 #include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix, plssvm::simd_padding
 
 #include "fmt/chrono.h"   // format std::chrono
 #include "fmt/core.h"     // fmt::format, fmt::print
+#include "fmt/format.h"   // fmt::join
 #include "fmt/ostream.h"  // can use fmt using operator<< overloads
 
-#include <algorithm>    // std::max, std::min, std::fill
+#include <algorithm>    // std::max, std::max_element, std::min, std::fill, std::count
 #include <chrono>       // std::chrono::stead_clock, std::chrono::duration_cast, std::chrono::milliseconds
 #include <exception>    // std::exception_ptr, std::exception, std::current_exception, std::rethrow_exception
 #include <iostream>     // std::ostream
 #include <limits>       // std::numeric_limits
 #include <memory>       // std::make_shared, std::shared_ptr
+#include <numeric>      // std::accumulate
 #include <sstream>      // std::istringstream
 #include <string>       // std::string
 #include <string_view>  // std::string_view
@@ -37,54 +42,20 @@ namespace plssvm {
 
 namespace detail {
 
-template <typename real_type>
-void parse_libsvm_content(const file_reader &f, const std::size_t start, std::vector<std::vector<real_type>> &data, std::vector<real_type> &values) {
-    std::size_t max_size = 0;
+/**
+ * @brief Call @p func for each index in `[0, size)` in parallel. The first exception thrown by @p func is rethrown after the parallel region.
+ */
+template <typename Func>
+void parallel_for_each_line(const std::size_t size, Func func) {
     std::exception_ptr parallel_exception;
 
     #pragma omp parallel
     {
-        #pragma omp for reduction(max \
-                          : max_size)
-        for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size(); ++i) {
+        #pragma omp for
+        for (std::size_t i = 0; i < size; ++i) {
             #pragma omp cancellation point for
             try {
-                std::string_view line = f.line(i + start);
-
-                // check if class labels are present (not necessarily the case for test files)
-                std::string_view::size_type pos = line.find_first_of(" \n");
-                std::string_view::size_type first_colon = line.find_first_of(":\n");
-                if (first_colon >= pos) {
-                    // get class or alpha
-                    values[i] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(0, pos));
-                } else {
-                    values[0] = std::numeric_limits<real_type>::max();
-                    pos = 0;
-                }
-
-                // get data
-                std::vector<real_type> vline(max_size);
-                while (true) {
-                    std::string_view::size_type next_pos = line.find_first_of(':', pos);
-                    // no further data points
-                    if (next_pos == std::string_view::npos) {
-                        break;
-                    }
-
-                    // get index
-                    const auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-                    if (index >= vline.size()) {
-                        vline.resize(index + 1);
-                    }
-                    pos = next_pos + 1;
-
-                    // get value
-                    next_pos = line.find_first_of(' ', pos);
-                    vline[index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-                    pos = next_pos;
-                }
-                max_size = std::max(max_size, vline.size());
-                data[i] = std::move(vline);
+                func(i);
             } catch (const std::exception &) {
                 // catch first exception and store it
                 #pragma omp critical
@@ -103,23 +74,112 @@ void parse_libsvm_content(const file_reader &f, const std::size_t start, std::ve
     if (parallel_exception) {
         std::rethrow_exception(parallel_exception);
     }
+}
 
+/**
+ * @brief Convert all whitespace separated values in @p str to values of type @p T.
+ */
+template <typename T>
+std::vector<T> convert_all_to(std::string_view str) {
+    std::vector<T> values;
+    str = trim_left(str);
+    while (!str.empty()) {
+        const std::string_view value = str.substr(0, str.find_first_of(" \t"));
+        values.push_back(convert_to<T, invalid_file_format_exception>(value));
+        str.remove_prefix(value.size());
+        str = trim_left(str);
+    }
+    return values;
+}
+
+/**
+ * @brief Parse the LIBSVM data points starting at line @p start of @p f. Each line may start with @p num_values values (e.g., the label or the weights per class), stored row-major in @p values.
+ */
+template <typename real_type>
+aos_matrix<real_type> parse_libsvm_content(const file_reader &f, const std::size_t start, std::vector<real_type> &values, const std::size_t num_values = 1) {
+    const std::size_t num_points = values.size() / num_values;
+    // the offset of the first feature per line (after the optional label)
+    std::vector<std::string_view::size_type> data_begin(num_points);
+    // the largest feature index per line
+    std::vector<std::size_t> max_index(num_points, 0);
+
+    // first pass: parse the labels and determine the number of features without storing any feature values
+    parallel_for_each_line(num_points, [&](const std::size_t i) {
+        const std::string_view line = f.line(i + start);
+
+        // check if class labels are present (not necessarily the case for test files)
+        std::string_view::size_type pos = line.find_first_of(" \n");
+        const std::string_view::size_type first_colon = line.find_first_of(":\n");
+        if (first_colon >= pos) {
+            // get class or alpha
+            values[i * num_values] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(0, pos));
+            // get the remaining alphas of a multi-class model
+            for (std::size_t v = 1; v < num_values; ++v) {
+                const std::string_view::size_type value_begin = line.find_first_not_of(' ', pos);
+                pos = line.find_first_of(" \n", value_begin);
+                if (value_begin == std::string_view::npos || line.substr(value_begin, pos - value_begin).find(':') != std::string_view::npos) {
+                    throw invalid_file_format_exception{ fmt::format("Missing weights for data point {}! Found {} but should be {}!", i, v, num_values) };
+                }
+                values[i * num_values + v] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(value_begin, pos - value_begin));
+            }
+        } else {
+            values[0] = std::numeric_limits<real_type>::max();
+            pos = 0;
+        }
+        data_begin[i] = pos;
+
+        while (true) {
+            const std::string_view::size_type next_pos = line.find_first_of(':', pos);
+            // no further data points
+            if (next_pos == std::string_view::npos) {
+                break;
+            }
+            // get index
+            const auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+            max_index[i] = std::max<std::size_t>(max_index[i], index + 1);
+            // skip value
+            pos = line.find_first_of(' ', next_pos + 1);
+        }
+    });
+
+    const std::size_t num_features = num_points == 0 ? 0 : *std::max_element(max_index.begin(), max_index.end());
     // no features were parsed -> invalid file
-    if (max_size == 0) {
+    if (num_features == 0) {
         throw invalid_file_format_exception{ fmt::format("Can't parse file: no data points are given!") };
     }
 
-    #pragma omp parallel for
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size(); ++i) {
-        data[i].resize(max_size);
-    }
+    // second pass: write the feature values directly into the padded matrix
+    aos_matrix<real_type> data{ num_points, num_features, static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE), simd_padding<real_type>(num_features) };
+    parallel_for_each_line(num_points, [&](const std::size_t i) {
+        const std::string_view line = f.line(i + start);
+        real_type *point = data.row_data(i);
+        std::string_view::size_type pos = data_begin[i];
+        while (true) {
+            std::string_view::size_type next_pos = line.find_first_of(':', pos);
+            // no further data points
+            if (next_pos == std::string_view::npos) {
+                break;
+            }
+
+            // get index
+            const auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+            pos = next_pos + 1;
+
+            // get value
+            next_pos = line.find_first_of(' ', pos);
+            point[index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+            pos = next_pos;
+        }
+    });
+
+    return data;
 }
 
 }  // namespace detail
 
 // read and parse file
 template <typename T>
-void parameter<T>::parse_file(const std::string &filename, std::shared_ptr<const std::vector<std::vector<real_type>>> &data_ptr_ref) {
+void parameter<T>::parse_file(const std::string &filename, std::shared_ptr<const aos_matrix<real_type>> &data_ptr_ref) {
     if (detail::ends_with(filename, ".arff")) {
         parse_arff_file(filename, data_ptr_ref);
     } else {
@@ -129,7 +189,7 @@ void parameter<T>::parse_file(const std::string &filename, std::shared_ptr<const
 
 // read and parse a libsvm file
 template <typename T>
-void parameter<T>::parse_libsvm_file(const std::string &filename, std::shared_ptr<const std::vector<std::vector<real_type>>> &data_ptr_ref) {
+void parameter<T>::parse_libsvm_file(const std::string &filename, std::shared_ptr<const aos_matrix<real_type>> &data_ptr_ref) {
     auto start_time = std::chrono::steady_clock::now();
 
     // set new filenames
@@ -141,22 +201,24 @@ void parameter<T>::parse_libsvm_file(const std::string &filename, std::shared_pt
 
     detail::file_reader f{ filename, '#' };
 
-    std::vector<std::vector<real_type>> data(f.num_lines());
     std::vector<real_type> value(f.num_lines());
 
-    detail::parse_libsvm_content(f, 0, data, value);
+    aos_matrix<real_type> data = detail::parse_libsvm_content(f, 0, value);
 
     // update gamma
     if (gamma == real_type{ 0.0 }) {
-        gamma = real_type{ 1. } / static_cast<real_type>(data[0].size());
+        gamma = real_type{ 1. } / static_cast<real_type>(data.num_cols());
     }
 
     // update shared pointer
-    data_ptr_ref = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(data));
+    data_ptr_ref = std::make_shared<const aos_matrix<real_type>>(std::move(data));
     if (value[0] == std::numeric_limits<real_type>::max()) {
         // no labels present
         value_ptr = nullptr;
+        label_ptr = nullptr;
     } else {
+        label_ptr = std::make_shared<const std::vector<real_type>>(value);
+
         #pragma omp parallel for
         for (typename std::vector<real_type>::size_type i = 0; i < value.size(); ++i) {
             value[i] = plssvm::operators::sign(value[i]);
@@ -168,15 +230,15 @@ void parameter<T>::parse_libsvm_file(const std::string &filename, std::shared_pt
     auto end_time = std::chrono::steady_clock::now();
     if (print_info) {
         fmt::print("Read {} data points with {} features in {} using the libsvm parser.\n",
-                   data_ptr_ref->size(),
-                   (*data_ptr_ref)[0].size(),
+                   data_ptr_ref->num_rows(),
+                   data_ptr_ref->num_cols(),
                    std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
     }
 }
 
 // read and parse an ARFF file
 template <typename T>
-void parameter<T>::parse_arff_file(const std::string &filename, std::shared_ptr<const std::vector<std::vector<real_type>>> &data_ptr_ref) {
+void parameter<T>::parse_arff_file(const std::string &filename, std::shared_ptr<const aos_matrix<real_type>> &data_ptr_ref) {
     auto start_time = std::chrono::steady_clock::now();
 
     // set new filenames
@@ -226,117 +288,89 @@ void parameter<T>::parse_arff_file(const std::string &filename, std::shared_ptr<
         throw invalid_file_format_exception{ "Can't parse file: no data points are given or @DATA is missing!" };
     }
 
-    std::vector<std::vector<real_type>> data(f.num_lines() - (header + 1));
     std::vector<real_type> value(f.num_lines() - (header + 1));
 
     const std::size_t num_features = has_label ? max_size - 1 : max_size;
 
-    #pragma omp parallel for
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size(); ++i) {
-        data[i].resize(num_features);
-    }
+    aos_matrix<real_type> data{ value.size(), num_features, static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE), simd_padding<real_type>(num_features) };
 
-    std::exception_ptr parallel_exception;
+    detail::parallel_for_each_line(value.size(), [&](const std::size_t i) {
+        std::string_view line = f.line(i + header + 1);
+        //
+        if (detail::starts_with(line, '@')) {
+            // read @ inside data section
+            throw invalid_file_format_exception{ fmt::format("Read @ inside data section!: '{}'", line) };
+        }
 
-    #pragma omp parallel
-    {
-        #pragma omp for
-        for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size(); ++i) {
-            #pragma omp cancellation point for
-            try {
-                std::string_view line = f.line(i + header + 1);
-                //
-                if (detail::starts_with(line, '@')) {
-                    // read @ inside data section
-                    throw invalid_file_format_exception{ fmt::format("Read @ inside data section!: '{}'", line) };
+        // parse sparse or dense data point definition
+        if (detail::starts_with(line, '{')) {
+            // missing closing }
+            if (!detail::ends_with(line, '}')) {
+                throw invalid_file_format_exception{ fmt::format("Missing closing '}}' for sparse data point {} description!", i) };
+            }
+            // sparse line
+            bool is_class_set = false;
+            std::string_view::size_type pos = 1;
+            while (true) {
+                std::string_view::size_type next_pos = line.find_first_of(' ', pos);
+                // no further data points
+                if (next_pos == std::string_view::npos) {
+                    break;
                 }
 
-                // parse sparse or dense data point definition
-                if (detail::starts_with(line, '{')) {
-                    // missing closing }
-                    if (!detail::ends_with(line, '}')) {
-                        throw invalid_file_format_exception{ fmt::format("Missing closing '}}' for sparse data point {} description!", i) };
-                    }
-                    // sparse line
-                    bool is_class_set = false;
-                    std::string_view::size_type pos = 1;
-                    while (true) {
-                        std::string_view::size_type next_pos = line.find_first_of(' ', pos);
-                        // no further data points
-                        if (next_pos == std::string_view::npos) {
-                            break;
-                        }
-
-                        // get index
-                        const auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-                        if (index >= max_size) {
-                            // index too big for specified number of features
-                            throw invalid_file_format_exception{ fmt::format("Too many features given! Trying to add feature at position {} but max position is {}!", index, num_features - 1) };
-                        }
-                        pos = next_pos + 1;
-
-                        // get value
-                        next_pos = line.find_first_of(",}", pos);
-
-                        // write parsed value depending on the index
-                        if (index == max_size - 1 && has_label) {
-                            is_class_set = true;
-                            value[i] = plssvm::operators::sign(detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos)));
-                        } else {
-                            data[i][index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-                        }
-
-                        // remove already processes part of the line
-                        line.remove_prefix(next_pos + 1);
-                        line = detail::trim_left(line);
-                        pos = 0;
-                    }
-                    // no class label found
-                    if (!is_class_set && has_label) {
-                        throw invalid_file_format_exception{ fmt::format("Missing label for data point {}!", i) };
-                    }
+                // get index
+                const auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+                if (index >= max_size) {
+                    // index too big for specified number of features
+                    throw invalid_file_format_exception{ fmt::format("Too many features given! Trying to add feature at position {} but max position is {}!", index, num_features - 1) };
+                }
+                pos = next_pos + 1;
+
+                // get value
+                next_pos = line.find_first_of(",}", pos);
+
+                // write parsed value depending on the index
+                if (index == max_size - 1 && has_label) {
+                    is_class_set = true;
+                    value[i] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos));
                 } else {
-                    // dense line
-                    std::string_view::size_type pos = 0;
-                    std::string_view::size_type next_pos = 0;
-                    for (std::size_t j = 0; j < max_size - 1; ++j) {
-                        next_pos = line.find_first_of(',', pos);
-                        if (next_pos == std::string_view::npos) {
-                            throw invalid_file_format_exception{ fmt::format("Invalid number of features/labels! Found {} but should be {}!", j, max_size - 1) };
-                        }
-                        data[i][j] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-                        pos = next_pos + 1;
-                    }
-                    // write last number to the correct vector (based on the fact whether labels are present or not)
-                    if (has_label) {
-                        value[i] = plssvm::operators::sign(detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos)));
-                    } else {
-                        data[i][num_features - 1] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos));
-                    }
-                    // check whether superfluous data points are left
-                    next_pos = line.find_first_of(',', pos);
-                    if (next_pos != std::string_view::npos) {
-                        throw invalid_file_format_exception{ fmt::format("Too many features! Superfluous '{}' for data point {}!", line.substr(next_pos), i) };
-                    }
+                    data(i, index) = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
                 }
-            } catch (const std::exception &) {
-                // catch first exception and store it
-                #pragma omp critical
-                {
-                    if (!parallel_exception) {
-                        parallel_exception = std::current_exception();
-                    }
+
+                // remove already processes part of the line
+                line.remove_prefix(next_pos + 1);
+                line = detail::trim_left(line);
+                pos = 0;
+            }
+            // no class label found
+            if (!is_class_set && has_label) {
+                throw invalid_file_format_exception{ fmt::format("Missing label for data point {}!", i) };
+            }
+        } else {
+            // dense line
+            std::string_view::size_type pos = 0;
+            std::string_view::size_type next_pos = 0;
+            for (std::size_t j = 0; j < max_size - 1; ++j) {
+                next_pos = line.find_first_of(',', pos);
+                if (next_pos == std::string_view::npos) {
+                    throw invalid_file_format_exception{ fmt::format("Invalid number of features/labels! Found {} but should be {}!", j, max_size - 1) };
                 }
-                // cancel parallel execution, needs env variable OMP_CANCELLATION=true
-                #pragma omp cancel for
+                data(i, j) = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+                pos = next_pos + 1;
+            }
+            // write last number to the correct vector (based on the fact whether labels are present or not)
+            if (has_label) {
+                value[i] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos));
+            } else {
+                data(i, num_features - 1) = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos));
+            }
+            // check whether superfluous data points are left
+            next_pos = line.find_first_of(',', pos);
+            if (next_pos != std::string_view::npos) {
+                throw invalid_file_format_exception{ fmt::format("Too many features! Superfluous '{}' for data point {}!", line.substr(next_pos), i) };
             }
         }
-    }
-
-    // rethrow if an exception occurred inside the parallel region
-    if (parallel_exception) {
-        std::rethrow_exception(parallel_exception);
-    }
+    });
 
     // update gamma
     if (gamma == real_type{ 0.0 }) {
@@ -344,17 +378,25 @@ void parameter<T>::parse_arff_file(const std::string &filename, std::shared_ptr<
     }
 
     // update shared pointer
-    data_ptr_ref = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(data));
+    data_ptr_ref = std::make_shared<const aos_matrix<real_type>>(std::move(data));
     if (has_label) {
+        label_ptr = std::make_shared<const std::vector<real_type>>(value);
+
+        #pragma omp parallel for
+        for (typename std::vector<real_type>::size_type i = 0; i < value.size(); ++i) {
+            value[i] = plssvm::operators::sign(value[i]);
+        }
+
         value_ptr = std::make_shared<const std::vector<real_type>>(std::move(value));
     } else {
         value_ptr = nullptr;
+        label_ptr = nullptr;
     }
 
     auto end_time = std::chrono::steady_clock::now();
     if (print_info) {
         fmt::print("Read {} data points with {} features in {} using the arff parser.\n",
-                   data_ptr_ref->size(),
+                   data_ptr_ref->num_rows(),
                    num_features,
                    std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
     }
@@ -375,10 +417,19 @@ void parameter<T>::parse_model_file(const std::string &filename) {
 
     // reset values pointer
     value_ptr = nullptr;
+    class_alpha_ptr = nullptr;
+    classes.clear();
+    class_rho.clear();
+    num_random_features = 0;
 
     // helper variables
+    unsigned int nr_class{ 2 };
+    std::size_t num_features{ 0 };
+    bool random_features_model{ false };
+    bool one_vs_all_model{ false };
     unsigned long long num_sv{ 0 };
     std::pair labels{ real_type{ 0.0 }, real_type{ 0.0 } };
+    std::vector<unsigned long long> num_sv_per_class;
     bool rho_set{ false };
 
     // parse libsvm model file header
@@ -415,11 +466,19 @@ void parameter<T>::parse_model_file(const std::string &filename) {
                 // parse coef0
                 coef0 = detail::convert_to<decltype(coef0)>(value);
             } else if (detail::starts_with(line, "nr_class")) {
-                // number of classes must be 2
-                const auto nr_class = detail::convert_to<unsigned int>(value);
-                if (nr_class != 2) {
-                    throw invalid_file_format_exception{ fmt::format("Can only use 2 classes, but {} were given!", nr_class) };
+                // number of classes must be at least 2, more than 2 classes denote a one-vs-all multi-class model
+                nr_class = detail::convert_to<unsigned int>(value);
+                if (nr_class < 2) {
+                    throw invalid_file_format_exception{ fmt::format("At least 2 classes are necessary, but {} were given!", nr_class) };
                 }
+            } else if (detail::starts_with(line, "multiclass")) {
+                // the multi-class strategy, only one-vs-all is supported
+                if (value != "one_vs_all") {
+                    throw invalid_file_format_exception{ fmt::format("Can only use one_vs_all as multiclass strategy, but '{}' was given!", value) };
+                } else if (nr_class <= 2) {
+                    throw invalid_file_format_exception{ fmt::format("A one_vs_all multi-class model needs more than 2 classes, but {} were given!", nr_class) };
+                }
+                one_vs_all_model = true;
             } else if (detail::starts_with(line, "total_sv")) {
                 // the total number of support vectors must be greater than 0
                 num_sv = detail::convert_to<decltype(num_sv)>(value);
@@ -427,9 +486,19 @@ void parameter<T>::parse_model_file(const std::string &filename) {
                     throw invalid_file_format_exception{ fmt::format("The number of support vectors must be greater than 0, but is {}!", num_sv) };
                 }
             } else if (detail::starts_with(line, "rho")) {
-                // parse rho, required
-                rho = detail::convert_to<real_type>(value);
+                // parse rho (one per class for a multi-class model), required
+                if (nr_class > 2) {
+                    class_rho = detail::convert_all_to<real_type>(value);
+                } else {
+                    rho = detail::convert_to<real_type>(value);
+                }
                 rho_set = true;
+            } else if (nr_class > 2 && detail::starts_with(line, "label")) {
+                // parse all labels of a multi-class model
+                classes = detail::convert_all_to<real_type>(value);
+            } else if (nr_class > 2 && detail::starts_with(line, "nr_sv")) {
+                // parse the number of support vectors of all classes of a multi-class model
+                num_sv_per_class = detail::convert_all_to<unsigned long long>(value);
             } else if (detail::starts_with(line, "label")) {
                 // parse first label
                 const std::string_view first_label = value.substr(0, value.find_first_of(' '));
@@ -469,15 +538,129 @@ void parameter<T>::parse_model_file(const std::string &filename) {
                 std::fill(values.begin(), values.begin() + num_first, labels.first);
                 std::fill(values.begin() + num_first, values.end(), labels.second);
                 value_ptr = std::make_shared<const std::vector<real_type>>(std::move(values));
+            } else if (detail::starts_with(line, "random_features")) {
+                // the number of random Fourier features must be greater than 0
+                num_random_features = detail::convert_to<decltype(num_random_features)>(value);
+                if (num_random_features == 0) {
+                    throw invalid_file_format_exception{ "The number of random features must be greater than 0!" };
+                }
+            } else if (detail::starts_with(line, "random_seed")) {
+                // parse the seed of the random Fourier features
+                random_seed = detail::convert_to<decltype(random_seed)>(value);
+            } else if (detail::starts_with(line, "num_features")) {
+                // parse the number of features the random Fourier features are generated for
+                num_features = detail::convert_to<decltype(num_features)>(value);
             } else if (line == "sv") {
                 // start parsing support vectors, required
                 break;
+            } else if (line == "w") {
+                // start parsing the weights of the random Fourier features
+                random_features_model = true;
+                break;
             } else {
                 throw invalid_file_format_exception{ fmt::format("Unrecognized header entry '{}'! Maybe SV is missing?", f.line(header)) };
             }
         }
     }
 
+    // a model using random Fourier features has no support vectors, but one weight per random feature
+    if (random_features_model) {
+        if (nr_class > 2) {
+            throw invalid_file_format_exception{ "Random Fourier features are only supported for two classes!" };
+        } else if (kernel != kernel_type::rbf) {
+            throw invalid_file_format_exception{ fmt::format("Random Fourier features are only supported for the rbf kernel, but '{}' was given!", kernel) };
+        } else if (num_random_features == 0) {
+            throw invalid_file_format_exception{ "Missing number of random features!" };
+        } else if (num_features == 0) {
+            throw invalid_file_format_exception{ "Missing number of features!" };
+        } else if (!rho_set) {
+            throw invalid_file_format_exception{ "Missing rho value!" };
+        } else if (f.num_lines() - header - 1 != num_random_features) {
+            throw invalid_file_format_exception{ fmt::format("The number of weights ({}) must match the number of random features ({})!", f.num_lines() - header - 1, num_random_features) };
+        }
+
+        std::vector<real_type> weights(num_random_features);
+        for (std::size_t k = 0; k < num_random_features; ++k) {
+            weights[k] = detail::convert_to<real_type, invalid_file_format_exception>(detail::trim_left(f.line(header + 1 + k)));
+        }
+
+        // update shared pointer
+        data_ptr = std::make_shared<const aos_matrix<real_type>>(detail::random_fourier_frequencies(num_features, num_random_features, gamma, random_seed));
+        label_ptr = nullptr;
+        alpha_ptr = std::make_shared<const std::vector<real_type>>(std::move(weights));
+
+        auto end_time = std::chrono::steady_clock::now();
+        if (print_info) {
+            fmt::print("Read {} weights of random Fourier features for {} features in {} using the libsvm model parser.\n",
+                       num_random_features,
+                       num_features,
+                       std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+        }
+        return;
+    }
+
+    // additional sanity checks for multi-class models
+    if (nr_class > 2) {
+        if (!one_vs_all_model) {
+            // other multi-class strategies (e.g., the one-vs-one models of LIBSVM) must not be silently interpreted as one-vs-all models
+            throw invalid_file_format_exception{ fmt::format("Missing multiclass one_vs_all entry for a model with {} classes!", nr_class) };
+        } else if (num_sv == 0) {
+            // no total number of support vectors given
+            throw invalid_file_format_exception{ "Missing total number of support vectors!" };
+        } else if (classes.size() != nr_class) {
+            throw invalid_file_format_exception{ fmt::format("The number of labels ({}) must match the number of classes ({})!", classes.size(), nr_class) };
+        } else if (class_rho.size() != nr_class) {
+            throw invalid_file_format_exception{ fmt::format("The number of rho values ({}) must match the number of classes ({})!", class_rho.size(), nr_class) };
+        } else if (num_sv_per_class.size() != nr_class) {
+            throw invalid_file_format_exception{ fmt::format("The number of support vector counts ({}) must match the number of classes ({})!", num_sv_per_class.size(), nr_class) };
+        } else if (std::accumulate(num_sv_per_class.begin(), num_sv_per_class.end(), 0ULL) != num_sv) {
+            throw invalid_file_format_exception{ fmt::format("The number of support vectors per class doesn't add up to the total number: {} != {}!", fmt::join(num_sv_per_class, " + "), num_sv) };
+        }
+        for (std::size_t i = 0; i < classes.size(); ++i) {
+            if (std::count(classes.begin(), classes.end(), classes[i]) > 1) {
+                throw invalid_file_format_exception{ fmt::format("The label {} was given more than once!", classes[i]) };
+            }
+        }
+        if (header + 1 >= f.num_lines()) {
+            // no support vectors given
+            throw invalid_file_format_exception{ "Can't parse file: no support vectors are given or SV is missing!" };
+        }
+
+        // parse support vectors with one weight per class
+        std::vector<real_type> alphas(num_sv * nr_class);
+        aos_matrix<real_type> data = detail::parse_libsvm_content(f, header + 1, alphas, nr_class);
+
+        // the support vectors are grouped by their class
+        std::vector<real_type> sv_labels;
+        sv_labels.reserve(num_sv);
+        for (std::size_t c = 0; c < classes.size(); ++c) {
+            sv_labels.insert(sv_labels.end(), num_sv_per_class[c], classes[c]);
+        }
+        std::vector<std::vector<real_type>> class_alphas(nr_class, std::vector<real_type>(num_sv));
+        #pragma omp parallel for
+        for (std::size_t i = 0; i < num_sv; ++i) {
+            for (std::size_t c = 0; c < nr_class; ++c) {
+                class_alphas[c][i] = alphas[i * nr_class + c];
+            }
+        }
+
+        // update shared pointer
+        data_ptr = std::make_shared<const aos_matrix<real_type>>(std::move(data));
+        label_ptr = std::make_shared<const std::vector<real_type>>(std::move(sv_labels));
+        alpha_ptr = nullptr;
+        class_alpha_ptr = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(class_alphas));
+
+        auto end_time = std::chrono::steady_clock::now();
+        if (print_info) {
+            fmt::print("Read {} support vectors with {} features and {} classes in {} using the libsvm model parser.\n",
+                       data_ptr->num_rows(),
+                       data_ptr->num_cols(),
+                       nr_class,
+                       std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
+        }
+        return;
+    }
+
     // additional sanity checks
     if (num_sv == 0) {
         // no total number of support vectors given
@@ -497,21 +680,19 @@ void parameter<T>::parse_model_file(const std::string &filename) {
     }
 
     // parse support vectors
-    std::vector<std::vector<real_type>> data(num_sv);
     std::vector<real_type> alphas(num_sv);
-
-    // parse support vectors
-    detail::parse_libsvm_content(f, header + 1, data, alphas);
+    aos_matrix<real_type> data = detail::parse_libsvm_content(f, header + 1, alphas);
 
     // update shared pointer
-    data_ptr = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(data));
+    data_ptr = std::make_shared<const aos_matrix<real_type>>(std::move(data));
+    label_ptr = value_ptr;
     alpha_ptr = std::make_shared<const std::vector<real_type>>(std::move(alphas));
 
     auto end_time = std::chrono::steady_clock::now();
     if (print_info) {
         fmt::print("Read {} support vectors with {} features in {} using the libsvm model parser.\n",
-                   data_ptr->size(),
-                   (*data_ptr)[0].size(),
+                   data_ptr->num_rows(),
+                   data_ptr->num_cols(),
                    std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time));
     }
 }
@@ -541,6 +722,22 @@ std::ostream &operator<<(std::ostream &out, const parameter<T> &params) {
                "print_info        {}\n"
                "backend           {}\n"
                "target platform   {}\n"
+               "openmp_tile_size  {}\n"
+               "solver            {}\n"
+               "memory_budget     {}\n"
+               "cache_size        {}\n"
+               "replace_threshold {}\n"
+               "replace_interval  {}\n"
+               "preconditioner    {}\n"
+               "precond_size      {}\n"
+               "mixed_precision   {}\n"
+               "fast_math_kernels {}\n"
+               "feature_map       {}\n"
+               "cost_path         [{}]\n"
+               "num_folds         {}\n"
+               "loo_probes        {}\n"
+               "random_features   {}\n"
+               "random_seed       {}\n"
                "input_filename    '{}'\n"
                "model_filename    '{}'\n"
                "predict_filename  '{}'\n"
@@ -555,6 +752,22 @@ std::ostream &operator<<(std::ostream &out, const parameter<T> &params) {
                params.print_info,
                params.backend,
                params.target,
+               params.openmp_tile_size,
+               params.solver,
+               params.memory_budget,
+               params.cache_size,
+               params.replace_threshold,
+               params.replace_interval,
+               params.preconditioner,
+               params.precond_size,
+               params.mixed_precision,
+               params.fast_math_kernels,
+               params.feature_map,
+               fmt::join(params.cost_path, ", "),
+               params.num_folds,
+               params.loo_probes,
+               params.num_random_features,
+               params.random_seed,
                params.input_filename,
                params.model_filename,
                params.predict_filename,
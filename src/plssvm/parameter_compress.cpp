@@ -0,0 +1,129 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/parameter_compress.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::as_lower_case
+
+#include "cxxopts.hpp"    // cxxopts::Options, cxxopts::value,cxxopts::ParseResult
+#include "fmt/core.h"     // fmt::print, fmt::format
+#include "fmt/ostream.h"  // can use fmt using operator<< overloads
+
+#include <cstdio>     // stderr
+#include <cstdlib>    // std::exit, EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>  // std::exception
+#include <string>     // std::string
+
+namespace plssvm {
+
+template <typename T>
+parameter_compress<T>::parameter_compress(int argc, char **argv) {
+    cxxopts::Options options(argv[0], "Compress a learned LS-SVM model into an explicit feature map");
+    options
+        .positional_help("model_file validation_set_file [output_model_file]")
+        .show_positional_help();
+    options
+        .set_width(150)
+        .set_tab_expansion()
+        // clang-format off
+        .add_options()
+            ("random_features", "compress the rbf model using the given number of random Fourier features", cxxopts::value<decltype(num_fourier_features)>()->default_value(fmt::format("{}", num_fourier_features)))
+            ("landmarks", "compress the model using the Nyström approximation with the given number of landmarks", cxxopts::value<decltype(num_landmarks)>()->default_value(fmt::format("{}", num_landmarks)))
+            ("landmark_selection", "choose how the landmarks of the Nyström approximation are selected: kmeans++|uniform", cxxopts::value<decltype(landmark_selection)>()->default_value(detail::as_lower_case(fmt::format("{}", landmark_selection))))
+            ("random_seed", "set the seed of the random number generator used for the landmarks and the random Fourier features", cxxopts::value<decltype(random_seed)>()->default_value(fmt::format("{}", random_seed)))
+            ("c,cost", "set the parameter C regularizing the fit of the compressed model", cxxopts::value<decltype(cost)>()->default_value("1000"))
+            ("b,backend", "choose the backend: openmp|cuda|opencl|sycl", cxxopts::value<decltype(backend)>()->default_value(detail::as_lower_case(fmt::format("{}", backend))))
+            ("p,target_platform", "choose the target platform: automatic|cpu|gpu_nvidia|gpu_amd|gpu_intel", cxxopts::value<decltype(target)>()->default_value(detail::as_lower_case(fmt::format("{}", target))))
+            ("q,quiet", "quiet mode (no outputs)", cxxopts::value<bool>(print_info)->default_value(fmt::format("{}", !print_info)))
+            ("h,help", "print this helper message", cxxopts::value<bool>())
+            ("model", "", cxxopts::value<decltype(model_filename)>(), "model_file")
+            ("validation", "", cxxopts::value<decltype(input_filename)>(), "validation_set_file")
+            ("output", "", cxxopts::value<decltype(compressed_filename)>(), "output_model_file");
+    // clang-format on
+
+    // parse command line options
+    cxxopts::ParseResult result;
+    try {
+        options.parse_positional({ "model", "validation", "output" });
+        result = options.parse(argc, argv);
+    } catch (const std::exception &e) {
+        fmt::print("{}\n{}\n", e.what(), options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // print help message and exit
+    if (result.count("help")) {
+        fmt::print("{}", options.help());
+        std::exit(EXIT_SUCCESS);
+    }
+
+    // parse the size of the feature map, exactly one must be given
+    num_fourier_features = result["random_features"].as<decltype(num_fourier_features)>();
+    num_landmarks = result["landmarks"].as<decltype(num_landmarks)>();
+    if ((num_fourier_features == 0) == (num_landmarks == 0)) {
+        fmt::print(stderr, "Exactly one of random_features and landmarks must be greater than 0!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse landmark_selection_type and cast the value to the respective enum
+    landmark_selection = result["landmark_selection"].as<decltype(landmark_selection)>();
+
+    // parse the seed of the random number generator
+    random_seed = result["random_seed"].as<decltype(random_seed)>();
+
+    // parse cost
+    cost = result["cost"].as<decltype(cost)>();
+    if (cost <= T{ 0.0 }) {
+        fmt::print(stderr, "cost = {} is not allowed, it must be greater than 0!\n", cost);
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse backend_type and cast the value to the respective enum
+    backend = result["backend"].as<decltype(backend)>();
+
+    // parse target_platform and cast the value to the respective enum
+    target = result["target_platform"].as<decltype(target)>();
+
+    // parse print info
+    print_info = !print_info;
+
+    // parse model filename
+    if (!result.count("model")) {
+        fmt::print(stderr, "Error missing model file!");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+    const std::string model = result["model"].as<decltype(model_filename)>();
+
+    // parse validation data filename
+    if (!result.count("validation")) {
+        fmt::print(stderr, "Error missing validation file!");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+    const std::string validation = result["validation"].as<decltype(input_filename)>();
+
+    // parse output filename
+    if (result.count("output")) {
+        compressed_filename = result["output"].as<decltype(compressed_filename)>();
+    } else {
+        compressed_filename = model + ".compressed";
+    }
+
+    // the model file must be parsed last, since parsing the validation file overwrites the labels of the support vectors
+    base_type::parse_test_file(validation);
+    base_type::parse_model_file(model);
+}
+
+// explicitly instantiate template class
+template class parameter_compress<float>;
+template class parameter_compress<double>;
+
+}  // namespace plssvm
@@ -0,0 +1,166 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/parameter_grid.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::as_lower_case
+#include "plssvm/detail/utility.hpp"         // plssvm::detail::to_underlying
+
+#include "cxxopts.hpp"    // cxxopts::Options, cxxopts::value,cxxopts::ParseResult
+#include "fmt/core.h"     // fmt::print, fmt::format
+#include "fmt/ostream.h"  // can use fmt using operator<< overloads
+
+#include <cstdio>     // stderr
+#include <cstdlib>    // std::exit, EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>  // std::exception
+#include <string>     // std::string
+
+namespace plssvm {
+
+template <typename T>
+parameter_grid<T>::parameter_grid(int argc, char **argv) {
+    cxxopts::Options options(argv[0], "LS-SVM hyperparameter grid search using k-fold cross-validation");
+    options
+        .positional_help("training_set_file [result_file]")
+        .show_positional_help();
+    options
+        .set_width(150)
+        .set_tab_expansion()
+        // clang-format off
+        .add_options()
+            ("t,kernel_type", "set type of kernel function. \n\t 0 -- linear: u'*v\n\t 1 -- polynomial: (gamma*u'*v + coef0)^degree \n\t 2 -- radial basis function: exp(-gamma*|u-v|^2)", cxxopts::value<decltype(kernel)>()->default_value(fmt::format("{}", detail::to_underlying(kernel))))
+            ("d,degree", "set the comma separated list of degrees in the kernel function", cxxopts::value<decltype(degree_grid)>()->default_value(fmt::format("{}", degree)))
+            ("g,gamma", "set the comma separated list of gammas in the kernel function (default: 1 / num_features)", cxxopts::value<decltype(gamma_grid)>())
+            ("r,coef0", "set the comma separated list of coef0s in the kernel function", cxxopts::value<decltype(coef0_grid)>()->default_value(fmt::format("{}", coef0)))
+            ("c,cost", "set the comma separated list of the parameter C", cxxopts::value<decltype(cost_grid)>()->default_value(fmt::format("{}", cost)))
+            ("e,epsilon", "set the tolerance of termination criterion", cxxopts::value<decltype(epsilon)>()->default_value(fmt::format("{}", epsilon)))
+            ("replace_threshold", "set the relative residual reduction after which the CG residual is recomputed from scratch (0 disables the drift-based replacement)", cxxopts::value<decltype(replace_threshold)>()->default_value(fmt::format("{}", replace_threshold)))
+            ("replace_interval", "set the maximum number of CG iterations between two recomputations of the residual (0 disables the upper bound)", cxxopts::value<decltype(replace_interval)>()->default_value(fmt::format("{}", replace_interval)))
+            ("preconditioner", "choose the preconditioner of the CG solver: none|jacobi|block_jacobi|pivoted_cholesky", cxxopts::value<decltype(preconditioner)>()->default_value(detail::as_lower_case(fmt::format("{}", preconditioner))))
+            ("precond_size", "set the block size of the block_jacobi or the maximum rank of the pivoted_cholesky preconditioner", cxxopts::value<decltype(precond_size)>()->default_value(fmt::format("{}", precond_size)))
+            ("v,folds", "set the number of folds used in the cross-validation", cxxopts::value<decltype(num_folds)>()->default_value("5"))
+            ("gram_cache", "read the Gram matrix from or write it to the given file", cxxopts::value<decltype(gram_cache_filename)>())
+            ("fast_math_kernels", "use a vectorized approximation of the exponential function (at most 2 ULP error) in the rbf kernel function on the CPU", cxxopts::value<bool>(fast_math_kernels)->default_value(fmt::format("{}", fast_math_kernels)))
+            ("q,quiet", "quiet mode (no outputs)", cxxopts::value<bool>(print_info)->default_value(fmt::format("{}", !print_info)))
+            ("h,help", "print this helper message", cxxopts::value<bool>())
+            ("input", "", cxxopts::value<decltype(input_filename)>(), "training_set_file")
+            ("result", "", cxxopts::value<decltype(result_filename)>(), "result_file");
+    // clang-format on
+
+    // parse command line options
+    cxxopts::ParseResult result;
+    try {
+        options.parse_positional({ "input", "result" });
+        result = options.parse(argc, argv);
+    } catch (const std::exception &e) {
+        fmt::print("{}\n{}\n", e.what(), options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // print help message and exit
+    if (result.count("help")) {
+        fmt::print("{}", options.help());
+        std::exit(EXIT_SUCCESS);
+    }
+
+    // parse kernel_type and cast the value to the respective enum
+    kernel = result["kernel_type"].as<decltype(kernel)>();
+
+    // parse degrees
+    degree_grid = result["degree"].as<decltype(degree_grid)>();
+
+    // parse gammas
+    if (result.count("gamma")) {
+        gamma_grid = result["gamma"].as<decltype(gamma_grid)>();
+        for (const auto g : gamma_grid) {
+            if (g == real_type{ 0.0 }) {
+                fmt::print(stderr, "gamma = 0.0 is not allowed, it doesnt make any sense!\n");
+                fmt::print("{}", options.help());
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    // parse coef0s
+    coef0_grid = result["coef0"].as<decltype(coef0_grid)>();
+
+    // parse costs
+    cost_grid = result["cost"].as<decltype(cost_grid)>();
+    for (const auto c : cost_grid) {
+        if (c <= real_type{ 0.0 }) {
+            fmt::print(stderr, "cost = {} is not allowed, all costs must be greater than 0!\n", c);
+            fmt::print("{}", options.help());
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse epsilon
+    epsilon = result["epsilon"].as<decltype(epsilon)>();
+
+    // parse residual replacement policy
+    replace_threshold = result["replace_threshold"].as<decltype(replace_threshold)>();
+    if (replace_threshold < decltype(replace_threshold){ 0.0 } || replace_threshold > decltype(replace_threshold){ 1.0 }) {
+        fmt::print(stderr, "replace_threshold = {} is not allowed, the threshold must be in the range [0, 1]!\n", replace_threshold);
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+    replace_interval = result["replace_interval"].as<decltype(replace_interval)>();
+
+    // parse preconditioner_type and cast the value to the respective enum
+    preconditioner = result["preconditioner"].as<decltype(preconditioner)>();
+
+    // parse preconditioner size
+    precond_size = result["precond_size"].as<decltype(precond_size)>();
+    if (precond_size == 0) {
+        fmt::print(stderr, "precond_size = 0 is not allowed, the preconditioner size must be greater than 0!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse number of folds
+    num_folds = result["folds"].as<decltype(num_folds)>();
+    if (num_folds < 2) {
+        fmt::print(stderr, "folds = {} is not allowed, at least two folds are necessary!\n", num_folds);
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse Gram matrix cache filename
+    if (result.count("gram_cache")) {
+        gram_cache_filename = result["gram_cache"].as<decltype(gram_cache_filename)>();
+    }
+
+    // parse print info
+    print_info = !print_info;
+
+    // parse input data filename
+    if (!result.count("input")) {
+        fmt::print(stderr, "Error missing input file!");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+    input_filename = result["input"].as<decltype(input_filename)>();
+
+    // parse output result filename
+    if (result.count("result")) {
+        result_filename = result["result"].as<decltype(result_filename)>();
+    }
+
+    base_type::parse_train_file(input_filename);
+
+    // default gamma: 1 / num_features (set while parsing the data file)
+    if (gamma_grid.empty()) {
+        gamma_grid.push_back(gamma);
+    }
+}
+
+// explicitly instantiate template class
+template class parameter_grid<float>;
+template class parameter_grid<double>;
+
+}  // namespace plssvm
@@ -46,6 +46,8 @@ parameter_predict<T>::parameter_predict(int argc, char **argv) {
         .add_options()
             ("b,backend", "choose the backend: openmp|cuda|opencl|sycl", cxxopts::value<decltype(backend)>()->default_value(detail::as_lower_case(fmt::format("{}", backend))))
             ("p,target_platform", "choose the target platform: automatic|cpu|gpu_nvidia|gpu_amd|gpu_intel", cxxopts::value<decltype(target)>()->default_value(detail::as_lower_case(fmt::format("{}", target))))
+            ("fast_math_kernels", "use a vectorized approximation of the exponential function (at most 2 ULP error) in the rbf kernel function on the CPU", cxxopts::value<bool>(fast_math_kernels)->default_value(fmt::format("{}", fast_math_kernels)))
+            ("no_feature_map", "always evaluate the kernel function for all support vectors, even if the weights in the exact feature space of the polynomial kernel are cheaper", cxxopts::value<bool>()->default_value(fmt::format("{}", !feature_map)))
             ("q,quiet", "quiet mode (no outputs)", cxxopts::value<bool>(print_info)->default_value(fmt::format("{}", !print_info)))
             ("h,help", "print this helper message", cxxopts::value<bool>())
             ("test", "", cxxopts::value<decltype(input_filename)>(), "test_file")
@@ -75,6 +77,9 @@ parameter_predict<T>::parameter_predict(int argc, char **argv) {
     // parse target_platform and cast the value to the respective enum
     target = result["target_platform"].as<decltype(target)>();
 
+    // parse whether the exact feature map of the polynomial kernel may be used
+    feature_map = !result["no_feature_map"].as<bool>();
+
     // parse print info
     print_info = !print_info;
 
@@ -47,9 +47,28 @@ parameter_train<T>::parameter_train(int argc, char **argv) {
             ("g,gamma", "set gamma in kernel function (default: 1 / num_features)", cxxopts::value<decltype(gamma)>())
             ("r,coef0", "set coef0 in kernel function", cxxopts::value<decltype(coef0)>()->default_value(fmt::format("{}", coef0)))
             ("c,cost", "set the parameter C", cxxopts::value<decltype(cost)>()->default_value(fmt::format("{}", cost)))
+            ("cost_path", "learn one model for each cost in the comma separated list using a single multi-shift CG solve (written to model_file.<cost>)", cxxopts::value<decltype(cost_path)>())
+            ("v,folds", "perform a k-fold cross-validation instead of learning a model (0 disables the cross-validation)", cxxopts::value<decltype(num_folds)>()->default_value(fmt::format("{}", num_folds)))
+            ("loo", "estimate the leave-one-out accuracy using the given number of random probing vectors while learning the model (0 disables the estimate)", cxxopts::value<decltype(loo_probes)>()->default_value(fmt::format("{}", loo_probes)))
+            ("warm_start", "start the CG solver from the weights of the support vectors in the given model file, e.g., learned before the data set grew", cxxopts::value<decltype(warm_start_filename)>())
+            ("landmarks", "learn an approximate model using the Nyström approximation with the given number of landmarks as support vectors (0 learns the exact model)", cxxopts::value<decltype(num_landmarks)>()->default_value(fmt::format("{}", num_landmarks)))
+            ("landmark_selection", "choose how the landmarks of the Nyström approximation are selected: kmeans++|uniform", cxxopts::value<decltype(landmark_selection)>()->default_value(detail::as_lower_case(fmt::format("{}", landmark_selection))))
+            ("random_features", "learn an approximate model of the rbf kernel using the given number of random Fourier features (0 learns the exact model)", cxxopts::value<decltype(num_random_features)>()->default_value(fmt::format("{}", num_random_features)))
+            ("random_seed", "set the seed of the random number generator used for the probing vectors of loo, the landmarks, and the random Fourier features", cxxopts::value<decltype(random_seed)>()->default_value(fmt::format("{}", random_seed)))
             ("e,epsilon", "set the tolerance of termination criterion", cxxopts::value<decltype(epsilon)>()->default_value(fmt::format("{}", epsilon)))
             ("b,backend", "choose the backend: openmp|cuda|opencl|sycl", cxxopts::value<decltype(backend)>()->default_value(detail::as_lower_case(fmt::format("{}", backend))))
             ("p,target_platform", "choose the target platform: automatic|cpu|gpu_nvidia|gpu_amd|gpu_intel", cxxopts::value<decltype(target)>()->default_value(detail::as_lower_case(fmt::format("{}", target))))
+            ("openmp_tile_size", "set the size of the tiles the kernel matrix is split into in the OpenMP backend", cxxopts::value<decltype(openmp_tile_size)>()->default_value(fmt::format("{}", openmp_tile_size)))
+            ("s,solver", "choose the CG solver: automatic|cg_explicit|cg_implicit", cxxopts::value<decltype(solver)>()->default_value(detail::as_lower_case(fmt::format("{}", solver))))
+            ("memory_budget", "set the memory budget in MiB for the explicitly assembled kernel matrix (default: half of the available memory)", cxxopts::value<decltype(memory_budget)>())
+            ("cache_size", "set the memory in MiB used to cache kernel matrix tiles if the kernel matrix is recomputed in every CG iteration in the OpenMP backend", cxxopts::value<decltype(cache_size)>()->default_value(fmt::format("{}", cache_size)))
+            ("replace_threshold", "set the relative residual reduction after which the CG residual is recomputed from scratch (0 disables the drift-based replacement)", cxxopts::value<decltype(replace_threshold)>()->default_value(fmt::format("{}", replace_threshold)))
+            ("replace_interval", "set the maximum number of CG iterations between two recomputations of the residual (0 disables the upper bound)", cxxopts::value<decltype(replace_interval)>()->default_value(fmt::format("{}", replace_interval)))
+            ("preconditioner", "choose the preconditioner of the CG solver: none|jacobi|block_jacobi|pivoted_cholesky", cxxopts::value<decltype(preconditioner)>()->default_value(detail::as_lower_case(fmt::format("{}", preconditioner))))
+            ("precond_size", "set the block size of the block_jacobi or the maximum rank of the pivoted_cholesky preconditioner", cxxopts::value<decltype(precond_size)>()->default_value(fmt::format("{}", precond_size)))
+            ("mixed_precision", "calculate the kernel matrix-vector products in single precision and iteratively refine the solution in double precision in the OpenMP backend", cxxopts::value<bool>(mixed_precision)->default_value(fmt::format("{}", mixed_precision)))
+            ("fast_math_kernels", "use a vectorized approximation of the exponential function (at most 2 ULP error) in the rbf kernel function on the CPU", cxxopts::value<bool>(fast_math_kernels)->default_value(fmt::format("{}", fast_math_kernels)))
+            ("no_feature_map", "always solve the dual problem, even if solving the primal problem in the exact feature space of the polynomial kernel is estimated to be cheaper", cxxopts::value<bool>()->default_value(fmt::format("{}", !feature_map)))
             ("q,quiet", "quiet mode (no outputs)", cxxopts::value<bool>(print_info)->default_value(fmt::format("{}", !print_info)))
             ("h,help", "print this helper message", cxxopts::value<bool>())
             ("input", "", cxxopts::value<decltype(input_filename)>(), "training_set_file")
@@ -96,6 +115,71 @@ parameter_train<T>::parameter_train(int argc, char **argv) {
     // parse cost
     cost = result["cost"].as<decltype(cost)>();
 
+    // parse cost path
+    if (result.count("cost_path")) {
+        cost_path = result["cost_path"].as<decltype(cost_path)>();
+        for (const auto c : cost_path) {
+            if (c <= decltype(cost){ 0.0 }) {
+                fmt::print(stderr, "cost_path = {} is not allowed, all costs must be greater than 0!\n", c);
+                fmt::print("{}", options.help());
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    // parse number of cross-validation folds
+    num_folds = result["folds"].as<decltype(num_folds)>();
+    if (num_folds == 1) {
+        fmt::print(stderr, "folds = 1 is not allowed, at least two folds are necessary!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+    if (num_folds != 0 && !cost_path.empty()) {
+        fmt::print(stderr, "folds can't be combined with cost_path!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse number of leave-one-out probing vectors
+    loo_probes = result["loo"].as<decltype(loo_probes)>();
+    if (loo_probes != 0 && (num_folds != 0 || !cost_path.empty())) {
+        fmt::print(stderr, "loo can't be combined with folds or cost_path!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse warm start model filename
+    if (result.count("warm_start")) {
+        warm_start_filename = result["warm_start"].as<decltype(warm_start_filename)>();
+        if (num_folds != 0 || loo_probes != 0 || !cost_path.empty()) {
+            fmt::print(stderr, "warm_start can't be combined with folds, loo, or cost_path!\n");
+            fmt::print("{}", options.help());
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse number of landmarks of the Nyström approximation
+    num_landmarks = result["landmarks"].as<decltype(num_landmarks)>();
+    if (num_landmarks != 0 && (num_folds != 0 || loo_probes != 0 || !cost_path.empty() || !warm_start_filename.empty())) {
+        fmt::print(stderr, "landmarks can't be combined with folds, loo, cost_path, or warm_start!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse landmark_selection_type and cast the value to the respective enum
+    landmark_selection = result["landmark_selection"].as<decltype(landmark_selection)>();
+
+    // parse number of random Fourier features
+    num_random_features = result["random_features"].as<decltype(num_random_features)>();
+    if (num_random_features != 0 && (num_folds != 0 || loo_probes != 0 || !cost_path.empty() || !warm_start_filename.empty() || num_landmarks != 0)) {
+        fmt::print(stderr, "random_features can't be combined with folds, loo, cost_path, warm_start, or landmarks!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse the seed of the random number generator
+    random_seed = result["random_seed"].as<decltype(random_seed)>();
+
     // parse epsilon
     epsilon = result["epsilon"].as<decltype(epsilon)>();
 
@@ -105,6 +189,55 @@ parameter_train<T>::parameter_train(int argc, char **argv) {
     // parse target_platform and cast the value to the respective enum
     target = result["target_platform"].as<decltype(target)>();
 
+    // parse OpenMP tile size
+    openmp_tile_size = result["openmp_tile_size"].as<decltype(openmp_tile_size)>();
+    if (openmp_tile_size == 0) {
+        fmt::print(stderr, "openmp_tile_size = 0 is not allowed, the tile size must be greater than 0!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse solver_type and cast the value to the respective enum
+    solver = result["solver"].as<decltype(solver)>();
+
+    // parse memory budget
+    if (result.count("memory_budget")) {
+        memory_budget = result["memory_budget"].as<decltype(memory_budget)>();
+        if (memory_budget == 0) {
+            fmt::print(stderr, "memory_budget = 0 is not allowed, the memory budget must be greater than 0!\n");
+            fmt::print("{}", options.help());
+            std::exit(EXIT_FAILURE);
+        }
+    } else {
+        memory_budget = 0;
+    }
+
+    // parse kernel matrix tile cache size
+    cache_size = result["cache_size"].as<decltype(cache_size)>();
+
+    // parse residual replacement policy
+    replace_threshold = result["replace_threshold"].as<decltype(replace_threshold)>();
+    if (replace_threshold < decltype(replace_threshold){ 0.0 } || replace_threshold > decltype(replace_threshold){ 1.0 }) {
+        fmt::print(stderr, "replace_threshold = {} is not allowed, the threshold must be in the range [0, 1]!\n", replace_threshold);
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+    replace_interval = result["replace_interval"].as<decltype(replace_interval)>();
+
+    // parse preconditioner_type and cast the value to the respective enum
+    preconditioner = result["preconditioner"].as<decltype(preconditioner)>();
+
+    // parse preconditioner size
+    precond_size = result["precond_size"].as<decltype(precond_size)>();
+    if (precond_size == 0) {
+        fmt::print(stderr, "precond_size = 0 is not allowed, the preconditioner size must be greater than 0!\n");
+        fmt::print("{}", options.help());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse whether the exact feature map of the polynomial kernel may be used
+    feature_map = !result["no_feature_map"].as<bool>();
+
     // parse print info
     print_info = !print_info;
 
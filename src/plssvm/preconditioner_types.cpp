@@ -0,0 +1,53 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/preconditioner_types.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::to_lower_case
+
+#include <ios>      // std::ios::failbit
+#include <istream>  // std::istream
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+
+namespace plssvm {
+
+std::ostream &operator<<(std::ostream &out, const preconditioner_type preconditioner) {
+    switch (preconditioner) {
+        case preconditioner_type::none:
+            return out << "none";
+        case preconditioner_type::jacobi:
+            return out << "jacobi";
+        case preconditioner_type::block_jacobi:
+            return out << "block_jacobi";
+        case preconditioner_type::pivoted_cholesky:
+            return out << "pivoted_cholesky";
+    }
+    return out << "unknown";
+}
+
+std::istream &operator>>(std::istream &in, preconditioner_type &preconditioner) {
+    std::string str;
+    in >> str;
+    detail::to_lower_case(str);
+
+    if (str == "none") {
+        preconditioner = preconditioner_type::none;
+    } else if (str == "jacobi") {
+        preconditioner = preconditioner_type::jacobi;
+    } else if (str == "block_jacobi") {
+        preconditioner = preconditioner_type::block_jacobi;
+    } else if (str == "pivoted_cholesky") {
+        preconditioner = preconditioner_type::pivoted_cholesky;
+    } else {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+}  // namespace plssvm
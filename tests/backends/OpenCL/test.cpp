@@ -8,7 +8,9 @@
 
 #include "backends/OpenCL/mock_opencl_csvm.hpp"
 
-#include "backends/generic_tests.hpp"  // generic::write_model_test, generic::generate_q_test, generic::device_kernel_test, generic::predict_test, generic::accuracy_test
+#include "backends/generic_tests.hpp"  // generic::write_model_test, generic::generate_q_test, generic::device_kernel_test, generic::predict_test, generic::accuracy_test, generic::multiclass_test,
+                                       // generic::cross_validate_test, generic::loo_error_test, generic::warm_start_test, generic::nystrom_test,
+                                       // generic::random_features_test, generic::compress_model_test, generic::polynomial_feature_map_test
 #include "utility.hpp"                 // util::google_test::parameter_definition, util::google_test::parameter_definition_to_name
 
 #include "plssvm/backends/OpenCL/csvm.hpp"  // plssvm::opencl::csvm
@@ -59,3 +61,43 @@ TYPED_TEST(OpenCL_CSVM, predict) {
 TYPED_TEST(OpenCL_CSVM, accuracy) {
     generic::accuracy_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
 }
+
+// check whether a one-vs-all multi-class model is learned, written, and predicted correctly
+TYPED_TEST(OpenCL_CSVM, multiclass) {
+    generic::multiclass_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether the k-fold cross-validation matches models learned separately for each fold
+TYPED_TEST(OpenCL_CSVM, cross_validate) {
+    generic::cross_validate_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether the exact leave-one-out error matches a cross-validation with one fold per data point
+TYPED_TEST(OpenCL_CSVM, loo_error) {
+    generic::loo_error_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether learning starting from a previous model (with appended data points) yields the same model as learning from scratch
+TYPED_TEST(OpenCL_CSVM, warm_start) {
+    generic::warm_start_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether the Nyström approximation using all data points as landmarks matches the exact model and the model only consists of the landmarks
+TYPED_TEST(OpenCL_CSVM, nystrom) {
+    generic::nystrom_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether a model using random Fourier features approximates the rbf kernel and its model file yields the same predictions
+TYPED_TEST(OpenCL_CSVM, random_features) {
+    generic::random_features_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether a learned model compressed into an explicit feature map reproduces the decision values of the model
+TYPED_TEST(OpenCL_CSVM, compress_model) {
+    generic::compress_model_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether a model of the polynomial kernel learned using its exact feature map solves the dual problem
+TYPED_TEST(OpenCL_CSVM, polynomial_feature_map) {
+    generic::polynomial_feature_map_test<mock_opencl_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
@@ -11,9 +11,12 @@
 
 #pragma once
 
-#include "plssvm/backends/OpenMP/csvm.hpp"  // plssvm::openmp::csvm
-#include "plssvm/parameter.hpp"             // plssvm::parameter
+#include "plssvm/backends/OpenMP/csvm.hpp"        // plssvm::openmp::csvm
+#include "plssvm/backends/OpenMP/tile_cache.hpp"  // plssvm::openmp::tile_cache
+#include "plssvm/matrix.hpp"                      // plssvm::aos_matrix
+#include "plssvm/parameter.hpp"                   // plssvm::parameter
 
+#include <memory>  // std::unique_ptr
 #include <vector>  // std::vector
 
 /**
@@ -31,7 +34,13 @@ class mock_openmp_csvm : public plssvm::openmp::csvm<T> {
         base_type{ params } {}
 
     // make non-virtual functions publicly visible
+    using base_type::assemble_kernel_matrix;
+    using base_type::block_conjugate_gradients;
+    using base_type::conjugate_gradients;
     using base_type::generate_q;
+    using base_type::linear_kernel_matvec;
+    using base_type::mixed_precision_solver_CG;
+    using base_type::multi_shift_conjugate_gradients;
     using base_type::run_device_kernel;
     using base_type::setup_data_on_device;
 
@@ -41,5 +50,6 @@ class mock_openmp_csvm : public plssvm::openmp::csvm<T> {
 
     // getter for internal variable
     std::shared_ptr<const std::vector<real_type>> &get_alpha_ptr() { return base_type::alpha_ptr_; }
-    const std::vector<std::vector<real_type>> &get_device_data() const { return *base_type::data_ptr_; }
+    const plssvm::aos_matrix<real_type> &get_device_data() const { return *base_type::data_ptr_; }
+    std::unique_ptr<plssvm::openmp::tile_cache<real_type>> &get_tile_cache() { return base_type::tile_cache_; }
 };
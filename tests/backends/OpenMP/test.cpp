@@ -10,20 +10,32 @@
 
 #include "backends/OpenMP/mock_openmp_csvm.hpp"
 
-#include "backends/generic_tests.hpp"  // generic::write_model_test, generic::generate_q_test, generic::predict_test, generic::accuracy_test
+#include "backends/generic_tests.hpp"  // generic::write_model_test, generic::generate_q_test, generic::predict_test, generic::accuracy_test, generic::multiclass_test,
+                                       // generic::cross_validate_test, generic::loo_error_test, generic::warm_start_test, generic::nystrom_test,
+                                       // generic::random_features_test, generic::compress_model_test, generic::polynomial_feature_map_test
 #include "mock_csvm.hpp"               // mock_csvm
-#include "utility.hpp"                 // util::google_test::parameter_definition, util::google_test::parameter_definition_to_name, util::gtest_assert_floating_point_near, EXPECT_THROW_WHAT
+#include "utility.hpp"                 // util::google_test::parameter_definition, util::google_test::parameter_definition_to_name, util::gtest_assert_floating_point_near, util::for_each_linear_algebra_implementation, EXPECT_THROW_WHAT
 
 #include "plssvm/backends/OpenMP/csvm.hpp"        // plssvm::openmp::csvm
 #include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::accumulation_strategy, plssvm::openmp::resolve_accumulation_strategy, plssvm::openmp::lower_triangular_tiles, plssvm::openmp::kernel_matrix_size, plssvm::openmp::device_kernel_predict_radial, ...
+#include "plssvm/backends/OpenMP/tile_cache.hpp"  // plssvm::openmp::tile_cache
+#include "plssvm/detail/operators.hpp"            // plssvm::operators::transposed, plssvm::operators::operator*
 #include "plssvm/kernel_types.hpp"                // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                      // plssvm::aos_matrix, plssvm::simd_padding
 #include "plssvm/parameter.hpp"                   // plssvm::parameter
+#include "plssvm/preconditioner_types.hpp"        // plssvm::preconditioner_type
 #include "plssvm/target_platforms.hpp"            // plssvm::target_platform
 
 #include "gtest/gtest.h"  // ::testing::StaticAssertTypeEq, ::testing::Test, ::testing::Types, TYPED_TEST_SUITE, TYPED_TEST, ASSERT_EQ
 
-#include <random>  // std::random_device, std::mt19937, std::uniform_real_distribution
-#include <vector>  // std::vector
+#include <algorithm>    // std::generate
+#include <cstddef>      // std::size_t
+#include <memory>       // std::make_unique
+#include <random>       // std::random_device, std::mt19937, std::uniform_real_distribution
+#include <type_traits>  // std::is_same_v
+#include <utility>      // std::pair, std::move
+#include <vector>       // std::vector
 
 // enumerate all floating point type and kernel combinations to test
 using parameter_types = ::testing::Types<
@@ -38,6 +50,65 @@ template <typename T>
 class OpenMP_CSVM : public ::testing::Test {};
 TYPED_TEST_SUITE(OpenMP_CSVM, parameter_types, util::google_test::parameter_definition_to_name);
 
+// the data, q vector, cost, and QA_cost of the base C-SVM used as reference in the tests of the kernel matrix-vector products and the CG solvers
+template <typename T, plssvm::kernel_type kernel>
+class kernel_matvec_reference {
+  public:
+    using real_type = T;
+
+    kernel_matvec_reference() :
+        params{ create_parameter() },
+        csvm{ params },
+        data{ csvm.get_data() },
+        dept{ csvm.get_num_data_points() - 1 },
+        q_vec{ compare::generate_q<kernel>(data, csvm) },
+        cost{ csvm.get_cost() },
+        kernel_QA{ compare::kernel_function<kernel>(data.back(), data.back(), csvm) },
+        QA_cost{ kernel_QA + 1 / cost } {}
+
+    // create a vector of size dept filled with random values in [min, max)
+    [[nodiscard]] std::vector<real_type> random_vector(const real_type min, const real_type max) {
+        std::uniform_real_distribution<real_type> dist(min, max);
+        std::vector<real_type> vec(dept);
+        std::generate(vec.begin(), vec.end(), [&]() { return dist(gen); });
+        return vec;
+    }
+    // calculate the correct matrix-vector product with the least-squares matrix of the given cost
+    [[nodiscard]] std::vector<real_type> matvec(std::vector<real_type> x, const real_type add, const real_type matvec_cost) {
+        return compare::device_kernel_function<kernel>(data, x, q_vec, kernel_QA + 1 / matvec_cost, matvec_cost, add, csvm);
+    }
+    // calculate the correct matrix-vector product with the least-squares matrix of the reference cost
+    [[nodiscard]] std::vector<real_type> matvec(std::vector<real_type> x, const real_type add) {
+        return matvec(std::move(x), add, cost);
+    }
+    // set the reference cost and QA_cost in the C-SVM using the OpenMP backend
+    void set_costs(mock_openmp_csvm<real_type> &csvm_openmp) const {
+        csvm_openmp.set_QA_cost(QA_cost);
+        csvm_openmp.set_cost(cost);
+    }
+
+    // the parameters used to create the base C-SVM; may be changed before creating a C-SVM using the OpenMP backend
+    plssvm::parameter<real_type> params;
+    mock_csvm<real_type> csvm;
+    const std::vector<std::vector<real_type>> data;
+    const std::size_t dept;
+    const std::vector<real_type> q_vec;
+    const real_type cost;
+    const real_type kernel_QA;
+    const real_type QA_cost;
+
+  private:
+    [[nodiscard]] static plssvm::parameter<real_type> create_parameter() {
+        plssvm::parameter<real_type> train_params;
+        train_params.print_info = false;
+        train_params.kernel = kernel;
+        train_params.parse_train_file(PLSSVM_TEST_FILE);
+        return train_params;
+    }
+
+    std::mt19937 gen{ std::random_device{}() };
+};
+
 // check whether the csvm factory function correctly creates an openmp::csvm
 TYPED_TEST(OpenMP_CSVM, csvm_factory) {
     generic::csvm_factory_test<plssvm::openmp::csvm, typename TypeParam::real_type, plssvm::backend_type::openmp>();
@@ -65,6 +136,19 @@ TYPED_TEST(OpenMP_CSVM, constructor_invalid_target_platform) {
     EXPECT_THROW_WHAT(mock_openmp_csvm{ params }, plssvm::openmp::backend_exception, "Invalid target platform 'gpu_intel' for the OpenMP backend!");
 }
 
+// check whether the constructor correctly fails when using an invalid tile size
+TYPED_TEST(OpenMP_CSVM, constructor_invalid_tile_size) {
+    // create parameter object
+    plssvm::parameter<typename TypeParam::real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    params.openmp_tile_size = 0;
+    EXPECT_THROW_WHAT(mock_openmp_csvm{ params }, plssvm::openmp::backend_exception, "The OpenMP tile size must be greater than 0!");
+}
+
 // check whether writing the resulting model file is correct
 TYPED_TEST(OpenMP_CSVM, write_model) {
     generic::write_model_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
@@ -77,58 +161,497 @@ TYPED_TEST(OpenMP_CSVM, generate_q) {
 
 // check whether the device kernels are correct
 TYPED_TEST(OpenMP_CSVM, device_kernel) {
-    // create parameter object
-    plssvm::parameter<typename TypeParam::real_type> params;
-    params.print_info = false;
-    params.kernel = TypeParam::kernel;
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+    const std::vector<real_type> x = ref.random_vector(1.0, 2.0);
+
+    // use the BLAS routines (if available) and the built-in loops
+    util::for_each_linear_algebra_implementation([&](const bool use_blas) {
+        // use the default and a tile size that isn't a multiple of the register block size
+        for (const std::size_t tile_size : { std::size_t{ 64 }, std::size_t{ 13 } }) {
+            // create C-SVM using the OpenMP backend
+            ref.params.openmp_tile_size = tile_size;
+            mock_openmp_csvm csvm_openmp{ ref.params };
 
-    params.parse_train_file(PLSSVM_TEST_FILE);
+            // setup data on device
+            csvm_openmp.setup_data_on_device();
 
-    // create base C-SVM
-    mock_csvm csvm{ params };
-    using real_type = typename decltype(csvm)::real_type;
+            for (const auto add : { real_type{ -1 }, real_type{ 1 } }) {
+                const std::vector<real_type> correct = ref.matvec(x, add);
 
-    const std::size_t dept = csvm.get_num_data_points() - 1;
+                for (const plssvm::openmp::accumulation_strategy strategy : { plssvm::openmp::accumulation_strategy::thread_private, plssvm::openmp::accumulation_strategy::atomic }) {
+                    std::vector<real_type> calculated(ref.dept, 0.0);
+                    ref.set_costs(csvm_openmp);
+                    EXPECT_EQ(csvm_openmp.run_device_kernel(ref.q_vec, calculated, x, csvm_openmp.get_device_data(), add, strategy), strategy);
 
-    // create x vector and fill it with random values
-    std::vector<real_type> x(dept);
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<real_type> dist(1.0, 2.0);
-    std::generate(x.begin(), x.end(), [&]() { return dist(gen); });
+                    ASSERT_EQ(correct.size(), calculated.size()) << "add: " << add << ", strategy: " << strategy << ", tile size: " << tile_size << ", BLAS: " << use_blas;
+                    for (typename std::vector<real_type>::size_type index = 0; index < correct.size(); ++index) {
+                        util::gtest_assert_floating_point_near(correct[index], calculated[index], fmt::format("\tindex: {}, add: {}, strategy: {}, tile size: {}, BLAS: {}", index, add, strategy, tile_size, use_blas));
+                    }
+                }
+            }
+        }
+    });
+}
 
-    // create correct q vector, cost and QA_cost
-    const std::vector<real_type> q_vec = compare::generate_q<TypeParam::kernel>(csvm.get_data(), csvm);
-    const real_type cost = csvm.get_cost();
-    const real_type QA_cost = compare::kernel_function<TypeParam::kernel>(csvm.get_data().back(), csvm.get_data().back(), csvm) + 1 / cost;
+// check whether the device kernels using the explicitly assembled kernel matrix are correct
+TYPED_TEST(OpenMP_CSVM, device_kernel_explicit) {
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+    const std::vector<real_type> x = ref.random_vector(1.0, 2.0);
 
-    // create C-SVM using the OpenMP backend
-    mock_openmp_csvm csvm_openmp{ params };
+    // use the default and a tile size that isn't a multiple of the register block size
+    for (const std::size_t tile_size : { std::size_t{ 64 }, std::size_t{ 13 } }) {
+        // create C-SVM using the OpenMP backend and assemble the kernel matrix
+        ref.params.openmp_tile_size = tile_size;
+        mock_openmp_csvm csvm_openmp{ ref.params };
+        ref.set_costs(csvm_openmp);
+        csvm_openmp.assemble_kernel_matrix(ref.q_vec);
 
-    // setup data on device
-    csvm_openmp.setup_data_on_device();
+        for (const auto add : { real_type{ -1 }, real_type{ 1 } }) {
+            const std::vector<real_type> correct = ref.matvec(x, add);
 
-    for (const auto add : { real_type{ -1 }, real_type{ 1 } }) {
-        const std::vector<real_type> correct = compare::device_kernel_function<TypeParam::kernel>(csvm.get_data(), x, q_vec, QA_cost, cost, add, csvm);
+            for (const plssvm::openmp::accumulation_strategy strategy : { plssvm::openmp::accumulation_strategy::thread_private, plssvm::openmp::accumulation_strategy::atomic }) {
+                // q and the data are ignored if the kernel matrix has been assembled
+                std::vector<real_type> calculated(ref.dept, 0.0);
+                EXPECT_EQ(csvm_openmp.run_device_kernel(std::vector<real_type>{}, calculated, x, plssvm::aos_matrix<real_type>{}, add, strategy), strategy);
 
-        std::vector<real_type> calculated(dept, 0.0);
-        csvm_openmp.set_QA_cost(QA_cost);
-        csvm_openmp.set_cost(cost);
-        csvm_openmp.run_device_kernel(q_vec, calculated, x, csvm_openmp.get_device_data(), add);
+                ASSERT_EQ(correct.size(), calculated.size()) << "add: " << add << ", strategy: " << strategy << ", tile size: " << tile_size;
+                for (typename std::vector<real_type>::size_type index = 0; index < correct.size(); ++index) {
+                    util::gtest_assert_floating_point_near(correct[index], calculated[index], fmt::format("\tindex: {}, add: {}, strategy: {}, tile size: {}", index, add, strategy, tile_size));
+                }
+            }
+        }
+    }
+}
+
+// check whether the device kernels for multiple right-hand sides are correct
+TYPED_TEST(OpenMP_CSVM, device_kernel_block) {
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+    ref.params.openmp_tile_size = 13;
+
+    constexpr std::size_t num_rhs = 3;
+    std::vector<std::vector<real_type>> x;
+    for (std::size_t c = 0; c < num_rhs; ++c) {
+        x.push_back(ref.random_vector(1.0, 2.0));
+    }
+
+    // recompute the kernel matrix tiles or use the explicitly assembled kernel matrix
+    for (const bool assemble : { false, true }) {
+        // create C-SVM using the OpenMP backend
+        mock_openmp_csvm csvm_openmp{ ref.params };
+        ref.set_costs(csvm_openmp);
+        if (assemble) {
+            csvm_openmp.assemble_kernel_matrix(ref.q_vec);
+        }
+
+        for (const auto add : { real_type{ -1 }, real_type{ 1 } }) {
+            for (const plssvm::openmp::accumulation_strategy strategy : { plssvm::openmp::accumulation_strategy::thread_private, plssvm::openmp::accumulation_strategy::atomic }) {
+                std::vector<std::vector<real_type>> calculated(num_rhs, std::vector<real_type>(ref.dept, 0.0));
+                EXPECT_EQ(csvm_openmp.run_device_kernel(ref.q_vec, calculated, x, csvm_openmp.get_device_data(), add, strategy), strategy);
+
+                for (std::size_t c = 0; c < num_rhs; ++c) {
+                    const std::vector<real_type> correct = ref.matvec(x[c], add);
+                    ASSERT_EQ(correct.size(), calculated[c].size()) << "rhs: " << c << ", add: " << add << ", strategy: " << strategy << ", assembled: " << assemble;
+                    for (typename std::vector<real_type>::size_type index = 0; index < correct.size(); ++index) {
+                        util::gtest_assert_floating_point_near(correct[index], calculated[c][index], fmt::format("\tindex: {}, rhs: {}, add: {}, strategy: {}, assembled: {}", index, c, add, strategy, assemble));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// check whether the primal-space matrix-vector product used for the linear kernel is correct
+TYPED_TEST(OpenMP_CSVM, linear_kernel_matvec) {
+    // the primal-space matrix-vector product is only defined for the linear kernel
+    if constexpr (TypeParam::kernel == plssvm::kernel_type::linear) {
+        using real_type = typename TypeParam::real_type;
+        kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+        const std::vector<real_type> x = ref.random_vector(1.0, 2.0);
+
+        // create C-SVM using the OpenMP backend
+        mock_openmp_csvm csvm_openmp{ ref.params };
+        ref.set_costs(csvm_openmp);
+
+        for (const auto add : { real_type{ -1 }, real_type{ 1 } }) {
+            const std::vector<real_type> correct = ref.matvec(x, add);
+
+            std::vector<real_type> calculated(ref.dept, 0.0);
+            csvm_openmp.linear_kernel_matvec(ref.q_vec, calculated, x, add);
+
+            ASSERT_EQ(correct.size(), calculated.size()) << "add: " << add;
+            for (typename std::vector<real_type>::size_type index = 0; index < correct.size(); ++index) {
+                util::gtest_assert_floating_point_near(correct[index], calculated[index], fmt::format("\tindex: {}, add: {}", index, add));
+            }
+        }
+    }
+}
+
+// check whether the rbf decision values calculated from dot product tiles and squared norms are correct
+TYPED_TEST(OpenMP_CSVM, device_kernel_predict_radial) {
+    // the squared norms are only used for the rbf kernel
+    if constexpr (TypeParam::kernel == plssvm::kernel_type::rbf) {
+        using real_type = typename TypeParam::real_type;
+
+        // the number of features isn't a multiple of the SIMD width, i.e., the features of the unpadded matrices are partially processed without SIMD
+        constexpr std::size_t num_features = 13;
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<real_type> dist(-1.0, 1.0);
+        std::vector<std::vector<real_type>> data(37, std::vector<real_type>(num_features));
+        std::vector<std::vector<real_type>> points(21, std::vector<real_type>(num_features));
+        for (std::vector<real_type> &row : data) {
+            std::generate(row.begin(), row.end(), [&]() { return dist(gen); });
+        }
+        for (std::vector<real_type> &row : points) {
+            std::generate(row.begin(), row.end(), [&]() { return dist(gen); });
+        }
+        // the squared distance of identical points may become slightly negative due to cancellation
+        points.front() = data.front();
+        std::vector<real_type> alpha(data.size());
+        std::generate(alpha.begin(), alpha.end(), [&]() { return dist(gen); });
+        const real_type gamma{ 0.25 };
+
+        std::vector<real_type> correct(points.size(), real_type{ 0.0 });
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            for (std::size_t j = 0; j < data.size(); ++j) {
+                correct[i] += alpha[j] * compare::detail::radial_kernel(points[i], data[j], gamma);
+            }
+        }
+
+        const real_type tolerance = std::is_same_v<real_type, double> ? real_type{ 1e-10 } : real_type{ 1e-4 };
+        util::for_each_linear_algebra_implementation([&](const bool use_blas) {
+            for (const std::size_t padding : { std::size_t{ 0 }, plssvm::simd_padding<real_type>(num_features) }) {
+                const plssvm::aos_matrix<real_type> data_matrix{ data, 0, padding };
+                const plssvm::aos_matrix<real_type> points_matrix{ points, 0, padding };
+                for (const std::size_t tile_size : { std::size_t{ 8 }, std::size_t{ 64 } }) {
+                    std::vector<real_type> calculated(points.size(), real_type{ 0.0 });
+                    plssvm::openmp::device_kernel_predict_radial(calculated, data_matrix, alpha, points_matrix, gamma, tile_size);
+                    for (std::size_t i = 0; i < points.size(); ++i) {
+                        EXPECT_NEAR(calculated[i], correct[i], tolerance) << fmt::format("point: {}, padding: {}, tile size: {}, BLAS: {}", i, padding, tile_size, use_blas);
+                    }
+                }
+            }
+        });
+    }
+}
+
+// check whether the device kernels using the kernel matrix tile cache are correct
+TYPED_TEST(OpenMP_CSVM, device_kernel_tile_cache) {
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+    ref.params.openmp_tile_size = 13;
+    const std::vector<real_type> x = ref.random_vector(1.0, 2.0);
+
+    // create C-SVM using the OpenMP backend with a tile cache that can hold half of the tiles
+    mock_openmp_csvm csvm_openmp{ ref.params };
+    ref.set_costs(csvm_openmp);
+    const std::size_t tile_size = plssvm::openmp::round_tile_size(ref.params.openmp_tile_size);
+    const std::size_t num_tiles = plssvm::openmp::lower_triangular_tiles(ref.dept, tile_size).size();
+    csvm_openmp.get_tile_cache() = std::make_unique<plssvm::openmp::tile_cache<real_type>>(num_tiles, tile_size, num_tiles / 2 * tile_size * tile_size * sizeof(real_type));
+
+    // the first call only misses, the following calls reuse the cached tiles
+    for (const auto add : { real_type{ -1 }, real_type{ 1 }, real_type{ -1 } }) {
+        const std::vector<real_type> correct = ref.matvec(x, add);
+
+        std::vector<real_type> calculated(ref.dept, 0.0);
+        csvm_openmp.run_device_kernel(ref.q_vec, calculated, x, csvm_openmp.get_device_data(), add);
 
         ASSERT_EQ(correct.size(), calculated.size()) << "add: " << add;
         for (typename std::vector<real_type>::size_type index = 0; index < correct.size(); ++index) {
             util::gtest_assert_floating_point_near(correct[index], calculated[index], fmt::format("\tindex: {}, add: {}", index, add));
         }
     }
+    EXPECT_EQ(csvm_openmp.get_tile_cache()->num_hits() + csvm_openmp.get_tile_cache()->num_misses(), 3 * num_tiles);
+    // the exact number of hits depends on the order in which the threads acquire the tiles
+    EXPECT_GT(csvm_openmp.get_tile_cache()->num_hits(), 0);
+    EXPECT_LE(csvm_openmp.get_tile_cache()->num_hits(), 2 * (num_tiles / 2));
+}
+
+// check whether the (preconditioned) CG solver converges to the solution for all preconditioners
+TYPED_TEST(OpenMP_CSVM, conjugate_gradients) {
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+    const std::vector<real_type> b = ref.random_vector(-1.0, 1.0);
+
+    using namespace plssvm::operators;
+    const real_type eps = std::is_same_v<real_type, float> ? real_type{ 1e-3 } : real_type{ 1e-8 };
+
+    for (const plssvm::preconditioner_type preconditioner : { plssvm::preconditioner_type::none, plssvm::preconditioner_type::jacobi, plssvm::preconditioner_type::block_jacobi, plssvm::preconditioner_type::pivoted_cholesky }) {
+        // create C-SVM using the OpenMP backend
+        ref.params.preconditioner = preconditioner;
+        mock_openmp_csvm csvm_openmp{ ref.params };
+        ref.set_costs(csvm_openmp);
+        csvm_openmp.setup_data_on_device();
+        const auto matvec = [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+            csvm_openmp.run_device_kernel(ref.q_vec, ret, d, csvm_openmp.get_device_data(), add);
+        };
+
+        const std::vector<real_type> alpha = csvm_openmp.conjugate_gradients(b, std::vector<real_type>(ref.dept, 1.0), ref.dept, eps, ref.q_vec, matvec);
+
+        // the initial residual b - A * 1 must be reduced by eps
+        std::vector<real_type> r0(b);
+        matvec(r0, std::vector<real_type>(ref.dept, 1.0), -1);
+        std::vector<real_type> r(b);
+        matvec(r, alpha, -1);
+        EXPECT_LE(transposed{ r } * r, eps * eps * (transposed{ r0 } * r0)) << "preconditioner: " << preconditioner;
+    }
+}
+
+// check whether the block CG solver converges to the solutions of all right-hand sides
+TYPED_TEST(OpenMP_CSVM, block_conjugate_gradients) {
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+
+    constexpr std::size_t num_rhs = 3;
+    std::vector<std::vector<real_type>> B;
+    for (std::size_t c = 0; c < num_rhs; ++c) {
+        B.push_back(ref.random_vector(-1.0, 1.0));
+    }
+
+    using namespace plssvm::operators;
+    const real_type eps = std::is_same_v<real_type, float> ? real_type{ 1e-3 } : real_type{ 1e-8 };
+
+    for (const plssvm::preconditioner_type preconditioner : { plssvm::preconditioner_type::none, plssvm::preconditioner_type::jacobi }) {
+        // create C-SVM using the OpenMP backend
+        ref.params.preconditioner = preconditioner;
+        mock_openmp_csvm csvm_openmp{ ref.params };
+        ref.set_costs(csvm_openmp);
+        csvm_openmp.setup_data_on_device();
+        const auto matvec = [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+            csvm_openmp.run_device_kernel(ref.q_vec, ret, d, csvm_openmp.get_device_data(), add);
+        };
+        const auto block_matvec = [&](std::vector<std::vector<real_type>> &ret, const std::vector<std::vector<real_type>> &d, const real_type add) {
+            csvm_openmp.run_device_kernel(ref.q_vec, ret, d, csvm_openmp.get_device_data(), add);
+        };
+
+        const std::vector<std::vector<real_type>> alphas = csvm_openmp.block_conjugate_gradients(B, ref.dept, eps, ref.q_vec, block_matvec);
+        ASSERT_EQ(alphas.size(), num_rhs);
+
+        // the initial residuals b - A * 1 must be reduced by eps
+        for (std::size_t c = 0; c < num_rhs; ++c) {
+            std::vector<real_type> r0(B[c]);
+            matvec(r0, std::vector<real_type>(ref.dept, 1.0), -1);
+            std::vector<real_type> r(B[c]);
+            matvec(r, alphas[c], -1);
+            EXPECT_LE(transposed{ r } * r, eps * eps * (transposed{ r0 } * r0)) << "rhs: " << c << ", preconditioner: " << preconditioner;
+        }
+    }
+}
+
+// check whether the mixed-precision CG solver reaches the double precision tolerance
+TYPED_TEST(OpenMP_CSVM, mixed_precision_solver_CG) {
+    // mixed precision is only used for double and the non-linear kernels
+    if constexpr (std::is_same_v<typename TypeParam::real_type, double> && TypeParam::kernel != plssvm::kernel_type::linear) {
+        using real_type = typename TypeParam::real_type;
+        kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+        ref.params.mixed_precision = true;
+        const std::vector<real_type> b = ref.random_vector(-1.0, 1.0);
+
+        // more accurate than a single precision CG solver could achieve
+        const real_type eps = 1e-10;
+
+        // create C-SVM using the OpenMP backend
+        mock_openmp_csvm csvm_openmp{ ref.params };
+        ref.set_costs(csvm_openmp);
+        csvm_openmp.setup_data_on_device();
+
+        std::vector<real_type> alpha = csvm_openmp.mixed_precision_solver_CG(b, std::vector<real_type>(ref.dept, 1.0), 10 * ref.dept, eps, ref.q_vec);
+
+        // the initial residual b - A * 1 must be reduced by eps in double precision
+        using namespace plssvm::operators;
+        const std::vector<real_type> r0 = b - ref.matvec(std::vector<real_type>(ref.dept, 1.0), real_type{ 1 });
+        const std::vector<real_type> r = b - ref.matvec(alpha, real_type{ 1 });
+        EXPECT_LE(transposed{ r } * r, eps * eps * (transposed{ r0 } * r0));
+    }
+}
+
+// check whether the fast exponential function in the rbf kernel function yields the same predictions within the tolerance
+TYPED_TEST(OpenMP_CSVM, fast_math_kernels) {
+    // the fast exponential function is only used in the rbf kernel function
+    if constexpr (TypeParam::kernel == plssvm::kernel_type::rbf) {
+        using real_type = typename TypeParam::real_type;
+
+        // create parameter object
+        plssvm::parameter<real_type> params;
+        params.print_info = false;
+        params.kernel = TypeParam::kernel;
+        params.epsilon = 1e-10;
+
+        params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+        const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+
+        // learn the model using std::exp
+        mock_openmp_csvm csvm{ params };
+        csvm.learn();
+        const std::vector<real_type> correct_predictions = csvm.predict(data);
+
+        // learn the model using plssvm::detail::fast_exp
+        params.fast_math_kernels = true;
+        mock_openmp_csvm fast_csvm{ params };
+        fast_csvm.learn();
+        const std::vector<real_type> fast_predictions = fast_csvm.predict(data);
+
+        const real_type tolerance = std::is_same_v<real_type, double> ? real_type{ 1e-6 } : real_type{ 1e-2 };
+        ASSERT_EQ(fast_predictions.size(), correct_predictions.size());
+        for (std::size_t i = 0; i < correct_predictions.size(); ++i) {
+            EXPECT_NEAR(fast_predictions[i], correct_predictions[i], tolerance) << "data point: " << i;
+        }
+    }
+}
+
+// check whether the multi-shift CG solver solves the systems for all costs
+TYPED_TEST(OpenMP_CSVM, multi_shift_conjugate_gradients) {
+    using real_type = typename TypeParam::real_type;
+    kernel_matvec_reference<real_type, TypeParam::kernel> ref;
+    const std::vector<real_type> b = ref.random_vector(-1.0, 1.0);
+
+    // the residuals aren't replaced in the multi-shift CG algorithm, i.e., the attainable accuracy in single precision is lower
+    const real_type eps = std::is_same_v<real_type, float> ? real_type{ 1e-2 } : real_type{ 1e-8 };
+
+    // create C-SVM using the OpenMP backend
+    mock_openmp_csvm csvm_openmp{ ref.params };
+    ref.set_costs(csvm_openmp);
+    csvm_openmp.setup_data_on_device();
+    const auto matvec = [&](std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type add) {
+        csvm_openmp.run_device_kernel(ref.q_vec, ret, d, csvm_openmp.get_device_data(), add);
+    };
+
+    const std::vector<real_type> costs = { real_type{ 0.1 }, real_type{ 1.0 }, real_type{ 10.0 } };
+    std::vector<std::vector<real_type>> alphas = csvm_openmp.multi_shift_conjugate_gradients(b, 10 * ref.dept, eps, costs, matvec);
+    ASSERT_EQ(alphas.size(), costs.size());
+
+    // the residual b - A_cost * alpha must be reduced by eps (up to the drift of the recursively updated residual)
+    using namespace plssvm::operators;
+    for (std::size_t i = 0; i < costs.size(); ++i) {
+        ASSERT_EQ(alphas[i].size(), ref.dept);
+        const std::vector<real_type> r = b - ref.matvec(alphas[i], real_type{ 1 }, costs[i]);
+        EXPECT_LE(transposed{ r } * r, 100 * eps * eps * (transposed{ b } * b)) << "cost: " << costs[i];
+    }
+}
+
+// check whether the tile cache evicts the least recently used tiles
+TEST(OpenMP_CSVM, tile_cache) {
+    // a cache with two slots for five 4 x 4 tiles
+    plssvm::openmp::tile_cache<double> cache{ 5, 4, 2 * 4 * 4 * sizeof(double) + 1 };
+    EXPECT_EQ(cache.num_tiles(), 5);
+    EXPECT_EQ(cache.tile_size(), 4);
+    EXPECT_EQ(cache.capacity(), 2);
+
+    const auto lookup = [&](const std::size_t tile) {
+        const auto result = cache.acquire(tile);
+        EXPECT_NE(result.tile, nullptr);
+        cache.release(tile);
+        return result.hit;
+    };
+    EXPECT_FALSE(lookup(0));
+    EXPECT_FALSE(lookup(1));
+    EXPECT_TRUE(lookup(0));
+    // evicts tile 1, the least recently used one
+    EXPECT_FALSE(lookup(2));
+    EXPECT_TRUE(lookup(0));
+    EXPECT_FALSE(lookup(1));
+    EXPECT_EQ(cache.num_hits(), 2);
+    EXPECT_EQ(cache.num_misses(), 4);
+
+    // pinned tiles can't be evicted
+    EXPECT_TRUE(cache.acquire(0).hit);
+    EXPECT_TRUE(cache.acquire(1).hit);
+    EXPECT_EQ(cache.acquire(3).tile, nullptr);
+    cache.release(0);
+    cache.release(1);
+
+    // the order of the tiles is reversed after each sweep
+    EXPECT_EQ(cache.tile_at(0), 0);
+    cache.finish_sweep();
+    EXPECT_EQ(cache.tile_at(0), 4);
+    EXPECT_EQ(cache.tile_at(4), 0);
+}
+
+// check whether the size of the explicitly assembled kernel matrix is calculated correctly
+TYPED_TEST(OpenMP_CSVM, kernel_matrix_size) {
+    using real_type = typename TypeParam::real_type;
+
+    // 30 x 30 matrix with 12 x 12 tiles (a multiple of all register block sizes) -> 6 lower triangular tiles
+    EXPECT_EQ(plssvm::openmp::kernel_matrix_size<real_type>(30, 12), 6 * 12 * 12 * sizeof(real_type));
+    EXPECT_EQ(plssvm::openmp::kernel_matrix_size<real_type>(0, 12), 0);
+}
+
+// check whether all lower triangular tiles are enumerated exactly once and ordered by decreasing cost
+TEST(OpenMP_CSVM, lower_triangular_tiles) {
+    const std::size_t dept = 10;
+    const std::size_t tile_size = 4;
+
+    const std::vector<std::pair<std::size_t, std::size_t>> tiles = plssvm::openmp::lower_triangular_tiles(dept, tile_size);
+
+    // the full off-diagonal tiles, the full diagonal tiles and the partial off-diagonal tiles (both 2x4 with cost 8) in row-major order, the partial diagonal tile last
+    const std::vector<std::pair<std::size_t, std::size_t>> correct = { { 4, 0 }, { 0, 0 }, { 4, 4 }, { 8, 0 }, { 8, 4 }, { 8, 8 } };
+    EXPECT_EQ(tiles, correct);
+
+    EXPECT_TRUE(plssvm::openmp::lower_triangular_tiles(0, tile_size).empty());
+}
+
+// check whether the accumulation strategy is correctly resolved
+TYPED_TEST(OpenMP_CSVM, resolve_accumulation_strategy) {
+    using real_type = typename TypeParam::real_type;
+    using plssvm::openmp::accumulation_strategy;
+
+    // explicitly requested strategies are always used
+    EXPECT_EQ(plssvm::openmp::resolve_accumulation_strategy<real_type>(accumulation_strategy::atomic, 1024, 4), accumulation_strategy::atomic);
+    EXPECT_EQ(plssvm::openmp::resolve_accumulation_strategy<real_type>(accumulation_strategy::thread_private, 1024, 4), accumulation_strategy::thread_private);
+    // automatic falls back to atomics if the thread-private result vectors would be too large
+    EXPECT_EQ(plssvm::openmp::resolve_accumulation_strategy<real_type>(accumulation_strategy::automatic, 1024, 4), accumulation_strategy::thread_private);
+    EXPECT_EQ(plssvm::openmp::resolve_accumulation_strategy<real_type>(accumulation_strategy::automatic, std::size_t{ 1 } << 30, 256), accumulation_strategy::atomic);
 }
 
 // check whether the correct labels are predicted
 TYPED_TEST(OpenMP_CSVM, predict) {
-    generic::predict_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+    util::for_each_linear_algebra_implementation([](bool) { generic::predict_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>(); });
 }
 
 // check whether the accuracy calculation is correct
 TYPED_TEST(OpenMP_CSVM, accuracy) {
     generic::accuracy_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
 }
+
+// check whether a one-vs-all multi-class model is learned, written, and predicted correctly
+TYPED_TEST(OpenMP_CSVM, multiclass) {
+    generic::multiclass_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether the k-fold cross-validation matches models learned separately for each fold
+TYPED_TEST(OpenMP_CSVM, cross_validate) {
+    generic::cross_validate_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether the exact leave-one-out error matches a cross-validation with one fold per data point
+TYPED_TEST(OpenMP_CSVM, loo_error) {
+    generic::loo_error_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether learning starting from a previous model (with appended data points) yields the same model as learning from scratch
+TYPED_TEST(OpenMP_CSVM, warm_start) {
+    generic::warm_start_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether the Nyström approximation using all data points as landmarks matches the exact model and the model only consists of the landmarks
+TYPED_TEST(OpenMP_CSVM, nystrom) {
+    generic::nystrom_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether a model using random Fourier features approximates the rbf kernel and its model file yields the same predictions
+TYPED_TEST(OpenMP_CSVM, random_features) {
+    generic::random_features_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether a learned model compressed into an explicit feature map reproduces the decision values of the model
+TYPED_TEST(OpenMP_CSVM, compress_model) {
+    generic::compress_model_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>();
+}
+
+// check whether a model of the polynomial kernel learned using its exact feature map solves the dual problem
+TYPED_TEST(OpenMP_CSVM, polynomial_feature_map) {
+    util::for_each_linear_algebra_implementation([](bool) { generic::polynomial_feature_map_test<mock_openmp_csvm, typename TypeParam::real_type, TypeParam::kernel>(); });
+}
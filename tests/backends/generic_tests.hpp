@@ -20,6 +20,8 @@
 #include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
 #include "plssvm/exceptions/exceptions.hpp"     // plssvm::exception
 #include "plssvm/kernel_types.hpp"              // plssvm::kernel_type
+#include "plssvm/landmark_selection_types.hpp"  // plssvm::landmark_selection_type
+#include "plssvm/matrix.hpp"                    // plssvm::aos_matrix
 #include "plssvm/parameter.hpp"                 // plssvm::parameter
 
 #include "fmt/format.h"   // fmt::format
@@ -27,15 +29,44 @@
 #include "gmock/gmock.h"  // EXPECT_THAT
 #include "gtest/gtest.h"  // GTEST_USES_POSIX_RE, ASSERT_EQ, EXPECT_EQ, EXPECT_GT, testing::ContainsRegex, testing::StaticAssertTypeEq
 
-#include <algorithm>   // std::generate
-#include <filesystem>  // std::filesystem::remove
-#include <fstream>     // std::ifstream
-#include <random>      // std::random_device, std::mt19937, std::uniform_real_distribution
-#include <string>      // std::string, std::getline
-#include <vector>      // std::vector
+#include <algorithm>    // std::generate
+#include <cmath>        // std::sqrt
+#include <cstddef>      // std::size_t
+#include <filesystem>   // std::filesystem::remove
+#include <fstream>      // std::ifstream
+#include <memory>       // std::make_shared
+#include <numeric>      // std::accumulate
+#include <random>       // std::random_device, std::mt19937, std::uniform_real_distribution
+#include <string>       // std::string, std::getline
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
 
 namespace generic {
 
+// the tolerance of the decision values of (mathematically identical) models learned using different inexact CG solves; noticeably larger in single precision
+template <typename real_type>
+constexpr real_type cg_tolerance = std::is_same_v<real_type, double> ? real_type{ 1e-4 } : real_type{ 0.1 };
+
+// write the model learned by csvm to a temporary file and parse it again using model_params
+template <typename real_type, typename csvm_t>
+[[nodiscard]] inline plssvm::parameter<real_type> write_and_parse_model(csvm_t &csvm, plssvm::parameter<real_type> model_params = plssvm::parameter<real_type>{}) {
+    const std::string model_file = util::create_temp_file();
+    csvm.write_model(model_file);
+    model_params.print_info = false;
+    model_params.parse_model_file(model_file);
+    std::filesystem::remove(model_file);
+    return model_params;
+}
+
+// check whether all decision values in predictions match the ones in correct_predictions up to tolerance
+template <typename real_type>
+inline void expect_predictions_near(const std::vector<real_type> &predictions, const std::vector<real_type> &correct_predictions, const real_type tolerance) {
+    ASSERT_EQ(predictions.size(), correct_predictions.size());
+    for (std::size_t i = 0; i < correct_predictions.size(); ++i) {
+        EXPECT_NEAR(predictions[i], correct_predictions[i], tolerance) << fmt::format("data point {}", i);
+    }
+}
+
 template <template <typename> typename csvm_type, typename real_type, plssvm::backend_type backend>
 inline void csvm_factory_test() {
     // create parameter object
@@ -212,7 +243,7 @@ inline void predict_test() {
 
     // predict
     std::vector<real_type> predicted_values = csvm.predict_label(*params.test_data_ptr);
-    std::vector<real_type> predicted_values_real = csvm.predict(*params.test_data_ptr);
+    std::vector<real_type> predicted_values_real = csvm.predict(params.test_data_ptr->to_2D_vector());
 
     // read correct prediction
     std::ifstream ifs(PLSSVM_TEST_PATH "/data/predict/500x200.libsvm.predict");
@@ -241,7 +272,7 @@ inline void predict_test() {
 
     // the number of features of the prediction points must match the number of features of the data points
     points = { { real_type{ 1 }, real_type{ 2 } }, { real_type{ 3 }, real_type{ 4 } } };
-    EXPECT_THROW_WHAT(acc_vec = csvm.predict_label(points), plssvm::exception, fmt::format("Number of features per data point ({}) must match the number of features per predict point (2)!", params.data_ptr->front().size()));
+    EXPECT_THROW_WHAT(acc_vec = csvm.predict_label(points), plssvm::exception, fmt::format("Number of features per data point ({}) must match the number of features per predict point (2)!", params.data_ptr->num_cols()));
 
     // alpha values must not be nullptr in order to predict
     csvm.get_alpha_ptr() = nullptr;
@@ -283,11 +314,338 @@ inline void accuracy_test() {
     util::gtest_assert_floating_point_eq(accuracy_calculated_extern, accuracy_correct);
 
     // check single point prediction
-    const real_type prediction_first_point = csvm.predict_label((*params.data_ptr)[0]);
-    const real_type accuracy_calculated_single_point_correct = csvm.accuracy((*params.data_ptr)[0], prediction_first_point);
+    const real_type prediction_first_point = csvm.predict_label(params.data_ptr->row(0));
+    const real_type accuracy_calculated_single_point_correct = csvm.accuracy(params.data_ptr->row(0), prediction_first_point);
     util::gtest_assert_floating_point_eq(accuracy_calculated_single_point_correct, real_type{ 1.0 });
-    const real_type accuracy_calculated_single_point_wrong = csvm.accuracy((*params.data_ptr)[0], -prediction_first_point);
+    const real_type accuracy_calculated_single_point_wrong = csvm.accuracy(params.data_ptr->row(0), -prediction_first_point);
     util::gtest_assert_floating_point_eq(accuracy_calculated_single_point_wrong, real_type{ 0.0 });
 }
 
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void multiclass_test() {
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+
+    // create C-SVM using the specified backend
+    csvm_type csvm{ params };
+
+    // learn a one-vs-all model for the three well separated classes
+    csvm.learn();
+
+    // all training data points must be classified correctly
+    const std::vector<real_type> label_predicted = csvm.predict_label(*params.data_ptr);
+    EXPECT_EQ(label_predicted, *params.label_ptr);
+    util::gtest_assert_floating_point_eq(csvm.accuracy(), real_type{ 1.0 });
+    EXPECT_EQ(csvm.predict_label(params.data_ptr->row(1)), (*params.label_ptr)[1]);
+    util::gtest_assert_floating_point_eq(csvm.accuracy(params.data_ptr->row(1), (*params.label_ptr)[2]), real_type{ 0.0 });
+
+    // write the model and read it again
+    const plssvm::parameter<real_type> model_params = write_and_parse_model<real_type>(csvm);
+
+    EXPECT_EQ(model_params.classes, (std::vector<real_type>{ real_type{ 1 }, real_type{ 2 }, real_type{ 3 } }));
+    ASSERT_NE(model_params.class_alpha_ptr, nullptr);
+    EXPECT_EQ(model_params.class_alpha_ptr->size(), 3);
+    EXPECT_EQ(model_params.data_ptr->num_rows(), params.data_ptr->num_rows());
+
+    // the read model must predict the same classes
+    csvm_type model_csvm{ model_params };
+    EXPECT_EQ(model_csvm.predict_label(*params.data_ptr), label_predicted);
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void cross_validate_test() {
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+
+    // create C-SVM using the specified backend
+    csvm_type csvm{ params };
+
+    // cross-validate all folds at once
+    const std::size_t num_folds = 5;
+    const std::vector<real_type> accuracies = csvm.cross_validate(num_folds);
+    ASSERT_EQ(accuracies.size(), num_folds);
+
+    // no model is learned during the cross-validation
+    const std::string model_file = util::create_temp_file();
+    EXPECT_THROW_WHAT(csvm.write_model(model_file), plssvm::exception, "No alphas given! Maybe a call to 'learn()' is missing?");
+    std::filesystem::remove(model_file);
+
+    // compare against models learned separately for each fold
+    const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+    for (std::size_t fold = 0; fold < num_folds; ++fold) {
+        std::vector<std::vector<real_type>> train_data;
+        std::vector<real_type> train_labels;
+        std::vector<std::vector<real_type>> validation_data;
+        std::vector<real_type> validation_labels;
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            if (i % num_folds == fold) {
+                validation_data.push_back(data[i]);
+                validation_labels.push_back((*params.value_ptr)[i]);
+            } else {
+                train_data.push_back(data[i]);
+                train_labels.push_back((*params.value_ptr)[i]);
+            }
+        }
+
+        plssvm::parameter<real_type> fold_params{ params };
+        fold_params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>(train_data);
+        fold_params.value_ptr = std::make_shared<const std::vector<real_type>>(train_labels);
+        fold_params.label_ptr = fold_params.value_ptr;
+        csvm_type fold_csvm{ fold_params };
+        fold_csvm.learn();
+
+        if constexpr (std::is_same_v<real_type, double>) {
+            util::gtest_expect_floating_point_eq(accuracies[fold], fold_csvm.accuracy(validation_data, validation_labels), fmt::format("fold {}", fold));
+        } else {
+            // in single precision, the inexact CG solutions of both (mathematically identical) equations differ noticeably
+            EXPECT_NEAR(accuracies[fold], fold_csvm.accuracy(validation_data, validation_labels), real_type{ 0.1 }) << fmt::format("fold {}", fold);
+        }
+    }
+
+    // illegal number of folds
+    std::vector<real_type> ret;
+    EXPECT_THROW_WHAT(ret = csvm.cross_validate(1), plssvm::exception, "The number of folds (1) must be in the range [2, 500]!");
+    EXPECT_THROW_WHAT(ret = csvm.cross_validate(501), plssvm::exception, "The number of folds (501) must be in the range [2, 500]!");
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void loo_error_test() {
+    // create parameter object using the first data points of the data set
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = kernel;
+    params.epsilon = 1e-10;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+    const std::size_t num_data_points = 50;
+    std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+    data.resize(num_data_points);
+    params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>(data);
+    params.value_ptr = std::make_shared<const std::vector<real_type>>(params.value_ptr->cbegin(), params.value_ptr->cbegin() + num_data_points);
+    params.label_ptr = params.value_ptr;
+
+    // create C-SVM using the specified backend
+    csvm_type csvm{ params };
+
+    // using the unit vectors, the leave-one-out error is exact and, therefore, matches a cross-validation with one fold per data point
+    const real_type error = csvm.loo_error(num_data_points);
+    const std::vector<real_type> accuracies = csvm.cross_validate(num_data_points);
+    const real_type correct = std::accumulate(accuracies.cbegin(), accuracies.cend(), real_type{ 0.0 });
+    if constexpr (std::is_same_v<real_type, double>) {
+        util::gtest_expect_floating_point_eq(error, 1 - correct / num_data_points);
+    } else {
+        // in single precision, the inexact CG solutions of both (mathematically identical) equations differ noticeably
+        EXPECT_NEAR(error, 1 - correct / num_data_points, real_type{ 0.1 });
+    }
+
+    // random probing vectors only estimate the leave-one-out error, but learn the same model as learn()
+    const real_type estimated_error = csvm.loo_error(10);
+    EXPECT_GE(estimated_error, real_type{ 0.0 });
+    EXPECT_LE(estimated_error, real_type{ 1.0 });
+    // the probing vectors are drawn using the seed of the random number generator, i.e., the estimate is reproducible
+    EXPECT_EQ(csvm.loo_error(10), estimated_error);
+    const std::vector<real_type> loo_predictions = csvm.predict(data);
+    csvm.learn();
+    const std::vector<real_type> predictions = csvm.predict(data);
+    ASSERT_EQ(loo_predictions.size(), predictions.size());
+    for (std::size_t i = 0; i < predictions.size(); ++i) {
+        EXPECT_NEAR(loo_predictions[i], predictions[i], real_type{ 1e-2 }) << fmt::format("data point {}", i);
+    }
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void warm_start_test() {
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = kernel;
+    params.epsilon = 1e-10;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+    const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+    const std::vector<real_type> &labels = *params.label_ptr;
+
+    // learn the model of the whole data set from scratch
+    csvm_type csvm{ params };
+    csvm.learn();
+    const std::vector<real_type> correct_predictions = csvm.predict(data);
+
+    // learn a model of all but the last ten data points, append them, and learn again starting from the previous model
+    const std::size_t num_old_data_points = data.size() - 10;
+    plssvm::parameter<real_type> old_params{ params };
+    old_params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>(std::vector<std::vector<real_type>>(data.cbegin(), data.cbegin() + num_old_data_points));
+    old_params.value_ptr = std::make_shared<const std::vector<real_type>>(params.value_ptr->cbegin(), params.value_ptr->cbegin() + num_old_data_points);
+    old_params.label_ptr = old_params.value_ptr;
+    csvm_type appended_csvm{ old_params };
+    appended_csvm.learn();
+    appended_csvm.append_data(std::vector<std::vector<real_type>>(data.cbegin() + num_old_data_points, data.cend()), std::vector<real_type>(labels.cbegin() + num_old_data_points, labels.cend()));
+    appended_csvm.learn();
+    const std::vector<real_type> appended_predictions = appended_csvm.predict(data);
+
+    // learn the model of the whole data set starting from the model file of the first model
+    const plssvm::parameter<real_type> model_params = write_and_parse_model<real_type>(csvm);
+    csvm_type warm_csvm{ params };
+    warm_csvm.learn(*model_params.data_ptr, *model_params.alpha_ptr);
+    const std::vector<real_type> warm_predictions = warm_csvm.predict(data);
+
+    // all models must be the same; in single precision, the inexact CG solutions starting from different initial guesses differ noticeably
+    expect_predictions_near(appended_predictions, correct_predictions, cg_tolerance<real_type>);
+    expect_predictions_near(warm_predictions, correct_predictions, cg_tolerance<real_type>);
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void nystrom_test() {
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = kernel;
+    params.epsilon = 1e-10;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+    const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+
+    // learn the exact model
+    csvm_type csvm{ params };
+    csvm.learn();
+    const std::vector<real_type> correct_predictions = csvm.predict(data);
+
+    // using all data points as landmarks, the Nyström approximation is exact (up to the shift of the kernel matrix of the landmarks)
+    csvm_type nystrom_csvm{ params };
+    nystrom_csvm.learn_nystrom(data.size());
+    const std::vector<real_type> nystrom_predictions = nystrom_csvm.predict(data);
+    expect_predictions_near(nystrom_predictions, correct_predictions, cg_tolerance<real_type>);
+
+    // the same holds if all data points are sampled uniformly
+    csvm_type uniform_csvm{ params };
+    uniform_csvm.learn_nystrom(data.size(), plssvm::landmark_selection_type::uniform);
+    expect_predictions_near(uniform_csvm.predict(data), correct_predictions, cg_tolerance<real_type>);
+
+    // the model of a Nyström approximation only consists of the landmarks
+    csvm_type landmark_csvm{ params };
+    landmark_csvm.learn_nystrom(10);
+    const plssvm::parameter<real_type> model_params = write_and_parse_model<real_type>(landmark_csvm);
+    EXPECT_EQ(model_params.data_ptr->num_rows(), std::size_t{ 10 });
+    csvm_type uniform_landmark_csvm{ params };
+    uniform_landmark_csvm.learn_nystrom(10, plssvm::landmark_selection_type::uniform);
+    EXPECT_EQ(write_and_parse_model<real_type>(uniform_landmark_csvm).data_ptr->num_rows(), std::size_t{ 10 });
+
+    // the model file yields the same predictions (up to the precision of the support vectors in the model file)
+    csvm_type model_csvm{ model_params };
+    expect_predictions_near(model_csvm.predict(data), landmark_csvm.predict(data), real_type{ 1e-3 });
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void random_features_test() {
+    // random Fourier features only approximate the rbf kernel
+    if constexpr (kernel == plssvm::kernel_type::rbf) {
+        // create parameter object
+        plssvm::parameter<real_type> params;
+        params.print_info = false;
+        params.kernel = kernel;
+
+        params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+        const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+        const std::vector<real_type> labels = *params.value_ptr;
+
+        // enough random features separate the training data as well as the exact model
+        csvm_type csvm{ params };
+        csvm.learn_random_features(2000);
+        EXPECT_GE(csvm.accuracy(data, labels), real_type{ 0.95 });
+
+        // the model file only contains the seed and the weights, but yields the same predictions
+        const plssvm::parameter<real_type> model_params = write_and_parse_model<real_type>(csvm);
+        ASSERT_EQ(model_params.alpha_ptr->size(), std::size_t{ 2000 });
+
+        csvm_type model_csvm{ model_params };
+        expect_predictions_near(model_csvm.predict(data), csvm.predict(data), real_type{ 1e-4 });
+    }
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void compress_model_test() {
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+    const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+    const plssvm::aos_matrix<real_type> validation{ data };
+
+    // learn the exact model
+    csvm_type csvm{ params };
+    csvm.learn();
+    const std::vector<real_type> reference = csvm.predict(data);
+
+    // the compressed model is fitted with a weak regularization to the decision values of the exact model on its support vectors (limited by the precision of the normal equations)
+    plssvm::parameter<real_type> compress_params;
+    compress_params.cost = std::is_same_v<real_type, float> ? real_type{ 1e3 } : real_type{ 1e5 };
+    const plssvm::parameter<real_type> model_params = write_and_parse_model(csvm, compress_params);
+
+    const auto check_compressed = [&](csvm_type<real_type> &compressed, const real_type error) {
+        const std::vector<real_type> predictions = compressed.predict(data);
+        ASSERT_EQ(predictions.size(), reference.size());
+        real_type squared_error{ 0.0 };
+        for (std::size_t i = 0; i < predictions.size(); ++i) {
+            squared_error += (predictions[i] - reference[i]) * (predictions[i] - reference[i]);
+        }
+        EXPECT_NEAR(error, std::sqrt(squared_error / static_cast<real_type>(reference.size())), real_type{ 1e-4 });
+        EXPECT_LT(error, real_type{ 1e-2 });
+    };
+
+    // using all support vectors as landmarks reproduces the model
+    csvm_type nystrom_csvm{ model_params };
+    const real_type nystrom_error = nystrom_csvm.compress_nystrom(500, validation);
+    check_compressed(nystrom_csvm, nystrom_error);
+
+    // more random Fourier features than support vectors reproduce the decision values on the support vectors
+    if constexpr (kernel == plssvm::kernel_type::rbf) {
+        csvm_type random_features_csvm{ model_params };
+        const real_type random_features_error = random_features_csvm.compress_random_features(1000, validation);
+        check_compressed(random_features_csvm, random_features_error);
+    }
+}
+
+template <template <typename> typename csvm_type, typename real_type, plssvm::kernel_type kernel>
+inline void polynomial_feature_map_test() {
+    // only the polynomial kernel has an exact finite feature map
+    if constexpr (kernel == plssvm::kernel_type::polynomial) {
+        // many data points with few features, such that the primal problem of the degree 2 polynomial kernel is cheaper than the dual one
+        plssvm::parameter<real_type> params = util::create_polynomial_feature_map_parameter<real_type>();
+        params.cost = 10.0;
+        const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+        const std::vector<real_type> &labels = *params.value_ptr;
+        const std::size_t num_data_points = data.size();
+
+        csvm_type csvm{ params };
+        csvm.learn();
+        EXPECT_GE(csvm.accuracy(data, labels), real_type{ 0.85 });
+
+        // the weights written to the model file are evaluated using the kernel function if the feature map is disabled
+        plssvm::parameter<real_type> kernel_params;
+        kernel_params.feature_map = false;
+        const plssvm::parameter<real_type> model_params = write_and_parse_model<real_type>(csvm, kernel_params);
+        csvm_type model_csvm{ model_params };
+
+        // the weights of the feature map predict the same decision values as the weights of the data points
+        expect_predictions_near(csvm.predict(data), model_csvm.predict(data), real_type{ 1e-3 });
+
+        // the weights written to the model file solve the dual problem, i.e., f(x_i) + alpha_i / cost = y_i
+        const std::vector<real_type> model_predictions = model_csvm.predict(model_params.data_ptr->to_2D_vector());
+        ASSERT_EQ(model_predictions.size(), num_data_points);
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            EXPECT_NEAR(model_predictions[i] + (*model_params.alpha_ptr)[i] / params.cost, (*model_params.value_ptr)[i], real_type{ 1e-3 }) << fmt::format("support vector {}", i);
+        }
+        EXPECT_NEAR(std::accumulate(model_params.alpha_ptr->cbegin(), model_params.alpha_ptr->cend(), real_type{ 0.0 }), real_type{ 0.0 }, real_type{ 1e-3 });
+    }
+}
+
 }  // namespace generic
\ No newline at end of file
@@ -11,18 +11,34 @@
 #include "plssvm/backend_types.hpp"                // plssvm::backend_type
 #include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
 #include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/blas.hpp"                  // plssvm::detail::blas::gemm_nt, plssvm::detail::blas::syrk_lower, plssvm::detail::blas::gemv_n, plssvm::detail::blas::gemv_t, plssvm::detail::blas::is_enabled_for
+#include "plssvm/detail/cholesky.hpp"              // plssvm::detail::cholesky_decomposition, plssvm::detail::cholesky_parallel_threshold
+#include "plssvm/detail/fast_exp.hpp"              // plssvm::detail::fast_exp, plssvm::detail::fast_exp_max_ulp_error, plssvm::detail::dispatch_fast_exp
+#include "plssvm/detail/integer_pow.hpp"           // plssvm::detail::integer_pow, plssvm::detail::dispatch_degree, plssvm::detail::unrolled_degree_v, plssvm::detail::max_unrolled_degree
+#include "plssvm/detail/polynomial_features.hpp"   // plssvm::detail::polynomial_feature_map
+#include "plssvm/detail/preconditioner.hpp"        // plssvm::detail::make_preconditioner, plssvm::detail::block_jacobi_preconditioner, plssvm::detail::pivoted_cholesky_preconditioner
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::exception
 #include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/landmark_selection_types.hpp"     // plssvm::landmark_selection_type
+#include "plssvm/preconditioner_types.hpp"         // plssvm::preconditioner_type
+#include "plssvm/solver_types.hpp"                 // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"             // plssvm::target_platform
 
 #include "backends/compare.hpp"  // compare::detail::linear_kernel, compare::detail::poly_kernel, compare::detail::radial_kernel
-#include "utility.hpp"           // util::gtest_expect_enum_to_string_string_conversion, util::gtest_expect_string_to_enum_conversion, util::gtest_assert_floating_point_near
+#include "utility.hpp"           // util::gtest_expect_enum_to_string_string_conversion, util::gtest_expect_string_to_enum_conversion, util::gtest_assert_floating_point_near, util::for_each_linear_algebra_implementation, EXPECT_THROW_WHAT
 
+#include "fmt/core.h"     // fmt::format
 #include "gtest/gtest.h"  // :testing::Test, ::testing::Types, TYPED_TEST_SUITE, TYPED_TEST, TEST
 
-#include <algorithm>  // std::generate
-#include <cstddef>    // std::size_t
-#include <random>     // std::random_device, std::mt19937, std::uniform_real_distribution
-#include <vector>     // std::vector
+#include <algorithm>    // std::generate, std::min
+#include <cmath>        // std::pow, std::exp, std::abs, std::nextafter
+#include <cstddef>      // std::size_t
+#include <limits>       // std::numeric_limits
+#include <numeric>      // std::inner_product
+#include <random>       // std::random_device, std::mt19937, std::uniform_real_distribution
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
 
 #include <regex>
 
@@ -92,6 +108,120 @@ TEST(Base, target_platform) {
     util::gtest_expect_string_to_enum_conversion<plssvm::target_platform>("baz");
 }
 
+// check whether the std::string <-> plssvm::solver_type conversions are correct
+TEST(Base, solver_type) {
+    // check conversions to std::string
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::solver_type::automatic, "automatic");
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::solver_type::cg_explicit, "cg_explicit");
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::solver_type::cg_implicit, "cg_implicit");
+    util::gtest_expect_enum_to_string_string_conversion(static_cast<plssvm::solver_type>(3), "unknown");
+
+    // check conversion from std::string
+    util::gtest_expect_string_to_enum_conversion("automatic", plssvm::solver_type::automatic);
+    util::gtest_expect_string_to_enum_conversion("AUTOmatic", plssvm::solver_type::automatic);
+    util::gtest_expect_string_to_enum_conversion("cg_explicit", plssvm::solver_type::cg_explicit);
+    util::gtest_expect_string_to_enum_conversion("CG_Explicit", plssvm::solver_type::cg_explicit);
+    util::gtest_expect_string_to_enum_conversion("cg_implicit", plssvm::solver_type::cg_implicit);
+    util::gtest_expect_string_to_enum_conversion("CG_IMPLICIT", plssvm::solver_type::cg_implicit);
+    util::gtest_expect_string_to_enum_conversion<plssvm::solver_type>("baz");
+}
+
+// check whether the std::string <-> plssvm::preconditioner_type conversions are correct
+TEST(Base, preconditioner_type) {
+    // check conversions to std::string
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::preconditioner_type::none, "none");
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::preconditioner_type::jacobi, "jacobi");
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::preconditioner_type::block_jacobi, "block_jacobi");
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::preconditioner_type::pivoted_cholesky, "pivoted_cholesky");
+    util::gtest_expect_enum_to_string_string_conversion(static_cast<plssvm::preconditioner_type>(4), "unknown");
+
+    // check conversion from std::string
+    util::gtest_expect_string_to_enum_conversion("none", plssvm::preconditioner_type::none);
+    util::gtest_expect_string_to_enum_conversion("NONE", plssvm::preconditioner_type::none);
+    util::gtest_expect_string_to_enum_conversion("jacobi", plssvm::preconditioner_type::jacobi);
+    util::gtest_expect_string_to_enum_conversion("Jacobi", plssvm::preconditioner_type::jacobi);
+    util::gtest_expect_string_to_enum_conversion("block_jacobi", plssvm::preconditioner_type::block_jacobi);
+    util::gtest_expect_string_to_enum_conversion("Block_Jacobi", plssvm::preconditioner_type::block_jacobi);
+    util::gtest_expect_string_to_enum_conversion("pivoted_cholesky", plssvm::preconditioner_type::pivoted_cholesky);
+    util::gtest_expect_string_to_enum_conversion("PIVOTED_CHOLESKY", plssvm::preconditioner_type::pivoted_cholesky);
+    util::gtest_expect_string_to_enum_conversion<plssvm::preconditioner_type>("foo");
+}
+
+// check whether the std::string <-> plssvm::landmark_selection_type conversions are correct
+TEST(Base, landmark_selection_type) {
+    // check conversions to std::string
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::landmark_selection_type::kmeans_pp, "kmeans++");
+    util::gtest_expect_enum_to_string_string_conversion(plssvm::landmark_selection_type::uniform, "uniform");
+    util::gtest_expect_enum_to_string_string_conversion(static_cast<plssvm::landmark_selection_type>(2), "unknown");
+
+    // check conversion from std::string
+    util::gtest_expect_string_to_enum_conversion("kmeans++", plssvm::landmark_selection_type::kmeans_pp);
+    util::gtest_expect_string_to_enum_conversion("KMeans++", plssvm::landmark_selection_type::kmeans_pp);
+    util::gtest_expect_string_to_enum_conversion("uniform", plssvm::landmark_selection_type::uniform);
+    util::gtest_expect_string_to_enum_conversion("UNIFORM", plssvm::landmark_selection_type::uniform);
+    util::gtest_expect_string_to_enum_conversion<plssvm::landmark_selection_type>("kmeans");
+}
+
+// check whether the preconditioners correctly approximate the inverse of a symmetric positive definite matrix
+TEST(Base, preconditioner) {
+    // A = X * X^T + shift * I for random X with 10 rows and 4 columns
+    constexpr std::size_t size = 10;
+    constexpr double shift = 0.5;
+    std::vector<double> X(size * 4);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::generate(X.begin(), X.end(), [&]() { return dist(gen); });
+    const auto entry = [&](const std::size_t i, const std::size_t j) {
+        double temp = i == j ? shift : 0.0;
+        for (std::size_t k = 0; k < 4; ++k) {
+            temp += X[i * 4 + k] * X[j * 4 + k];
+        }
+        return temp;
+    };
+    std::vector<double> r(size);
+    std::generate(r.begin(), r.end(), [&]() { return dist(gen); });
+
+    // no preconditioner
+    EXPECT_EQ(plssvm::detail::make_preconditioner<double>(plssvm::preconditioner_type::none, size, 4, shift, entry), nullptr);
+
+    // the Jacobi preconditioner scales with the inverse diagonal
+    std::vector<double> z(size);
+    plssvm::detail::make_preconditioner<double>(plssvm::preconditioner_type::jacobi, size, 4, shift, entry)->apply(r, z);
+    for (std::size_t i = 0; i < size; ++i) {
+        util::gtest_assert_floating_point_near(z[i], r[i] / entry(i, i), fmt::format("\tindex: {}", i));
+    }
+
+    // a single block or a full rank pivoted Cholesky decomposition result in the exact inverse, i.e., A * z = r
+    for (const plssvm::preconditioner_type type : { plssvm::preconditioner_type::block_jacobi, plssvm::preconditioner_type::pivoted_cholesky }) {
+        plssvm::detail::make_preconditioner<double>(type, size, size, shift, entry)->apply(r, z);
+        for (std::size_t i = 0; i < size; ++i) {
+            double Az{ 0.0 };
+            for (std::size_t j = 0; j < size; ++j) {
+                Az += entry(i, j) * z[j];
+            }
+            EXPECT_NEAR(Az, r[i], 1e-10) << "index: " << i << ", preconditioner: " << type;
+        }
+    }
+
+    // the pivoted Cholesky decomposition stops at the rank of X * X^T
+    EXPECT_EQ(plssvm::detail::pivoted_cholesky_preconditioner<double>(size, size, shift, entry).rank(), 4);
+
+    // block-Jacobi with multiple blocks: each block is inverted exactly
+    plssvm::detail::make_preconditioner<double>(plssvm::preconditioner_type::block_jacobi, size, 4, shift, entry)->apply(r, z);
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::size_t block_begin = i / 4 * 4;
+        double Az{ 0.0 };
+        for (std::size_t j = block_begin; j < std::min(block_begin + 4, size); ++j) {
+            Az += entry(i, j) * z[j];
+        }
+        EXPECT_NEAR(Az, r[i], 1e-10) << "index: " << i;
+    }
+
+    // illegal preconditioner sizes
+    EXPECT_THROW_WHAT((plssvm::detail::block_jacobi_preconditioner<double>{ size, 0, entry }), plssvm::exception, "The block size of the block-Jacobi preconditioner must be greater than 0!");
+    EXPECT_THROW_WHAT((plssvm::detail::pivoted_cholesky_preconditioner<double>{ size, 0, shift, entry }), plssvm::exception, "The rank of the pivoted Cholesky preconditioner must be greater than 0!");
+}
+
 // check whether the arithmetic_type_name correctly converts arithmetic values to a std::string
 TEST(Base, arithmetic_type_name) {
     // integral types
@@ -117,6 +247,34 @@ TEST(Base, arithmetic_type_name) {
     EXPECT_EQ(plssvm::detail::arithmetic_type_name<long double>(), "long double");
 }
 
+// check whether the CG residual replacement policy correctly detects the residual drift
+TEST(Base, residual_replacement) {
+    // replace once the residual norm dropped by a factor of 10 (= squared norm by a factor of 100)
+    plssvm::detail::residual_replacement<double> drift{ 0.1, 0 };
+    drift.reset(100.0);
+    EXPECT_FALSE(drift.replace(400.0));  // the largest residual since the last replacement increases
+    EXPECT_FALSE(drift.replace(5.0));
+    EXPECT_TRUE(drift.replace(4.0));
+    drift.reset(4.0);
+    EXPECT_FALSE(drift.replace(1.0));
+    EXPECT_TRUE(drift.replace(0.04));
+
+    // replace at the latest after three iterations
+    plssvm::detail::residual_replacement<double> interval{ 0.0, 3 };
+    interval.reset(1.0);
+    EXPECT_FALSE(interval.replace(0.5));
+    EXPECT_FALSE(interval.replace(0.25));
+    EXPECT_TRUE(interval.replace(0.125));
+    interval.reset(0.125);
+    EXPECT_FALSE(interval.replace(0.1));
+
+    // a threshold of one replaces the residual in every iteration
+    plssvm::detail::residual_replacement<float> always{ 1.0f, 0 };
+    always.reset(1.0f);
+    EXPECT_TRUE(always.replace(1.0f));
+    EXPECT_TRUE(always.replace(2.0f));
+}
+
 #if defined(PLSSVM_ENABLE_ASSERTS)
 // check whether the PLSSVM_ASSERT works correctly
 TEST(BaseDeathTest, plssvm_assert) {
@@ -154,4 +312,226 @@ TYPED_TEST(BaseKernelFunction, kernel_function) {
     util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::linear>(x1, x2), compare::detail::linear_kernel(x1, x2));
     util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::polynomial>(x1, x2, 3, 0.5, 0.0), compare::detail::poly_kernel(x1, x2, 3, real_type{ 0.5 }, real_type{ 0.0 }));
     util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::rbf>(x1, x2, 0.5), compare::detail::radial_kernel(x1, x2, real_type{ 0.5 }));
-}
\ No newline at end of file
+}
+
+// check whether the power of the polynomial kernel function unrolled into multiplications matches std::pow
+TYPED_TEST(BaseKernelFunction, integer_pow) {
+    using real_type = TypeParam;
+
+    for (const real_type base : { real_type{ -1.5 }, real_type{ 0.0 }, real_type{ 0.75 }, real_type{ 2.0 } }) {
+        for (int degree = 0; degree <= plssvm::detail::max_unrolled_degree + 2; ++degree) {
+            util::gtest_assert_floating_point_near(plssvm::detail::integer_pow(base, degree), std::pow(base, static_cast<real_type>(degree)), fmt::format("{}^{}", base, degree));
+        }
+    }
+    EXPECT_EQ(plssvm::detail::integer_pow<0>(real_type{ 3.0 }), real_type{ 1.0 });
+    EXPECT_EQ(plssvm::detail::integer_pow<5>(real_type{ 2.0 }), real_type{ 32.0 });
+
+    // only the degrees in [1, max_unrolled_degree] are dispatched to a compile-time degree
+    for (int degree = -1; degree <= plssvm::detail::max_unrolled_degree + 1; ++degree) {
+        const int unrolled = plssvm::detail::dispatch_degree(degree, [](const auto d) { return plssvm::detail::unrolled_degree_v<decltype(d)>; });
+        EXPECT_EQ(unrolled, degree >= 1 && degree <= plssvm::detail::max_unrolled_degree ? degree : 0) << fmt::format("degree {}", degree);
+    }
+
+    // the polynomial kernel function with the degree given at runtime and at compile-time
+    const std::vector<real_type> x1{ real_type{ 0.5 }, real_type{ -1.0 }, real_type{ 1.5 } };
+    const std::vector<real_type> x2{ real_type{ 1.0 }, real_type{ 0.25 }, real_type{ -0.5 } };
+    for (int degree = 1; degree <= plssvm::detail::max_unrolled_degree + 1; ++degree) {
+        const real_type expected = compare::detail::poly_kernel(x1, x2, degree, real_type{ 0.5 }, real_type{ 1.0 });
+        util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::polynomial>(x1, x2, degree, real_type{ 0.5 }, real_type{ 1.0 }), expected, fmt::format("degree {}", degree));
+        plssvm::detail::dispatch_degree(degree, [&](const auto d) {
+            util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::polynomial>(x1, x2, d, real_type{ 0.5 }, real_type{ 1.0 }), expected, fmt::format("degree {}", degree));
+        });
+    }
+}
+
+// check whether the fast exponential function stays within its maximum ULP error
+TYPED_TEST(BaseKernelFunction, fast_exp) {
+    using real_type = TypeParam;
+
+    // all arguments whose result is a normal floating point number
+    const real_type lower = std::is_same_v<real_type, double> ? real_type{ -708.0 } : real_type{ -87.0 };
+    const real_type upper = std::is_same_v<real_type, double> ? real_type{ 709.0 } : real_type{ 88.0 };
+    constexpr int num_steps = 100000;
+    for (int step = 0; step <= num_steps; ++step) {
+        const real_type x = lower + (upper - lower) * static_cast<real_type>(step) / static_cast<real_type>(num_steps);
+        const real_type correct = static_cast<real_type>(std::exp(static_cast<long double>(x)));
+        const real_type ulp = std::nextafter(correct, std::numeric_limits<real_type>::max()) - correct;
+        EXPECT_LE(std::abs(plssvm::detail::fast_exp(x) - correct), static_cast<real_type>(plssvm::detail::fast_exp_max_ulp_error) * ulp) << fmt::format("exp({})", x);
+    }
+    EXPECT_EQ(plssvm::detail::fast_exp(real_type{ 0.0 }), real_type{ 1.0 });
+    // results that would be subnormal are flushed to zero
+    EXPECT_EQ(plssvm::detail::fast_exp(real_type{ -1000.0 }), real_type{ 0.0 });
+
+    // the rbf kernel function using the fast exponential function given at runtime and at compile-time
+    const std::vector<real_type> x1{ real_type{ 0.5 }, real_type{ -1.0 }, real_type{ 1.5 } };
+    const std::vector<real_type> x2{ real_type{ 1.0 }, real_type{ 0.25 }, real_type{ -0.5 } };
+    const real_type expected = compare::detail::radial_kernel(x1, x2, real_type{ 0.5 });
+    for (const bool use_fast_exp : { false, true }) {
+        util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::rbf>(x1, x2, real_type{ 0.5 }, use_fast_exp), expected, fmt::format("fast_exp {}", use_fast_exp));
+        plssvm::detail::dispatch_fast_exp(use_fast_exp, [&](const auto fast_exp_value) {
+            util::gtest_assert_floating_point_near(plssvm::kernel_function<plssvm::kernel_type::rbf>(x1, x2, real_type{ 0.5 }, fast_exp_value), expected, fmt::format("fast_exp {}", use_fast_exp));
+        });
+    }
+}
+
+// check whether the exact feature map of the polynomial kernel function reproduces the kernel function
+TYPED_TEST(BaseKernelFunction, polynomial_feature_map) {
+    using real_type = TypeParam;
+    using feature_map_type = plssvm::detail::polynomial_feature_map<real_type>;
+
+    // create dummy data vectors
+    constexpr std::size_t size = 7;
+    std::vector<real_type> x1(size);
+    std::vector<real_type> x2(size);
+
+    // fill vectors with random values
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<real_type> dist(-1.0, 1.0);
+    std::generate(x1.begin(), x1.end(), [&]() { return dist(gen); });
+    std::generate(x2.begin(), x2.end(), [&]() { return dist(gen); });
+
+    // the number of monomials of total degree at most three (or exactly three if coef0 is zero) in seven variables
+    EXPECT_EQ(feature_map_type::size(size, 3, real_type{ 1.5 }), std::size_t{ 120 });
+    EXPECT_EQ(feature_map_type::size(size, 3, real_type{ 0.0 }), std::size_t{ 84 });
+
+    for (int degree = 1; degree <= feature_map_type::max_degree; ++degree) {
+        for (const real_type coef0 : { real_type{ 0.0 }, real_type{ 1.5 } }) {
+            const feature_map_type feature_map{ size, degree, real_type{ 0.5 }, coef0 };
+            EXPECT_EQ(feature_map.size(), feature_map_type::size(size, degree, coef0));
+
+            std::vector<real_type> phi1(feature_map.size());
+            std::vector<real_type> phi2(feature_map.size());
+            feature_map(x1.data(), phi1.data());
+            feature_map(x2.data(), phi2.data());
+            EXPECT_NEAR(std::inner_product(phi1.cbegin(), phi1.cend(), phi2.cbegin(), real_type{ 0.0 }), compare::detail::poly_kernel(x1, x2, degree, real_type{ 0.5 }, coef0), real_type{ 1e-4 }) << fmt::format("degree {}, coef0 {}", degree, coef0);
+        }
+    }
+
+    // negative coefficients of the expansion have no real feature map
+    EXPECT_FALSE(feature_map_type::is_supported(4, real_type{ 0.5 }, real_type{ 1.0 }));
+    EXPECT_FALSE(feature_map_type::is_supported(2, real_type{ -0.5 }, real_type{ 1.0 }));
+    EXPECT_FALSE(feature_map_type::is_supported(2, real_type{ 0.5 }, real_type{ -1.0 }));
+    EXPECT_THROW_WHAT(feature_map_type(size, 2, real_type{ 0.5 }, real_type{ -1.0 }), plssvm::exception, "The polynomial kernel function with degree 2, gamma 0.5, and coef0 -1 has no supported feature map!");
+}
+
+template <typename T>
+class BaseLinearAlgebra : public ::testing::Test {};
+TYPED_TEST_SUITE(BaseLinearAlgebra, floating_point_types);
+
+// check whether the Cholesky decomposition using LAPACK (if available) and the built-in loops (sequential and parallel) reproduces the decomposed matrix
+TYPED_TEST(BaseLinearAlgebra, cholesky_decomposition) {
+    using real_type = TypeParam;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<real_type> dist(-1.0, 1.0);
+    for (const std::size_t size : { std::size_t{ 9 }, plssvm::detail::cholesky_parallel_threshold + 9 }) {
+        // create a symmetric positive definite matrix with a leading dimension larger than its size
+        const std::size_t ld = size + 3;
+        std::vector<real_type> B(size * size);
+        std::generate(B.begin(), B.end(), [&]() { return dist(gen); });
+        std::vector<real_type> A(size * ld, real_type{ 0.0 });
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j <= i; ++j) {
+                A[i * ld + j] = std::inner_product(B.cbegin() + i * size, B.cbegin() + (i + 1) * size, B.cbegin() + j * size, real_type{ 0.0 }) + (i == j ? real_type{ 1.0 } : real_type{ 0.0 });
+            }
+        }
+
+        util::for_each_linear_algebra_implementation([&](const bool use_blas) {
+            std::vector<real_type> L(A);
+            ASSERT_TRUE(plssvm::detail::cholesky_decomposition(L.data(), size, ld)) << fmt::format("size: {}, LAPACK: {}", size, use_blas);
+            for (std::size_t i = 0; i < size; ++i) {
+                for (std::size_t j = 0; j <= i; ++j) {
+                    real_type temp{ 0.0 };
+                    for (std::size_t k = 0; k <= j; ++k) {
+                        temp += L[i * ld + k] * L[j * ld + k];
+                    }
+                    // the entries of A grow with its size
+                    EXPECT_NEAR(temp, A[i * ld + j], real_type{ 1e-5 } * static_cast<real_type>(size)) << fmt::format("({}, {}), size: {}, LAPACK: {}", i, j, size, use_blas);
+                }
+            }
+        });
+    }
+
+    util::for_each_linear_algebra_implementation([&](const bool use_blas) {
+        // a matrix that isn't positive definite
+        std::vector<real_type> indefinite{ real_type{ 1.0 }, real_type{ 0.0 }, real_type{ 2.0 }, real_type{ 1.0 } };
+        EXPECT_FALSE(plssvm::detail::cholesky_decomposition(indefinite.data(), 2, 2)) << fmt::format("LAPACK: {}", use_blas);
+    });
+}
+
+// check whether the row-major BLAS interface matches the naive loops
+TYPED_TEST(BaseLinearAlgebra, blas) {
+#if defined(PLSSVM_HAS_BLAS)
+    using real_type = TypeParam;
+
+    constexpr std::size_t m = 7;
+    constexpr std::size_t n = 5;
+    constexpr std::size_t k = 6;
+    constexpr std::size_t ld = k + 2;
+    constexpr real_type alpha{ 2.0 };
+    constexpr real_type beta{ 0.5 };
+
+    // fill matrices and vectors with random values
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<real_type> dist(-1.0, 1.0);
+    std::vector<real_type> A(m * ld);
+    std::vector<real_type> B(n * ld);
+    std::vector<real_type> C(m * n);
+    std::vector<real_type> x(k);
+    std::vector<real_type> y(m);
+    for (std::vector<real_type> *vec : { &A, &B, &C, &x, &y }) {
+        std::generate(vec->begin(), vec->end(), [&]() { return dist(gen); });
+    }
+    const auto dot = [&](const real_type *lhs, const real_type *rhs) { return std::inner_product(lhs, lhs + k, rhs, real_type{ 0.0 }); };
+
+    // C = alpha * A * B^T + beta * C
+    std::vector<real_type> result(C);
+    plssvm::detail::blas::gemm_nt(m, n, k, alpha, A.data(), ld, B.data(), ld, beta, result.data(), n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            EXPECT_NEAR(result[i * n + j], alpha * dot(A.data() + i * ld, B.data() + j * ld) + beta * C[i * n + j], real_type{ 1e-4 }) << fmt::format("gemm_nt ({}, {})", i, j);
+        }
+    }
+
+    // the lower triangle of C = alpha * A * A^T + beta * C, the upper triangle must not change
+    std::vector<real_type> C_square(m * m);
+    std::generate(C_square.begin(), C_square.end(), [&]() { return dist(gen); });
+    result = C_square;
+    plssvm::detail::blas::syrk_lower(m, k, alpha, A.data(), ld, beta, result.data(), m);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < m; ++j) {
+            const real_type correct = j <= i ? alpha * dot(A.data() + i * ld, A.data() + j * ld) + beta * C_square[i * m + j] : C_square[i * m + j];
+            EXPECT_NEAR(result[i * m + j], correct, real_type{ 1e-4 }) << fmt::format("syrk_lower ({}, {})", i, j);
+        }
+    }
+
+    // y = alpha * A * x + beta * y
+    result = y;
+    plssvm::detail::blas::gemv_n(m, k, alpha, A.data(), ld, x.data(), beta, result.data());
+    for (std::size_t i = 0; i < m; ++i) {
+        EXPECT_NEAR(result[i], alpha * dot(A.data() + i * ld, x.data()) + beta * y[i], real_type{ 1e-4 }) << fmt::format("gemv_n {}", i);
+    }
+
+    // x = alpha * A^T * y + beta * x
+    result = x;
+    plssvm::detail::blas::gemv_t(m, k, alpha, A.data(), ld, y.data(), beta, result.data());
+    for (std::size_t j = 0; j < k; ++j) {
+        real_type temp{ 0.0 };
+        for (std::size_t i = 0; i < m; ++i) {
+            temp += A[i * ld + j] * y[i];
+        }
+        EXPECT_NEAR(result[j], alpha * temp + beta * x[j], real_type{ 1e-4 }) << fmt::format("gemv_t {}", j);
+    }
+
+    // sizes that don't fit into the integers of the Fortran interface fall back to the built-in loops
+    util::for_each_linear_algebra_implementation([&](const bool use_blas) {
+        EXPECT_EQ(plssvm::detail::blas::is_enabled_for(m, n, k, ld), use_blas);
+        EXPECT_FALSE(plssvm::detail::blas::is_enabled_for(m, static_cast<std::size_t>(std::numeric_limits<int>::max()) + 1));
+    });
+#else
+    GTEST_SKIP() << "PLSSVM has been built without BLAS/LAPACK!";
+#endif
+}
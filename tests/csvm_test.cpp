@@ -12,7 +12,10 @@
 
 #include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_file_format_exception, plssvm::file_not_found_exception
 #include "plssvm/kernel_types.hpp"           // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                 // plssvm::aos_matrix
 #include "plssvm/parameter.hpp"              // plssvm::parameter
+#include "plssvm/preconditioner_types.hpp"   // plssvm::preconditioner_type
+#include "plssvm/solver_types.hpp"           // plssvm::solver_type
 
 #include "backends/compare.hpp"  // compare::kernel_function
 #include "utility.hpp"           // util::gtest_expect_floating_point_eq, util::google_test::parameter_definition, util::google_test::parameter_definition_to_name,
@@ -29,50 +32,9 @@
 #include <memory>      // std::make_shared
 #include <random>      // std::random_device, std::mt19937, std::uniform_real_distribution
 #include <string>      // std::string
+#include <utility>     // std::pair
 #include <vector>      // std::vector
 
-// the floating point types to test
-using floating_point_types = ::testing::Types<float, double>;
-
-template <typename T>
-class BaseCSVMTransform : public ::testing::Test {};
-TYPED_TEST_SUITE(BaseCSVMTransform, floating_point_types);
-
-// check whether transforming the 2D data into a 1D vector works as intended
-TYPED_TEST(BaseCSVMTransform, transform_data) {
-    // create parameter object
-    plssvm::parameter<TypeParam> params;
-    params.print_info = false;
-    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
-
-    // create C-SVM
-    mock_csvm csvm{ params };
-    using real_type = typename decltype(csvm)::real_type;
-
-    // transform data without and with boundary
-    std::vector<real_type> result_no_boundary = csvm.transform_data(csvm.get_data(), 0, csvm.get_num_data_points() - 1);
-    std::vector<real_type> result_boundary = csvm.transform_data(csvm.get_data(), 10, csvm.get_num_data_points());
-
-    // check if sizes match
-    ASSERT_EQ(result_no_boundary.size(), (csvm.get_num_data_points() - 1) * csvm.get_num_features());
-    ASSERT_EQ(result_boundary.size(), (csvm.get_num_data_points() + 10) * csvm.get_num_features());
-
-    // check transformed content for correctness
-    for (std::size_t datapoint = 0; datapoint < csvm.get_num_data_points() - 1; ++datapoint) {
-        for (std::size_t feature = 0; feature < csvm.get_num_features(); ++feature) {
-            util::gtest_expect_floating_point_eq(
-                csvm.get_data()[datapoint][feature],
-                result_no_boundary[datapoint + feature * (csvm.get_num_data_points() - 1)],
-                fmt::format("datapoint: {} feature: {} at index: {}", datapoint, feature, datapoint + feature * (csvm.get_num_data_points() - 1)));
-
-            util::gtest_expect_floating_point_eq(
-                csvm.get_data()[datapoint][feature],
-                result_boundary[datapoint + feature * (csvm.get_num_data_points() + 10)],
-                fmt::format("datapoint: {} feature: {} at index: {}", datapoint, feature, datapoint + feature * (csvm.get_num_data_points() + 10)));
-        }
-    }
-}
-
 // enumerate all floating point type and kernel combinations to test
 using parameter_types = ::testing::Types<
     util::google_test::parameter_definition<float, plssvm::kernel_type::linear>,
@@ -107,13 +69,22 @@ TYPED_TEST(BaseCSVM, constructor) {
     EXPECT_EQ(params.cost, csvm.get_cost());
     EXPECT_EQ(params.epsilon, csvm.get_epsilon());
     EXPECT_EQ(params.print_info, csvm.get_print_info());
+    EXPECT_EQ(params.solver, csvm.get_solver());
+    EXPECT_EQ(params.memory_budget, csvm.get_memory_budget());
+    EXPECT_EQ(params.replace_threshold, csvm.get_replace_threshold());
+    EXPECT_EQ(params.replace_interval, csvm.get_replace_interval());
+    EXPECT_EQ(params.preconditioner, csvm.get_preconditioner());
+    EXPECT_EQ(params.precond_size, csvm.get_precond_size());
+    EXPECT_EQ(params.mixed_precision, csvm.get_mixed_precision());
+    EXPECT_EQ(params.fast_math_kernels, csvm.get_fast_math_kernels());
+    EXPECT_EQ(params.feature_map, csvm.get_feature_map());
 
     EXPECT_EQ(params.data_ptr, csvm.get_data_ptr());
     EXPECT_EQ(params.value_ptr, csvm.get_value_ptr());
     EXPECT_EQ(params.alpha_ptr, csvm.get_alpha_ptr());
 
-    EXPECT_EQ(params.data_ptr->size(), csvm.get_num_data_points());
-    EXPECT_EQ(params.data_ptr->front().size(), csvm.get_num_features());
+    EXPECT_EQ(params.data_ptr->num_rows(), csvm.get_num_data_points());
+    EXPECT_EQ(params.data_ptr->num_cols(), csvm.get_num_features());
     EXPECT_EQ(-params.rho, csvm.get_bias());
     EXPECT_EQ(real_type{ 0 }, csvm.get_QA_cost());
 }
@@ -130,24 +101,28 @@ TYPED_TEST(BaseCSVM, constructor_exceptions) {
     EXPECT_THROW_WHAT(mock_csvm{ params }, plssvm::exception, "No data points provided!");
 
     // create C-SVM with empty data_ptr
-    params.data_ptr = std::make_shared<const std::vector<std::vector<real_type>>>();
+    params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>();
     EXPECT_THROW_WHAT(mock_csvm{ params }, plssvm::exception, "Data set is empty!");
 
     // create C-SVM with a data set with features of different sizes
     std::vector<std::vector<real_type>> data = { { real_type{ 1 } }, { real_type{ 2 }, real_type{ 3 } } };
-    params.data_ptr = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(data));
-    EXPECT_THROW_WHAT(mock_csvm{ params }, plssvm::exception, "All points in the data vector must have the same number of features!");
+    EXPECT_THROW_WHAT(plssvm::aos_matrix<real_type>{ data }, plssvm::exception, "All points in the data vector must have the same number of features!");
 
     // create C-SVM with zero sized features
     data = { {}, {} };
-    params.data_ptr = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(data));
+    params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>(data);
     EXPECT_THROW_WHAT(mock_csvm{ params }, plssvm::exception, "No features provided for the data points!");
 
     // if alpha_ptr is set, it must have the same size as data_ptr
     data = { { real_type{ 1 } }, { real_type{ 2 } }, { real_type{ 3 } } };
-    params.data_ptr = std::make_shared<const std::vector<std::vector<real_type>>>(std::move(data));
+    params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>(data);
     std::vector<real_type> alpha = { real_type{ 1 }, real_type{ 2 }, real_type{ 3 } };
     params.alpha_ptr = std::make_shared<const std::vector<real_type>>(std::move(alpha));
+
+    // the residual replacement threshold must be in the range [0, 1]
+    params.alpha_ptr = nullptr;
+    params.replace_threshold = real_type{ 1.5 };
+    EXPECT_THROW_WHAT(mock_csvm{ params }, plssvm::exception, "The residual replacement threshold (1.5) must be in the range [0, 1]!");
 }
 
 // check whether attempting to write the model file wrong data correctly fails
@@ -183,8 +158,7 @@ TYPED_TEST(BaseCSVM, kernel_function) {
     params.kernel = TypeParam::kernel;
 
     // set dummy data
-    std::vector<std::vector<typename decltype(params)::real_type>> vec(1, std::vector<typename decltype(params)::real_type>(1));
-    params.data_ptr = std::make_shared<const std::vector<std::vector<typename decltype(params)::real_type>>>(std::move(vec));
+    params.data_ptr = std::make_shared<const plssvm::aos_matrix<typename decltype(params)::real_type>>(1, 1);
 
     // create C-SVM
     mock_csvm csvm{ params };
@@ -211,6 +185,31 @@ TYPED_TEST(BaseCSVM, kernel_function) {
     util::gtest_expect_floating_point_eq(correct, calculated);
 }
 
+// check whether the CG solver variant is correctly resolved
+TYPED_TEST(BaseCSVM, resolve_solver) {
+    // create parameter object
+    plssvm::parameter<typename TypeParam::real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    constexpr std::size_t MiB = 1024 * 1024;
+
+    // explicitly requested solvers are always used
+    params.solver = plssvm::solver_type::cg_explicit;
+    EXPECT_EQ(mock_csvm{ params }.resolve_solver(1024 * MiB), plssvm::solver_type::cg_explicit);
+    params.solver = plssvm::solver_type::cg_implicit;
+    EXPECT_EQ(mock_csvm{ params }.resolve_solver(1), plssvm::solver_type::cg_implicit);
+
+    // automatic selects the explicit solver only if the kernel matrix fits into the memory budget
+    params.solver = plssvm::solver_type::automatic;
+    params.memory_budget = 16;
+    mock_csvm csvm{ params };
+    EXPECT_EQ(csvm.resolve_solver(16 * MiB), plssvm::solver_type::cg_explicit);
+    EXPECT_EQ(csvm.resolve_solver(16 * MiB + 1), plssvm::solver_type::cg_implicit);
+}
+
 // check whether plssvm::csvm<T>::learn() internally calls the correct functions
 TYPED_TEST(BaseCSVM, learn) {
     // create parameter object
@@ -256,6 +255,478 @@ TYPED_TEST(BaseCSVM, learn_exceptions) {
     EXPECT_THROW_WHAT(csvm.learn(), plssvm::exception, "Number of labels (0) must match the number of data points (5)!");
 }
 
+// check whether plssvm::csvm<T>::learn() only solves the primal problem of the polynomial kernel if it is cheaper and no CG configuration has been requested explicitly
+TYPED_TEST(BaseCSVM, learn_polynomial_feature_map) {
+    // only the polynomial kernel has an exact finite feature map
+    if constexpr (TypeParam::kernel == plssvm::kernel_type::polynomial) {
+        using real_type = typename TypeParam::real_type;
+
+        // many data points with few features, such that the primal problem of the degree 2 polynomial kernel is cheaper than the dual one
+        const plssvm::parameter<real_type> params = util::create_polynomial_feature_map_parameter<real_type>();
+
+        // the primal problem is solved without the CG solver
+        {
+            mock_csvm csvm{ params };
+            EXPECT_CALL(csvm, solver_CG).Times(0);
+            csvm.learn();
+        }
+
+        // disabling the feature map or requesting a CG configuration explicitly solves the dual problem
+        const auto expect_dual = [](const plssvm::parameter<real_type> &dual_params) {
+            mock_csvm csvm{ dual_params };
+            EXPECT_CALL(csvm, solver_CG).Times(1);
+            csvm.learn();
+        };
+        plssvm::parameter<real_type> dual_params{ params };
+        dual_params.feature_map = false;
+        expect_dual(dual_params);
+        dual_params = params;
+        dual_params.solver = plssvm::solver_type::cg_implicit;
+        expect_dual(dual_params);
+        dual_params = params;
+        dual_params.preconditioner = plssvm::preconditioner_type::jacobi;
+        expect_dual(dual_params);
+        dual_params = params;
+        dual_params.mixed_precision = true;
+        expect_dual(dual_params);
+    }
+}
+
+// check whether plssvm::csvm<T>::learn() with a warm start passes the weights of the matching support vectors to the CG solver
+TYPED_TEST(BaseCSVM, learn_warm_start) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // the second and fourth data point (plus an unknown one) are the support vectors of the previous model
+    const std::vector<std::vector<real_type>> data = csvm.get_data();
+    const plssvm::aos_matrix<real_type> support_vectors{ std::vector<std::vector<real_type>>{ data[3], data[1], std::vector<real_type>(4, real_type{ 42.0 }) } };
+    const std::vector<real_type> alpha{ real_type{ -0.25 }, real_type{ 0.5 }, real_type{ 1.0 } };
+
+    EXPECT_CALL(csvm, setup_data_on_device).Times(2);
+    EXPECT_CALL(csvm, generate_q).Times(2);
+    EXPECT_CALL(csvm, solver_CG(::testing::_, std::vector<real_type>{ 0.0, 0.5, 0.0, -0.25 }, ::testing::_, ::testing::_, ::testing::_)).Times(1);
+    // the warm start is only used once
+    EXPECT_CALL(csvm, solver_CG(::testing::_, std::vector<real_type>(4, real_type{ 1.0 }), ::testing::_, ::testing::_, ::testing::_)).Times(1);
+
+    csvm.learn(support_vectors, alpha);
+    csvm.learn();
+}
+
+// check whether plssvm::csvm<T>::learn() with a warm start and wrong data correctly fails
+TYPED_TEST(BaseCSVM, learn_warm_start_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(csvm, generate_q).Times(0);
+    EXPECT_CALL(csvm, solver_CG).Times(0);
+
+    // attempting to warm start with a different number of weights than support vectors should result in an exception
+    const plssvm::aos_matrix<real_type> support_vectors{ 2, 4 };
+    EXPECT_THROW_WHAT(csvm.learn(support_vectors, std::vector<real_type>(3)), plssvm::exception, "Number of weights (3) must match the number of support vectors (2)!");
+
+    // attempting to warm start with support vectors having more features than the data points should result in an exception
+    EXPECT_THROW_WHAT(csvm.learn(plssvm::aos_matrix<real_type>{ 2, 5 }, std::vector<real_type>(2)), plssvm::exception, "Number of features per support vector (5) must not exceed the number of features per data point (4)!");
+
+    // attempting to warm start a multi-class model should result in an exception
+    plssvm::parameter<real_type> multiclass_params;
+    multiclass_params.print_info = false;
+    multiclass_params.kernel = TypeParam::kernel;
+    multiclass_params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+    mock_csvm multiclass_csvm{ multiclass_params };
+    EXPECT_CALL(multiclass_csvm, setup_data_on_device).Times(0);
+    EXPECT_THROW_WHAT(multiclass_csvm.learn(support_vectors, std::vector<real_type>(2)), plssvm::exception, "Warm-starting the CG solver is only supported for two classes!");
+}
+
+// check whether plssvm::csvm<T>::append_data() extends the data set and starts the next CG solve from the previous model
+TYPED_TEST(BaseCSVM, append_data) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM with a previously learned model
+    mock_csvm csvm{ params };
+    csvm.set_model(params.cost, std::vector<real_type>{ 0.1, 0.2, 0.3, 0.4, -1.0 }, real_type{ 0.5 });
+
+    csvm.append_data({ std::vector<real_type>(4, real_type{ 1.0 }), std::vector<real_type>(4, real_type{ -1.0 }) }, { real_type{ 1.0 }, real_type{ -1.0 } });
+    EXPECT_EQ(csvm.get_num_data_points(), std::size_t{ 7 });
+    EXPECT_EQ(csvm.get_data().back(), std::vector<real_type>(4, real_type{ -1.0 }));
+    EXPECT_EQ(*csvm.get_value_ptr(), (std::vector<real_type>{ 1.0, 1.0, -1.0, -1.0, -1.0, 1.0, -1.0 }));
+
+    // the model isn't a model of the extended data set
+    const std::string model_file = util::create_temp_file();
+    EXPECT_THROW_WHAT(csvm.write_model(model_file), plssvm::exception, "No alphas given! Maybe a call to 'learn()' is missing?");
+    std::filesystem::remove(model_file);
+
+    // the new data points start with a weight of zero
+    EXPECT_CALL(csvm, setup_data_on_device).Times(1);
+    EXPECT_CALL(csvm, generate_q).Times(1);
+    EXPECT_CALL(csvm, solver_CG(::testing::_, std::vector<real_type>{ 0.1, 0.2, 0.3, 0.4, -1.0, 0.0 }, ::testing::_, ::testing::_, ::testing::_)).Times(1);
+
+    csvm.learn();
+}
+
+// check whether plssvm::csvm<T>::append_data() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, append_data_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // attempting to append no data points should result in an exception
+    EXPECT_THROW_WHAT(csvm.append_data({}, {}), plssvm::exception, "No data points to append given!");
+
+    // attempting to append a different number of labels than data points should result in an exception
+    EXPECT_THROW_WHAT(csvm.append_data({ std::vector<real_type>(4) }, { real_type{ 1.0 }, real_type{ -1.0 } }), plssvm::exception, "Number of labels (2) must match the number of data points to append (1)!");
+
+    // attempting to append data points with a wrong number of features should result in an exception
+    EXPECT_THROW_WHAT(csvm.append_data({ std::vector<real_type>(4), std::vector<real_type>(3) }, { real_type{ 1.0 }, real_type{ -1.0 } }), plssvm::exception, "All data points to append must have 4 features!");
+
+    // attempting to append data points without any labels specified should result in an exception
+    csvm.get_value_ptr() = nullptr;
+    EXPECT_THROW_WHAT(csvm.append_data({ std::vector<real_type>(4) }, { real_type{ 1.0 } }), plssvm::exception, "No labels given for training! Maybe the data is only usable for prediction?");
+
+    // the data set is unchanged
+    EXPECT_EQ(csvm.get_num_data_points(), std::size_t{ 5 });
+}
+
+// check whether plssvm::csvm<T>::learn_cost_path() internally calls the correct functions
+TYPED_TEST(BaseCSVM, learn_cost_path) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    EXPECT_CALL(csvm, setup_data_on_device).Times(1);
+    EXPECT_CALL(csvm, generate_q).Times(1);
+    EXPECT_CALL(csvm, solver_CG).Times(0);
+    EXPECT_CALL(csvm, solver_CG_cost_path).WillOnce(::testing::Return(std::vector<std::vector<real_type>>(2)));
+
+    const auto models = csvm.learn_cost_path({ real_type{ 0.1 }, real_type{ 10.0 } });
+    EXPECT_EQ(models.size(), 2);
+}
+
+// check whether plssvm::csvm<T>::learn_cost_path() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, learn_cost_path_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(csvm, generate_q).Times(0);
+    EXPECT_CALL(csvm, solver_CG_cost_path).Times(0);
+
+    // attempting to learn a cost path without costs or with a non-positive cost should result in an exception
+    std::vector<std::pair<std::vector<real_type>, real_type>> models;
+    EXPECT_THROW_WHAT(models = csvm.learn_cost_path({}), plssvm::exception, "At least one cost must be given to learn a cost path!");
+    EXPECT_THROW_WHAT(models = csvm.learn_cost_path({ real_type{ 1.0 }, real_type{ 0.0 } }), plssvm::exception, "All costs of the cost path must be positive, but 0 isn't!");
+
+    // attempting to learn a cost path without any labels specified should result in an exception
+    csvm.get_value_ptr() = nullptr;
+    EXPECT_THROW_WHAT(models = csvm.learn_cost_path({ real_type{ 1.0 } }), plssvm::exception, "No labels given for training! Maybe the data is only usable for prediction?");
+
+    // attempting to use a model with a different number of weights than data points should result in an exception
+    EXPECT_THROW_WHAT(csvm.set_model(real_type{ 1.0 }, std::vector<real_type>(4), real_type{ 0.0 }), plssvm::exception, "Number of weights (4) must match the number of data points (5)!");
+}
+
+// check whether plssvm::csvm<T>::learn_labels() internally calls the correct functions
+TYPED_TEST(BaseCSVM, learn_labels) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    EXPECT_CALL(csvm, setup_data_on_device).Times(1);
+    EXPECT_CALL(csvm, generate_q).Times(1);
+    EXPECT_CALL(csvm, solver_CG).Times(0);
+    EXPECT_CALL(csvm, solver_CG_block).WillOnce(::testing::Return(std::vector<std::vector<real_type>>(2)));
+
+    const std::vector<real_type> labels = *csvm.get_value_ptr();
+    const auto models = csvm.learn_labels({ labels, labels });
+    EXPECT_EQ(models.size(), 2);
+}
+
+// check whether plssvm::csvm<T>::learn_labels() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, learn_labels_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(csvm, generate_q).Times(0);
+    EXPECT_CALL(csvm, solver_CG_block).Times(0);
+
+    // attempting to learn without label sets or with a wrong number of labels should result in an exception
+    std::vector<std::pair<std::vector<real_type>, real_type>> models;
+    EXPECT_THROW_WHAT(models = csvm.learn_labels({}), plssvm::exception, "At least one label set must be given to learn multiple models!");
+    EXPECT_THROW_WHAT(models = csvm.learn_labels({ *csvm.get_value_ptr(), std::vector<real_type>(3) }), plssvm::exception, "Number of labels (3) of label set 1 must match the number of data points (5)!");
+}
+
+// check whether plssvm::csvm<T>::cross_validate() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, cross_validate_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(csvm, generate_q).Times(0);
+    EXPECT_CALL(csvm, solver_CG_block).Times(0);
+
+    // attempting to cross-validate with an illegal number of folds should result in an exception
+    std::vector<real_type> accuracies;
+    EXPECT_THROW_WHAT(accuracies = csvm.cross_validate(1), plssvm::exception, "The number of folds (1) must be in the range [2, 5]!");
+    EXPECT_THROW_WHAT(accuracies = csvm.cross_validate(6), plssvm::exception, "The number of folds (6) must be in the range [2, 5]!");
+
+    // attempting to cross-validate more than two classes should result in an exception
+    plssvm::parameter<real_type> multiclass_params;
+    multiclass_params.print_info = false;
+    multiclass_params.kernel = TypeParam::kernel;
+    multiclass_params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+    mock_csvm multiclass_csvm{ multiclass_params };
+    EXPECT_CALL(multiclass_csvm, setup_data_on_device).Times(0);
+    EXPECT_THROW_WHAT(accuracies = multiclass_csvm.cross_validate(3), plssvm::exception, "Cross-validation is only supported for two classes!");
+}
+
+// check whether plssvm::csvm<T>::loo_error() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, loo_error_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(csvm, generate_q).Times(0);
+    EXPECT_CALL(csvm, solver_CG_block).Times(0);
+
+    // attempting to estimate the leave-one-out error without probing vectors should result in an exception
+    [[maybe_unused]] real_type error;
+    EXPECT_THROW_WHAT(error = csvm.loo_error(0), plssvm::exception, "At least one probing vector is necessary to estimate the leave-one-out error!");
+
+    // attempting to estimate the leave-one-out error of more than two classes should result in an exception
+    plssvm::parameter<real_type> multiclass_params;
+    multiclass_params.print_info = false;
+    multiclass_params.kernel = TypeParam::kernel;
+    multiclass_params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+    mock_csvm multiclass_csvm{ multiclass_params };
+    EXPECT_CALL(multiclass_csvm, setup_data_on_device).Times(0);
+    EXPECT_THROW_WHAT(error = multiclass_csvm.loo_error(10), plssvm::exception, "Leave-one-out cross-validation is only supported for two classes!");
+}
+
+// check whether plssvm::csvm<T>::learn_nystrom() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, learn_nystrom_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+
+    // attempting to learn a Nyström approximation without landmarks should result in an exception
+    EXPECT_THROW_WHAT(csvm.learn_nystrom(0), plssvm::exception, "At least one landmark is necessary for the Nyström approximation!");
+
+    // attempting to learn a Nyström approximation of more than two classes should result in an exception
+    plssvm::parameter<real_type> multiclass_params;
+    multiclass_params.print_info = false;
+    multiclass_params.kernel = TypeParam::kernel;
+    multiclass_params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+    mock_csvm multiclass_csvm{ multiclass_params };
+    EXPECT_CALL(multiclass_csvm, setup_data_on_device).Times(0);
+    EXPECT_THROW_WHAT(multiclass_csvm.learn_nystrom(10), plssvm::exception, "The Nyström approximation is only supported for two classes!");
+
+    // attempting to learn a Nyström approximation without labels should result in an exception
+    params.value_ptr = nullptr;
+    mock_csvm csvm_no_labels{ params };
+    EXPECT_CALL(csvm_no_labels, setup_data_on_device).Times(0);
+    EXPECT_THROW_WHAT(csvm_no_labels.learn_nystrom(2), plssvm::exception, "No labels given for training! Maybe the data is only usable for prediction?");
+}
+
+// check whether plssvm::csvm<T>::learn_random_features() with wrong data correctly fails
+TYPED_TEST(BaseCSVM, learn_random_features_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+
+    // attempting to learn without random features should result in an exception
+    EXPECT_THROW_WHAT(csvm.learn_random_features(0), plssvm::exception, "At least one random feature is necessary!");
+
+    // attempting to learn random features of another kernel than the rbf kernel should result in an exception
+    if (TypeParam::kernel != plssvm::kernel_type::rbf) {
+        EXPECT_THROW_WHAT(csvm.learn_random_features(10), plssvm::exception, fmt::format("Random Fourier features are only supported for the rbf kernel, but '{}' was given!", TypeParam::kernel));
+        return;
+    }
+
+    // attempting to learn random features of more than two classes should result in an exception
+    plssvm::parameter<real_type> multiclass_params;
+    multiclass_params.print_info = false;
+    multiclass_params.kernel = TypeParam::kernel;
+    multiclass_params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+    mock_csvm multiclass_csvm{ multiclass_params };
+    EXPECT_CALL(multiclass_csvm, setup_data_on_device).Times(0);
+    EXPECT_THROW_WHAT(multiclass_csvm.learn_random_features(10), plssvm::exception, "Random Fourier features are only supported for two classes!");
+}
+
+// check whether plssvm::csvm<T>::compress_nystrom() and plssvm::csvm<T>::compress_random_features() with wrong models or data correctly fail
+TYPED_TEST(BaseCSVM, compress_model_exceptions) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter object
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+    const plssvm::aos_matrix<real_type> validation{ params.data_ptr->to_2D_vector() };
+
+    // create C-SVM
+    mock_csvm csvm{ params };
+
+    // functions shouldn't be called, since the exceptions must trigger beforehand
+    EXPECT_CALL(csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(csvm, predict).Times(0);
+
+    // attempting to compress into an empty feature map should result in an exception
+    [[maybe_unused]] real_type error;
+    EXPECT_THROW_WHAT(error = csvm.compress_nystrom(0, validation), plssvm::exception, "At least one landmark is necessary for the Nyström approximation!");
+    EXPECT_THROW_WHAT(error = csvm.compress_random_features(0, validation), plssvm::exception, "At least one random feature is necessary!");
+    if (TypeParam::kernel != plssvm::kernel_type::rbf) {
+        EXPECT_THROW_WHAT(error = csvm.compress_random_features(10, validation), plssvm::exception, fmt::format("Random Fourier features are only supported for the rbf kernel, but '{}' was given!", TypeParam::kernel));
+    }
+
+    // attempting to compress without a model should result in an exception
+    EXPECT_THROW_WHAT(error = csvm.compress_nystrom(2, validation), plssvm::exception, "No model given to compress! Maybe learn() wasn't called?");
+
+    // attempting to compress a model using wrong validation points should result in an exception
+    plssvm::parameter<real_type> model_params;
+    model_params.print_info = false;
+    model_params.parse_model_file(PLSSVM_TEST_PATH "/data/models/5x4.libsvm.rbf.model");
+    mock_csvm model_csvm{ model_params };
+    EXPECT_CALL(model_csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(model_csvm, predict).Times(0);
+    EXPECT_THROW_WHAT(error = model_csvm.compress_random_features(10, plssvm::aos_matrix<real_type>{}), plssvm::exception, "At least one validation point is necessary to measure the approximation error!");
+    EXPECT_THROW_WHAT(error = model_csvm.compress_random_features(10, plssvm::aos_matrix<real_type>{ std::vector<std::vector<real_type>>{ { 1.0, 2.0, 3.0 } } }), plssvm::exception, "Number of features per data point (4) must match the number of features per validation point (3)!");
+
+    // attempting to compress a model without labels of its support vectors into the Nyström approximation should result in an exception
+    model_csvm.get_value_ptr() = nullptr;
+    EXPECT_THROW_WHAT(error = model_csvm.compress_nystrom(2, validation), plssvm::exception, "No labels of the support vectors given! The Nyström approximation keeps the labels of its landmarks.");
+
+    // attempting to compress an already compressed model should result in an exception
+    plssvm::parameter<real_type> random_features_params;
+    random_features_params.print_info = false;
+    random_features_params.parse_model_file(PLSSVM_TEST_PATH "/data/models/random_features.model");
+    mock_csvm random_features_csvm{ random_features_params };
+    EXPECT_CALL(random_features_csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(random_features_csvm, predict).Times(0);
+    EXPECT_THROW_WHAT(error = random_features_csvm.compress_random_features(10, plssvm::aos_matrix<real_type>{ std::vector<std::vector<real_type>>{ { 1.0, 2.0, 3.0 } } }), plssvm::exception, "The model is already compressed using random Fourier features!");
+
+    // attempting to compress a multi-class model should result in an exception
+    plssvm::parameter<real_type> multiclass_params;
+    multiclass_params.print_info = false;
+    multiclass_params.parse_model_file(PLSSVM_TEST_PATH "/data/models/6x4.multiclass.model");
+    mock_csvm multiclass_csvm{ multiclass_params };
+    EXPECT_CALL(multiclass_csvm, setup_data_on_device).Times(0);
+    EXPECT_CALL(multiclass_csvm, predict).Times(0);
+    EXPECT_THROW_WHAT(error = multiclass_csvm.compress_nystrom(2, validation), plssvm::exception, "Compressing a model is only supported for two classes!");
+}
+
 // check whether plssvm::csvm<T>::accuracy() with an empty points vector returns an accuracy of 0
 TYPED_TEST(BaseCSVM, accuracy_empty_points) {
     using real_type = typename TypeParam::real_type;
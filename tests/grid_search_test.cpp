@@ -0,0 +1,288 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the hyperparameter grid search.
+ */
+
+#include "plssvm/grid_search.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::exception
+#include "plssvm/kernel_types.hpp"           // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                 // plssvm::aos_matrix
+#include "plssvm/parameter.hpp"              // plssvm::parameter
+#include "plssvm/preconditioner_types.hpp"   // plssvm::preconditioner_type
+
+#include "backends/compare.hpp"  // compare::detail::linear_kernel, compare::detail::poly_kernel, compare::detail::radial_kernel
+#include "utility.hpp"           // util::gtest_expect_floating_point_eq, util::google_test::parameter_definition, util::google_test::parameter_definition_to_name,
+                                 // util::create_temp_file, EXPECT_THROW_WHAT
+
+#include "gtest/gtest.h"  // ::testing::Test, ::testing::Types, TYPED_TEST_SUITE, TYPED_TEST, ASSERT_EQ, EXPECT_EQ, EXPECT_THROW
+
+#include <cmath>       // std::abs
+#include <cstddef>     // std::size_t
+#include <filesystem>  // std::filesystem::remove
+#include <memory>      // std::make_shared
+#include <string>      // std::string
+#include <utility>     // std::swap
+#include <vector>      // std::vector
+
+// enumerate all floating point type and kernel combinations to test
+using parameter_types = ::testing::Types<
+    util::google_test::parameter_definition<float, plssvm::kernel_type::linear>,
+    util::google_test::parameter_definition<float, plssvm::kernel_type::polynomial>,
+    util::google_test::parameter_definition<float, plssvm::kernel_type::rbf>,
+    util::google_test::parameter_definition<double, plssvm::kernel_type::linear>,
+    util::google_test::parameter_definition<double, plssvm::kernel_type::polynomial>,
+    util::google_test::parameter_definition<double, plssvm::kernel_type::rbf>>;
+
+template <typename T>
+class GridSearch : public ::testing::Test {};
+TYPED_TEST_SUITE(GridSearch, parameter_types, util::google_test::parameter_definition_to_name);
+
+// enumerate all kernels in double precision to compare the cross-validation accuracy against a direct solution
+using double_parameter_types = ::testing::Types<
+    util::google_test::parameter_definition<double, plssvm::kernel_type::linear>,
+    util::google_test::parameter_definition<double, plssvm::kernel_type::polynomial>,
+    util::google_test::parameter_definition<double, plssvm::kernel_type::rbf>>;
+
+template <typename T>
+class GridSearchAccuracy : public ::testing::Test {};
+TYPED_TEST_SUITE(GridSearchAccuracy, double_parameter_types, util::google_test::parameter_definition_to_name);
+
+// check whether the grid only varies the hyperparameters used by the kernel function
+TYPED_TEST(GridSearch, make_grid) {
+    using real_type = typename TypeParam::real_type;
+    using grid_search_type = plssvm::grid_search<real_type>;
+
+    const std::vector<real_type> gammas{ 0.1, 0.01 };
+    const std::vector<real_type> coef0s{ 0.0, 1.0, 2.0 };
+    const std::vector<int> degrees{ 2, 3 };
+    const std::vector<real_type> costs{ 0.5, 1.0, 2.0, 4.0 };
+
+    const auto grid = grid_search_type::make_grid(TypeParam::kernel, gammas, coef0s, degrees, costs);
+
+    switch (TypeParam::kernel) {
+        case plssvm::kernel_type::linear:
+            ASSERT_EQ(grid.size(), costs.size());
+            for (const auto &point : grid) {
+                EXPECT_EQ(point.gamma, gammas.front());
+                EXPECT_EQ(point.coef0, coef0s.front());
+                EXPECT_EQ(point.degree, degrees.front());
+            }
+            break;
+        case plssvm::kernel_type::polynomial:
+            ASSERT_EQ(grid.size(), gammas.size() * coef0s.size() * degrees.size() * costs.size());
+            break;
+        case plssvm::kernel_type::rbf:
+            ASSERT_EQ(grid.size(), gammas.size() * costs.size());
+            for (const auto &point : grid) {
+                EXPECT_EQ(point.coef0, coef0s.front());
+                EXPECT_EQ(point.degree, degrees.front());
+            }
+            break;
+    }
+    // the cost is varied fastest
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        EXPECT_EQ(grid[i].cost, costs[i % costs.size()]);
+    }
+
+    // empty hyperparameter lists and non-positive costs are illegal
+    EXPECT_THROW_WHAT(std::vector<plssvm::grid_point<real_type>> ret = grid_search_type::make_grid(TypeParam::kernel, {}, coef0s, degrees, costs), plssvm::exception, "At least one value must be given for each hyperparameter of the grid!");
+    EXPECT_THROW_WHAT(std::vector<plssvm::grid_point<real_type>> ret = grid_search_type::make_grid(TypeParam::kernel, gammas, coef0s, degrees, {}), plssvm::exception, "At least one value must be given for each hyperparameter of the grid!");
+    EXPECT_THROW_WHAT(std::vector<plssvm::grid_point<real_type>> ret = grid_search_type::make_grid(TypeParam::kernel, gammas, coef0s, degrees, { 1.0, 0.0 }), plssvm::exception, "All costs of the grid must be positive, but 0 isn't!");
+}
+
+// check whether the Gram matrix is correctly computed, cached, and recomputed if the cache doesn't match the data set
+TYPED_TEST(GridSearch, gram_matrix_cache) {
+    using real_type = typename TypeParam::real_type;
+
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    const std::string cache_file = util::create_temp_file();
+
+    // compute the Gram matrix and write it to the cache file
+    const plssvm::grid_search<real_type> search{ params, cache_file };
+    const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+    // only the lower triangle is stored packed row by row
+    ASSERT_EQ(search.gram_matrix().size(), data.size() * (data.size() + 1) / 2);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            util::gtest_expect_floating_point_eq(search.gram_matrix()[i * (i + 1) / 2 + j], compare::detail::linear_kernel(data[i], data[j]));
+        }
+    }
+
+    // read the Gram matrix from the cache file
+    const plssvm::grid_search<real_type> cached_search{ params, cache_file };
+    EXPECT_EQ(cached_search.gram_matrix(), search.gram_matrix());
+
+    // a cache file of a data set with the same size and the same squared norms is recomputed
+    std::vector<std::vector<real_type>> swapped_data{ data };
+    std::swap(swapped_data[0][0], swapped_data[0][1]);
+    plssvm::parameter<real_type> swapped_params{ params };
+    swapped_params.data_ptr = std::make_shared<const plssvm::aos_matrix<real_type>>(swapped_data);
+    const plssvm::grid_search<real_type> swapped_search{ swapped_params, cache_file };
+    EXPECT_NE(swapped_search.gram_matrix(), search.gram_matrix());
+    util::gtest_expect_floating_point_eq(swapped_search.gram_matrix()[1], compare::detail::linear_kernel(swapped_data[0], swapped_data[1]));
+
+    // a cache file of another data set is ignored and overwritten
+    plssvm::parameter<real_type> other_params;
+    other_params.print_info = false;
+    other_params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+    const plssvm::grid_search<real_type> other_search{ other_params, cache_file };
+    EXPECT_EQ(other_search.gram_matrix().size(), std::size_t{ 500 * 501 / 2 });
+    const plssvm::grid_search<real_type> other_cached_search{ other_params, cache_file };
+    EXPECT_EQ(other_cached_search.gram_matrix(), other_search.gram_matrix());
+
+    std::filesystem::remove(cache_file);
+}
+
+// check whether data sets with more than two classes are rejected
+TYPED_TEST(GridSearch, multiclass) {
+    using real_type = typename TypeParam::real_type;
+
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/30x4.multiclass.libsvm");
+
+    EXPECT_THROW_WHAT(plssvm::grid_search<real_type>{ params }, plssvm::exception, "Grid search is only supported for two classes!");
+}
+
+// check whether an illegal number of folds is rejected
+TYPED_TEST(GridSearch, evaluate_illegal_num_folds) {
+    using real_type = typename TypeParam::real_type;
+
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    const plssvm::grid_search<real_type> search{ params };
+    const auto grid = plssvm::grid_search<real_type>::make_grid(params.kernel, { params.gamma }, { params.coef0 }, { params.degree }, { params.cost });
+
+    EXPECT_THROW_WHAT(std::vector<plssvm::grid_point<real_type>> ret = search.evaluate(grid, 1), plssvm::exception, "The number of folds (1) must be in the range [2, 5]!");
+    EXPECT_THROW_WHAT(std::vector<plssvm::grid_point<real_type>> ret = search.evaluate(grid, 6), plssvm::exception, "The number of folds (6) must be in the range [2, 5]!");
+}
+
+// check whether the cross-validation accuracy matches the accuracy of models learned by directly solving the dense LS-SVM system of each fold
+TYPED_TEST(GridSearchAccuracy, evaluate) {
+    using real_type = typename TypeParam::real_type;
+
+    plssvm::parameter<real_type> params;
+    params.print_info = false;
+    params.kernel = TypeParam::kernel;
+    params.epsilon = 1e-12;
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm");
+
+    const std::vector<std::vector<real_type>> data = params.data_ptr->to_2D_vector();
+    const std::vector<real_type> &labels = *params.value_ptr;
+    const std::size_t num_folds = 4;
+
+    const plssvm::grid_search<real_type> search{ params };
+    // the costs of each gamma share a kernel matrix
+    const auto grid = search.evaluate(plssvm::grid_search<real_type>::make_grid(params.kernel, { params.gamma, 2 * params.gamma }, { real_type{ 1.0 } }, { 2 }, { real_type{ 0.01 }, real_type{ 1.0 } }), num_folds);
+
+    for (const plssvm::grid_point<real_type> &point : grid) {
+        const auto kernel_function = [&](const std::vector<real_type> &x, const std::vector<real_type> &y) {
+            switch (TypeParam::kernel) {
+                case plssvm::kernel_type::linear:
+                    return compare::detail::linear_kernel(x, y);
+                case plssvm::kernel_type::polynomial:
+                    return compare::detail::poly_kernel(x, y, point.degree, point.gamma, point.coef0);
+                case plssvm::kernel_type::rbf:
+                    return compare::detail::radial_kernel(x, y, point.gamma);
+            }
+            return real_type{ 0.0 };
+        };
+
+        std::size_t correct = 0;
+        for (std::size_t fold = 0; fold < num_folds; ++fold) {
+            std::vector<std::size_t> train;
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                if (i % num_folds != fold) {
+                    train.push_back(i);
+                }
+            }
+
+            // solve [0 1^T; 1 K + I / C] [b; alpha] = [0; y] using Gaussian elimination with partial pivoting
+            const std::size_t size = train.size() + 1;
+            std::vector<std::vector<real_type>> A(size, std::vector<real_type>(size + 1, real_type{ 0.0 }));
+            for (std::size_t i = 1; i < size; ++i) {
+                A[0][i] = real_type{ 1.0 };
+                A[i][0] = real_type{ 1.0 };
+                for (std::size_t j = 1; j < size; ++j) {
+                    A[i][j] = kernel_function(data[train[i - 1]], data[train[j - 1]]);
+                }
+                A[i][i] += 1 / point.cost;
+                A[i][size] = labels[train[i - 1]];
+            }
+            for (std::size_t col = 0; col < size; ++col) {
+                std::size_t pivot = col;
+                for (std::size_t row = col + 1; row < size; ++row) {
+                    if (std::abs(A[row][col]) > std::abs(A[pivot][col])) {
+                        pivot = row;
+                    }
+                }
+                std::swap(A[col], A[pivot]);
+                for (std::size_t row = col + 1; row < size; ++row) {
+                    const real_type factor = A[row][col] / A[col][col];
+                    for (std::size_t k = col; k <= size; ++k) {
+                        A[row][k] -= factor * A[col][k];
+                    }
+                }
+            }
+            std::vector<real_type> solution(size);
+            for (std::size_t row = size; row-- > 0;) {
+                real_type temp = A[row][size];
+                for (std::size_t k = row + 1; k < size; ++k) {
+                    temp -= A[row][k] * solution[k];
+                }
+                solution[row] = temp / A[row][row];
+            }
+
+            // predict the validation data points
+            for (std::size_t v = fold; v < data.size(); v += num_folds) {
+                real_type decision = solution[0];
+                for (std::size_t i = 0; i < train.size(); ++i) {
+                    decision += solution[i + 1] * kernel_function(data[train[i]], data[v]);
+                }
+                if (decision * labels[v] > real_type{ 0.0 }) {
+                    ++correct;
+                }
+            }
+        }
+
+        util::gtest_expect_floating_point_eq(point.accuracy, static_cast<real_type>(correct) / static_cast<real_type>(data.size()), fmt::format("cost = {}", point.cost));
+    }
+
+    // the preconditioners only change the convergence of the CG solver, but not the solution
+    for (const plssvm::preconditioner_type preconditioner : { plssvm::preconditioner_type::jacobi, plssvm::preconditioner_type::block_jacobi, plssvm::preconditioner_type::pivoted_cholesky }) {
+        plssvm::parameter<real_type> precond_params{ params };
+        precond_params.preconditioner = preconditioner;
+        const plssvm::grid_search<real_type> precond_search{ precond_params };
+        const auto precond_grid = precond_search.evaluate(plssvm::grid_search<real_type>::make_grid(params.kernel, { params.gamma, 2 * params.gamma }, { real_type{ 1.0 } }, { 2 }, { real_type{ 0.01 }, real_type{ 1.0 } }), num_folds);
+        ASSERT_EQ(precond_grid.size(), grid.size());
+        for (std::size_t i = 0; i < grid.size(); ++i) {
+            util::gtest_expect_floating_point_eq(precond_grid[i].accuracy, grid[i].accuracy, fmt::format("{}, cost = {}", preconditioner, grid[i].cost));
+        }
+    }
+
+    // the fast exponential function changes the rbf kernel matrix only by a few ULP, i.e., at most the prediction of a data point with a decision value close to zero may change
+    if constexpr (TypeParam::kernel == plssvm::kernel_type::rbf) {
+        plssvm::parameter<real_type> fast_math_params{ params };
+        fast_math_params.fast_math_kernels = true;
+        const plssvm::grid_search<real_type> fast_math_search{ fast_math_params };
+        const auto fast_math_grid = fast_math_search.evaluate(plssvm::grid_search<real_type>::make_grid(params.kernel, { params.gamma, 2 * params.gamma }, { real_type{ 1.0 } }, { 2 }, { real_type{ 0.01 }, real_type{ 1.0 } }), num_folds);
+        ASSERT_EQ(fast_math_grid.size(), grid.size());
+        for (std::size_t i = 0; i < grid.size(); ++i) {
+            EXPECT_NEAR(fast_math_grid[i].accuracy, grid[i].accuracy, real_type{ 1.5 } / static_cast<real_type>(data.size())) << fmt::format("gamma = {}, cost = {}", grid[i].gamma, grid[i].cost);
+        }
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the padded data matrix.
+ */
+
+#include "plssvm/constants.hpp"              // plssvm::MATRIX_ALIGNMENT
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::exception
+#include "plssvm/matrix.hpp"                 // plssvm::aos_matrix, plssvm::soa_matrix, plssvm::simd_padding
+#include "plssvm/parameter.hpp"              // plssvm::parameter
+
+#include "utility.hpp"  // util::gtest_expect_floating_point_eq, EXPECT_THROW_WHAT
+
+#include "fmt/core.h"     // fmt::format
+#include "gtest/gtest.h"  // ::testing::Test, ::testing::Types, TYPED_TEST_SUITE, TYPED_TEST, ASSERT_EQ, EXPECT_EQ
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uintptr_t
+#include <vector>   // std::vector
+
+// the floating point types to test
+using floating_point_types = ::testing::Types<float, double>;
+
+template <typename T>
+class Matrix : public ::testing::Test {};
+TYPED_TEST_SUITE(Matrix, floating_point_types);
+
+// check whether the padding is calculated correctly
+TYPED_TEST(Matrix, simd_padding) {
+    constexpr std::size_t simd_width = plssvm::MATRIX_ALIGNMENT / sizeof(TypeParam);
+    EXPECT_EQ(plssvm::simd_padding<TypeParam>(0), 0);
+    EXPECT_EQ(plssvm::simd_padding<TypeParam>(1), simd_width - 1);
+    EXPECT_EQ(plssvm::simd_padding<TypeParam>(simd_width), 0);
+    EXPECT_EQ(plssvm::simd_padding<TypeParam>(simd_width + 1), simd_width - 1);
+}
+
+// check whether constructing a matrix from a 2D vector works as intended
+TYPED_TEST(Matrix, construct_from_2D_vector) {
+    using real_type = TypeParam;
+    const std::vector<std::vector<real_type>> data = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+    const plssvm::aos_matrix<real_type> matr{ data, 2, plssvm::simd_padding<real_type>(3) };
+
+    // check sizes
+    EXPECT_EQ(matr.num_rows(), 2);
+    EXPECT_EQ(matr.num_cols(), 3);
+    EXPECT_EQ(matr.num_rows_padded(), 4);
+    EXPECT_EQ(matr.num_cols_padded() % (plssvm::MATRIX_ALIGNMENT / sizeof(real_type)), 0);
+    EXPECT_FALSE(matr.empty());
+
+    // check alignment of the rows
+    for (std::size_t row = 0; row < matr.num_rows_padded(); ++row) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matr.row_data(row)) % plssvm::MATRIX_ALIGNMENT, 0) << "row: " << row;
+    }
+
+    // check content and zero-initialized padding
+    for (std::size_t row = 0; row < matr.num_rows_padded(); ++row) {
+        for (std::size_t col = 0; col < matr.num_cols_padded(); ++col) {
+            const real_type correct = row < 2 && col < 3 ? data[row][col] : real_type{ 0.0 };
+            util::gtest_expect_floating_point_eq(matr(row, col), correct, fmt::format("row: {} col: {}", row, col));
+        }
+    }
+
+    // convert back
+    EXPECT_EQ(matr.to_2D_vector(), data);
+    EXPECT_EQ(matr.row(1), data[1]);
+
+    // all data points must have the same number of features
+    EXPECT_THROW_WHAT((plssvm::aos_matrix<real_type>{ std::vector<std::vector<real_type>>{ { 1 }, { 2, 3 } } }), plssvm::exception, "All points in the data vector must have the same number of features!");
+}
+
+// check whether transforming the AoS data into a SoA matrix works as intended
+TYPED_TEST(Matrix, layout_conversion) {
+    // create parameter object
+    plssvm::parameter<TypeParam> params;
+    params.print_info = false;
+    params.parse_train_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+
+    using real_type = TypeParam;
+    const plssvm::aos_matrix<real_type> &data = *params.data_ptr;
+
+    // transform data without and with boundary
+    const plssvm::soa_matrix<real_type> result_no_boundary{ data, 0, 0 };
+    const plssvm::soa_matrix<real_type> result_boundary{ data, 10, 0 };
+
+    // check if sizes match
+    ASSERT_EQ(result_no_boundary.num_rows_padded() * result_no_boundary.num_cols_padded(), data.num_rows() * data.num_cols());
+    ASSERT_EQ(result_boundary.num_rows_padded() * result_boundary.num_cols_padded(), (data.num_rows() + 10) * data.num_cols());
+
+    // check transformed content for correctness
+    for (std::size_t datapoint = 0; datapoint < data.num_rows(); ++datapoint) {
+        for (std::size_t feature = 0; feature < data.num_cols(); ++feature) {
+            util::gtest_expect_floating_point_eq(
+                data(datapoint, feature),
+                result_no_boundary.data()[datapoint + feature * data.num_rows()],
+                fmt::format("datapoint: {} feature: {} at index: {}", datapoint, feature, datapoint + feature * data.num_rows()));
+
+            util::gtest_expect_floating_point_eq(
+                data(datapoint, feature),
+                result_boundary.data()[datapoint + feature * (data.num_rows() + 10)],
+                fmt::format("datapoint: {} feature: {} at index: {}", datapoint, feature, datapoint + feature * (data.num_rows() + 10)));
+        }
+    }
+
+    // converting back results in the same matrix
+    const plssvm::aos_matrix<real_type> round_trip{ result_boundary, data.row_padding(), data.col_padding() };
+    EXPECT_EQ(round_trip.to_2D_vector(), data.to_2D_vector());
+}
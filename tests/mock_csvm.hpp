@@ -11,10 +11,13 @@
 
 #pragma once
 
-#include "plssvm/csvm.hpp"             // plssvm::csvm
-#include "plssvm/kernel_types.hpp"     // plssvm::kernel_type
-#include "plssvm/parameter.hpp"        // plssvm::parameter
-#include "plssvm/target_platforms.hpp"  // plssvm::target_platform
+#include "plssvm/csvm.hpp"                  // plssvm::csvm
+#include "plssvm/kernel_types.hpp"          // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                // plssvm::aos_matrix
+#include "plssvm/parameter.hpp"             // plssvm::parameter
+#include "plssvm/preconditioner_types.hpp"  // plssvm::preconditioner_type
+#include "plssvm/solver_types.hpp"          // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"      // plssvm::target_platform
 
 #include "gmock/gmock.h"  // MOCK_METHOD
 
@@ -38,14 +41,17 @@ class mock_csvm : public plssvm::csvm<T> {
     // mock pure virtual functions
     MOCK_METHOD(void, setup_data_on_device, (), (override));
     MOCK_METHOD(std::vector<real_type>, generate_q, (), (override));
-    MOCK_METHOD(std::vector<real_type>, solver_CG, (const std::vector<real_type> &, const std::size_t, const real_type, const std::vector<real_type> &), (override));
+    MOCK_METHOD(std::vector<real_type>, solver_CG, (const std::vector<real_type> &, const std::vector<real_type> &, const std::size_t, const real_type, const std::vector<real_type> &), (override));
+    MOCK_METHOD(std::vector<std::vector<real_type>>, solver_CG_cost_path, (const std::vector<real_type> &, const std::size_t, const real_type, const std::vector<real_type> &, const std::vector<real_type> &), (override));
+    MOCK_METHOD(std::vector<std::vector<real_type>>, solver_CG_block, (const std::vector<std::vector<real_type>> &, const std::size_t, const real_type, const std::vector<real_type> &, const std::vector<std::size_t> &), (override));
     MOCK_METHOD(void, update_w, (), (override));
-    MOCK_METHOD(std::vector<real_type>, predict, (const std::vector<std::vector<real_type>> &), (override));
+    MOCK_METHOD(std::vector<real_type>, predict, (const plssvm::aos_matrix<real_type> &), (override));
 
     // make non-virtual functions publicly visible
     using base_type::kernel_function;
     using base_type::predict;  // no idea way necessary (since the used 'real_type predict(const std::vector<real_type>&)' is a public member function) but it works
-    using base_type::transform_data;
+    using base_type::resolve_solver;
+    using base_type::to_matrix;
 
     // getter for all parameter
     plssvm::target_platform get_target() const { return base_type::target_; }
@@ -56,9 +62,18 @@ class mock_csvm : public plssvm::csvm<T> {
     real_type get_cost() const { return base_type::cost_; }
     real_type get_epsilon() const { return base_type::epsilon_; }
     bool get_print_info() const { return base_type::print_info_; }
+    plssvm::solver_type get_solver() const { return base_type::solver_; }
+    std::size_t get_memory_budget() const { return base_type::memory_budget_; }
+    real_type get_replace_threshold() const { return base_type::replace_threshold_; }
+    std::size_t get_replace_interval() const { return base_type::replace_interval_; }
+    plssvm::preconditioner_type get_preconditioner() const { return base_type::preconditioner_; }
+    std::size_t get_precond_size() const { return base_type::precond_size_; }
+    bool get_mixed_precision() const { return base_type::mixed_precision_; }
+    bool get_fast_math_kernels() const { return base_type::fast_math_kernels_; }
+    bool get_feature_map() const { return base_type::feature_map_; }
 
-    const std::shared_ptr<const std::vector<std::vector<real_type>>> &get_data_ptr() const { return base_type::data_ptr_; }
-    const std::vector<std::vector<real_type>> &get_data() const { return *base_type::data_ptr_; }
+    const std::shared_ptr<const plssvm::aos_matrix<real_type>> &get_data_ptr() const { return base_type::data_ptr_; }
+    std::vector<std::vector<real_type>> get_data() const { return base_type::data_ptr_->to_2D_vector(); }
     std::shared_ptr<const std::vector<real_type>> &get_value_ptr() { return base_type::value_ptr_; }
     std::shared_ptr<const std::vector<real_type>> &get_alpha_ptr() { return base_type::alpha_ptr_; }
 
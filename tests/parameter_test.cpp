@@ -9,13 +9,16 @@
  */
 
 #include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/random_features.hpp"       // plssvm::detail::random_fourier_frequencies
 #include "plssvm/detail/string_conversion.hpp"     // plssvm::detail::convert_to
 #include "plssvm/detail/string_utility.hpp"        // plssvm::detail::replace_all
 #include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_file_format_exception, plssvm::file_not_found_exception
 #include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix
 #include "plssvm/parameter.hpp"                    // plssvm::parameter
 #include "plssvm/parameter_predict.hpp"            // plssvm::parameter_predict
 #include "plssvm/parameter_train.hpp"              // plssvm::parameter_train
+#include "plssvm/preconditioner_types.hpp"         // plssvm::preconditioner_type
 
 #include "utility.hpp"    // util::gtest_expect_floating_point_eq, util::google_test::parameter_definition, util::google_test::parameter_definition_to_name,
                           // util::create_temp_file, EXPECT_THROW_WHAT
@@ -100,15 +103,15 @@ TYPED_TEST(Parameter, default_constructor) {
 template <bool has_label, typename real_type>
 void check_content_equal(const std::vector<std::vector<real_type>> &correct_data,
                          const std::vector<real_type> &correct_label,
-                         const std::shared_ptr<const std::vector<std::vector<real_type>>> &parsed_data,
+                         const std::shared_ptr<const plssvm::aos_matrix<real_type>> &parsed_data,
                          const std::shared_ptr<const std::vector<real_type>> &parsed_label) {
     ASSERT_EQ(correct_data.size(), correct_label.size());
 
     // check if sizes match
     ASSERT_NE(parsed_data, nullptr);
-    ASSERT_EQ(parsed_data->size(), correct_data.size()) << "num data points mismatch";
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < parsed_data->size(); ++i) {
-        ASSERT_EQ((*parsed_data)[i].size(), correct_data[i].size()) << "mismatch num features in data point: " << i;
+    ASSERT_EQ(parsed_data->num_rows(), correct_data.size()) << "num data points mismatch";
+    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < parsed_data->num_rows(); ++i) {
+        ASSERT_EQ(parsed_data->num_cols(), correct_data[i].size()) << "mismatch num features in data point: " << i;
     }
     if constexpr (has_label) {
         ASSERT_NE(parsed_label, nullptr);
@@ -118,9 +121,9 @@ void check_content_equal(const std::vector<std::vector<real_type>> &correct_data
     }
 
     // check parsed values for correctness
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < parsed_data->size(); ++i) {
-        for (typename std::vector<std::vector<real_type>>::size_type j = 0; j < (*parsed_data)[i].size(); ++j) {
-            util::gtest_expect_floating_point_eq((*parsed_data)[i][j], correct_data[i][j], fmt::format("data point: {} feature: {}", i, j));
+    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < parsed_data->num_rows(); ++i) {
+        for (typename std::vector<std::vector<real_type>>::size_type j = 0; j < parsed_data->num_cols(); ++j) {
+            util::gtest_expect_floating_point_eq((*parsed_data)(i, j), correct_data[i][j], fmt::format("data point: {} feature: {}", i, j));
         }
         if constexpr (has_label) {
             EXPECT_EQ((*parsed_label)[i], correct_label[i]) << "data point: " << i;
@@ -212,8 +215,8 @@ TYPED_TEST(Parameter, parse_libsvm_gamma) {
     params.parse_libsvm_file(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm", params.data_ptr);
 
     ASSERT_NE(params.data_ptr, nullptr);
-    ASSERT_GE(params.data_ptr->size(), 0);
-    util::gtest_assert_floating_point_eq(real_type{ 1.0 } / static_cast<real_type>(params.data_ptr->back().size()), params.gamma);
+    ASSERT_GE(params.data_ptr->num_rows(), 0);
+    util::gtest_assert_floating_point_eq(real_type{ 1.0 } / static_cast<real_type>(params.data_ptr->num_cols()), params.gamma);
 }
 
 // test whether plssvm::parameter<T>::parse_libsvm correctly fails parsing ill-formed libsvm files
@@ -292,8 +295,8 @@ TYPED_TEST(Parameter, parse_arff_gamma) {
     params.parse_arff_file(PLSSVM_TEST_PATH "/data/arff/5x4.arff", params.data_ptr);
 
     ASSERT_NE(params.data_ptr, nullptr);
-    ASSERT_GE(params.data_ptr->size(), 0);
-    util::gtest_assert_floating_point_eq(real_type{ 1.0 } / static_cast<real_type>(params.data_ptr->back().size()), params.gamma);
+    ASSERT_GE(params.data_ptr->num_rows(), 0);
+    util::gtest_assert_floating_point_eq(real_type{ 1.0 } / static_cast<real_type>(params.data_ptr->num_cols()), params.gamma);
 }
 
 // test whether plssvm::parameter<T>::parse_arff correctly fails parsing ill-formed arff files
@@ -518,17 +521,17 @@ TYPED_TEST(ParameterModel, parse_model_file) {
 
     // check if sizes match
     ASSERT_NE(params.data_ptr, nullptr);
-    ASSERT_EQ(params.data_ptr->size(), expected_model_support_vectors.size()) << "num support vectors mismatch";
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < params.data_ptr->size(); ++i) {
-        EXPECT_EQ((*params.data_ptr)[i].size(), expected_model_support_vectors[i].size()) << "mismatch num features in support vector: " << i;
+    ASSERT_EQ(params.data_ptr->num_rows(), expected_model_support_vectors.size()) << "num support vectors mismatch";
+    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < params.data_ptr->num_rows(); ++i) {
+        EXPECT_EQ(params.data_ptr->num_cols(), expected_model_support_vectors[i].size()) << "mismatch num features in support vector: " << i;
     }
     ASSERT_NE(params.alpha_ptr, nullptr);
     ASSERT_EQ(params.alpha_ptr->size(), expected_model_alphas.size()) << "num alphas mismatch";
 
     // check parsed values for correctness
-    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < params.data_ptr->size(); ++i) {
-        for (typename std::vector<std::vector<real_type>>::size_type j = 0; j < (*params.data_ptr)[i].size(); ++j) {
-            util::gtest_expect_floating_point_eq((*params.data_ptr)[i][j], expected_model_support_vectors[i][j], fmt::format("support vector: {} feature: {}", i, j));
+    for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < params.data_ptr->num_rows(); ++i) {
+        for (typename std::vector<std::vector<real_type>>::size_type j = 0; j < params.data_ptr->num_cols(); ++j) {
+            util::gtest_expect_floating_point_eq((*params.data_ptr)(i, j), expected_model_support_vectors[i][j], fmt::format("support vector: {} feature: {}", i, j));
         }
         util::gtest_expect_floating_point_eq((*params.alpha_ptr)[i], expected_model_alphas[i], fmt::format("support vector: {}", i));
     }
@@ -591,7 +594,9 @@ TYPED_TEST(ParameterModel, parse_model_ill_formed) {
     // test kernel
     ill_formed_tester("kernel_type linear", "kernel_type sigmoid", "Unrecognized kernel type 'sigmoid'!");
     // test number of classes
-    ill_formed_tester("nr_class 2", "nr_class 3", "Can only use 2 classes, but 3 were given!");
+    ill_formed_tester("nr_class 2", "nr_class 1", "At least 2 classes are necessary, but 1 were given!");
+    ill_formed_tester("nr_class 2", "nr_class 3", "Missing multiclass one_vs_all entry for a model with 3 classes!");
+    ill_formed_tester("nr_class 2", "nr_class 3\nmulticlass one_vs_all", "The number of labels (2) must match the number of classes (3)!");
     // test total number of support vectors
     ill_formed_tester("total_sv 5", "total_sv 0", "The number of support vectors must be greater than 0, but is 0!");
     // test labels
@@ -615,6 +620,132 @@ TYPED_TEST(ParameterModel, parse_model_ill_formed) {
     ill_formed_tester("rho 0.37330625882191915", "", "Missing rho value!");
 }
 
+// test whether plssvm::parameter<T>::parse_model_file correctly parses one-vs-all multi-class model files
+TYPED_TEST(Parameter, parse_model_file_multiclass) {
+    // create parameter object
+    plssvm::parameter<TypeParam> params;
+    params.print_info = false;
+
+    params.parse_model_file(PLSSVM_TEST_PATH "/data/models/6x4.multiclass.model");
+
+    using real_type = typename decltype(params)::real_type;
+
+    // check if the multi-class model values are set instead of the binary ones
+    EXPECT_EQ(params.alpha_ptr, nullptr);
+    EXPECT_EQ(params.value_ptr, nullptr);
+    EXPECT_EQ(params.kernel, plssvm::kernel_type::rbf);
+    EXPECT_EQ(params.classes, initialize_with_correct_type<real_type>({ 1, 2, 3 }));
+    ASSERT_EQ(params.class_rho.size(), 3);
+    util::gtest_expect_floating_point_eq(params.class_rho[0], real_type{ 0.1 });
+    util::gtest_expect_floating_point_eq(params.class_rho[1], real_type{ -0.2 });
+    util::gtest_expect_floating_point_eq(params.class_rho[2], real_type{ 0.3 });
+    ASSERT_NE(params.label_ptr, nullptr);
+    EXPECT_EQ(*params.label_ptr, initialize_with_correct_type<real_type>({ 1, 1, 2, 3, 3, 3 }));
+
+    // check the weights of all classes
+    ASSERT_NE(params.class_alpha_ptr, nullptr);
+    const std::vector<std::vector<real_type>> expected_class_alphas = initialize_with_correct_type<real_type>({
+        { 0.5, 0.75, -0.5, -0.25, -0.25, -0.25 },
+        { -0.25, -0.5, 1.0, -0.25, -0.5, 0.5 },
+        { -0.25, -0.25, -0.5, 0.5, 0.75, -0.25 },
+    });
+    EXPECT_EQ(*params.class_alpha_ptr, expected_class_alphas);
+
+    // check the support vectors
+    ASSERT_NE(params.data_ptr, nullptr);
+    ASSERT_EQ(params.data_ptr->num_rows(), 6);
+    ASSERT_EQ(params.data_ptr->num_cols(), 4);
+    util::gtest_expect_floating_point_eq((*params.data_ptr)(4, 0), real_type{ 1.202e-01 });
+    util::gtest_expect_floating_point_eq((*params.data_ptr)(4, 1), real_type{ 0.0 });
+
+    // test ill-formed multi-class model files
+    std::ifstream model_ifs(PLSSVM_TEST_PATH "/data/models/6x4.multiclass.model");
+    std::string correct_model((std::istreambuf_iterator<char>(model_ifs)), std::istreambuf_iterator<char>());
+
+    const auto ill_formed_tester = [&params, correct_model](const std::string_view correct, const std::string_view altered, const std::string_view msg) {
+        // alter correct model file to be ill-formed
+        std::string ill_formed_model{ correct_model };
+        plssvm::detail::replace_all(ill_formed_model, correct, altered);
+
+        // create temporary file with ill-formed model specification
+        std::string tmp_model_file = util::create_temp_file();
+        std::ofstream ofs{ tmp_model_file };
+        ofs << ill_formed_model;
+        ofs.close();
+
+        // perform actual check
+        EXPECT_THROW_WHAT(params.parse_model_file(tmp_model_file), plssvm::invalid_file_format_exception, msg);
+
+        // remove temporary file
+        std::filesystem::remove(tmp_model_file);
+    };
+
+    ill_formed_tester("multiclass one_vs_all\n", "", "Missing multiclass one_vs_all entry for a model with 3 classes!");
+    ill_formed_tester("multiclass one_vs_all", "multiclass one_vs_one", "Can only use one_vs_all as multiclass strategy, but 'one_vs_one' was given!");
+    ill_formed_tester("nr_class 3", "nr_class 2", "A one_vs_all multi-class model needs more than 2 classes, but 2 were given!");
+    ill_formed_tester("rho 0.1 -0.2 0.3", "rho 0.1 -0.2", "The number of rho values (2) must match the number of classes (3)!");
+    ill_formed_tester("label 1 2 3", "label 1 2 2", "The label 2 was given more than once!");
+    ill_formed_tester("nr_sv 2 1 3", "nr_sv 2 1", "The number of support vector counts (2) must match the number of classes (3)!");
+    ill_formed_tester("nr_sv 2 1 3", "nr_sv 2 1 2", "The number of support vectors per class doesn't add up to the total number: 2 + 1 + 2 != 6!");
+    ill_formed_tester("0.5 -0.25 -0.25 0:1.324e+00", "0.5 -0.25 0:1.324e+00", "Missing weights for data point 0! Found 2 but should be 3!");
+}
+
+// test whether plssvm::parameter<T>::parse_model_file correctly parses model files using random Fourier features
+TYPED_TEST(Parameter, parse_model_file_random_features) {
+    // create parameter object
+    plssvm::parameter<TypeParam> params;
+    params.print_info = false;
+
+    params.parse_model_file(PLSSVM_TEST_PATH "/data/models/random_features.model");
+
+    using real_type = typename decltype(params)::real_type;
+
+    // check the model values
+    EXPECT_EQ(params.kernel, plssvm::kernel_type::rbf);
+    util::gtest_expect_floating_point_eq(params.gamma, real_type{ 0.25 });
+    util::gtest_expect_floating_point_eq(params.rho, real_type{ 0.5 });
+    EXPECT_EQ(params.num_random_features, 4);
+    EXPECT_EQ(params.random_seed, 7);
+    EXPECT_EQ(params.value_ptr, nullptr);
+    EXPECT_EQ(params.label_ptr, nullptr);
+    EXPECT_EQ(params.class_alpha_ptr, nullptr);
+    ASSERT_NE(params.alpha_ptr, nullptr);
+    EXPECT_EQ(*params.alpha_ptr, initialize_with_correct_type<real_type>({ 0.25, -0.5, 0.75, 1.0 }));
+
+    // the data points are the random frequencies regenerated from the seed
+    ASSERT_NE(params.data_ptr, nullptr);
+    EXPECT_EQ(params.data_ptr->to_2D_vector(), plssvm::detail::random_fourier_frequencies(3, 4, real_type{ 0.25 }, 7).to_2D_vector());
+
+    // test ill-formed model files using random Fourier features
+    std::ifstream model_ifs(PLSSVM_TEST_PATH "/data/models/random_features.model");
+    std::string correct_model((std::istreambuf_iterator<char>(model_ifs)), std::istreambuf_iterator<char>());
+
+    const auto ill_formed_tester = [&params, correct_model](const std::string_view correct, const std::string_view altered, const std::string_view msg) {
+        // alter correct model file to be ill-formed
+        std::string ill_formed_model{ correct_model };
+        plssvm::detail::replace_all(ill_formed_model, correct, altered);
+
+        // create temporary file with ill-formed model specification
+        std::string tmp_model_file = util::create_temp_file();
+        std::ofstream ofs{ tmp_model_file };
+        ofs << ill_formed_model;
+        ofs.close();
+
+        // perform actual check
+        EXPECT_THROW_WHAT(params.parse_model_file(tmp_model_file), plssvm::invalid_file_format_exception, msg);
+
+        // remove temporary file
+        std::filesystem::remove(tmp_model_file);
+    };
+
+    ill_formed_tester("random_features 4", "random_features 0", "The number of random features must be greater than 0!");
+    ill_formed_tester("random_features 4", "random_features 3", "The number of weights (4) must match the number of random features (3)!");
+    ill_formed_tester("random_features 4", "", "Missing number of random features!");
+    ill_formed_tester("kernel_type rbf\ngamma 0.25", "kernel_type linear", "Random Fourier features are only supported for the rbf kernel, but 'linear' was given!");
+    ill_formed_tester("num_features 3", "", "Missing number of features!");
+    ill_formed_tester("rho 0.5", "", "Missing rho value!");
+}
+
 // test whether plssvm::parameter<T>::parse_model_file correctly fails if the file doesn't exist
 TYPED_TEST(ParameterModel, parse_model_non_existing_file) {
     // create parameter object
@@ -648,6 +779,22 @@ TYPED_TEST(Parameter, output_operator) {
                     "print_info        true\n"
                     "backend           openmp\n"
                     "target platform   automatic\n"
+                    "openmp_tile_size  64\n"
+                    "solver            automatic\n"
+                    "memory_budget     0\n"
+                    "cache_size        0\n"
+                    "replace_threshold 0.01\n"
+                    "replace_interval  50\n"
+                    "preconditioner    none\n"
+                    "precond_size      64\n"
+                    "mixed_precision   false\n"
+                    "fast_math_kernels false\n"
+                    "feature_map       true\n"
+                    "cost_path         []\n"
+                    "num_folds         0\n"
+                    "loo_probes        0\n"
+                    "random_features   0\n"
+                    "random_seed       42\n"
                     "input_filename    ''\n"
                     "model_filename    ''\n"
                     "predict_filename  ''\n"
@@ -683,6 +830,18 @@ TYPED_TEST(ParameterTrain, parse_filename) {
     EXPECT_TRUE(params.print_info);
     EXPECT_EQ(params.backend, plssvm::backend_type::openmp);
     EXPECT_EQ(params.target, plssvm::target_platform::automatic);
+    EXPECT_EQ(params.openmp_tile_size, 64);
+    EXPECT_EQ(params.solver, plssvm::solver_type::automatic);
+    EXPECT_EQ(params.memory_budget, 0);
+    EXPECT_EQ(params.cache_size, 0);
+    EXPECT_EQ(params.replace_threshold, real_type{ 0.01 });
+    EXPECT_EQ(params.replace_interval, 50);
+    EXPECT_EQ(params.preconditioner, plssvm::preconditioner_type::none);
+    EXPECT_EQ(params.precond_size, 64);
+    EXPECT_FALSE(params.mixed_precision);
+    EXPECT_FALSE(params.fast_math_kernels);
+    EXPECT_TRUE(params.feature_map);
+    EXPECT_TRUE(params.cost_path.empty());
 
     EXPECT_EQ(params.input_filename, PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
     EXPECT_EQ(params.model_filename, "5x4.libsvm.model");
@@ -699,7 +858,7 @@ TYPED_TEST(ParameterTrain, parse_filename) {
 // check whether the command line parsing for plssvm::parameter_train<T> is correct
 TYPED_TEST(ParameterTrain, parse_command_line_arguments) {
     // used command line parameters
-    std::vector<std::string> argv_vec = { "./svm-train", "--backend", "cuda", "--target_platform", "gpu_nvidia", "-t", "1", "-d", "5", "--gamma", "3.1415", "-r", "0.42", "--cost", "1.89", "-e", "0.00001", "-q", "--input", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    std::vector<std::string> argv_vec = { "./svm-train", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--openmp_tile_size", "32", "--solver", "cg_explicit", "--memory_budget", "512", "--cache_size", "256", "--replace_threshold", "0.5", "--replace_interval", "10", "--preconditioner", "block_jacobi", "--precond_size", "32", "--mixed_precision", "--fast_math_kernels", "--no_feature_map", "-t", "1", "-d", "5", "--gamma", "3.1415", "-r", "0.42", "--cost", "1.89", "--cost_path", "0.5,2", "-e", "0.00001", "-q", "--input", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
     std::vector<char *> argv(argv_vec.size());
     for (std::size_t i = 0; i < argv.size(); ++i) {
         argv[i] = argv_vec[i].data();
@@ -721,6 +880,18 @@ TYPED_TEST(ParameterTrain, parse_command_line_arguments) {
     EXPECT_FALSE(params.print_info);
     EXPECT_EQ(params.backend, plssvm::backend_type::cuda);
     EXPECT_EQ(params.target, plssvm::target_platform::gpu_nvidia);
+    EXPECT_EQ(params.openmp_tile_size, 32);
+    EXPECT_EQ(params.solver, plssvm::solver_type::cg_explicit);
+    EXPECT_EQ(params.memory_budget, 512);
+    EXPECT_EQ(params.cache_size, 256);
+    EXPECT_EQ(params.replace_threshold, real_type{ 0.5 });
+    EXPECT_EQ(params.replace_interval, 10);
+    EXPECT_EQ(params.preconditioner, plssvm::preconditioner_type::block_jacobi);
+    EXPECT_EQ(params.precond_size, 32);
+    EXPECT_TRUE(params.mixed_precision);
+    EXPECT_TRUE(params.fast_math_kernels);
+    EXPECT_FALSE(params.feature_map);
+    EXPECT_EQ(params.cost_path, (std::vector<real_type>{ 0.5, 2 }));
 
     EXPECT_EQ(params.input_filename, PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
     EXPECT_EQ(params.model_filename, "5x4.libsvm.model");
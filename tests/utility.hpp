@@ -14,8 +14,10 @@
 #include "plssvm/csvm_factory.hpp"                 // plssvm::make_csvm
 #include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
 #include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/blas.hpp"                  // plssvm::detail::blas::{is_enabled, set_enabled}
 #include "plssvm/detail/utility.hpp"               // plssvm::detail::always_false_v
 #include "plssvm/kernel_types.hpp"                 // plssvm::kernel_type
+#include "plssvm/matrix.hpp"                       // plssvm::aos_matrix
 #include "plssvm/parameter.hpp"                    // plssvm::parameter
 
 #include "fmt/core.h"     // fmt::format
@@ -23,18 +25,20 @@
 
 #ifdef __unix__
     #include <cstdlib>  // mkstemp
-#else
-    #include <random>  // std::random_device, std::mt19937, std::uniform_int_distribution
 #endif
 
-#include <algorithm>    // std::min, std::max
+#include <algorithm>    // std::min, std::max, std::generate
 #include <cmath>        // std::abs
+#include <cstddef>      // std::size_t
 #include <filesystem>   // std::filesystem::temp_directory_path, std::filesystem::exists
 #include <limits>       // std::numeric_limits
+#include <memory>       // std::make_shared
+#include <random>       // std::random_device, std::mt19937, std::uniform_int_distribution, std::uniform_real_distribution
 #include <sstream>      // std::ostringstream, std::istringstream
 #include <string>       // std::string, std::to_string
 #include <string_view>  // std::string_view
 #include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
 
 namespace util {
 
@@ -187,6 +191,55 @@ inline void gtest_expect_correct_csvm_factory(const plssvm::parameter<T> &params
     EXPECT_NE(res, nullptr);
 }
 
+/**
+ * @brief Call @p func once for each available implementation of the dense linear algebra on the CPU.
+ * @details If PLSSVM has been built with BLAS/LAPACK, @p func is called once using the BLAS/LAPACK routines and once using the built-in loops.
+ *          Otherwise, @p func is only called once using the built-in loops.
+ * @tparam Func the type of the function
+ * @param[in] func the function to call; gets `true` as argument if the BLAS/LAPACK routines are used, `false` otherwise
+ */
+template <typename Func>
+inline void for_each_linear_algebra_implementation(Func func) {
+#if defined(PLSSVM_HAS_BLAS)
+    const bool enabled = plssvm::detail::blas::is_enabled();
+    for (const bool use_blas : { true, false }) {
+        plssvm::detail::blas::set_enabled(use_blas);
+        func(use_blas);
+    }
+    plssvm::detail::blas::set_enabled(enabled);
+#else
+    func(false);
+#endif
+}
+
+/**
+ * @brief Create the parameters of a degree 2 polynomial kernel with 200 random data points with 4 features each in \f$[-1, 1]\f$ labeled by the sign of \f$x_0 \cdot x_1\f$.
+ * @details The data set has many data points with few features, such that the primal problem in the feature space of the kernel function is cheaper than the dual one.
+ * @tparam T the type of the data
+ * @return the parameters including the data points and their labels (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline plssvm::parameter<T> create_polynomial_feature_map_parameter() {
+    std::mt19937 gen{ 42 };
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::vector<std::vector<T>> data(200, std::vector<T>(4));
+    std::vector<T> labels(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        std::generate(data[i].begin(), data[i].end(), [&]() { return dist(gen); });
+        labels[i] = data[i][0] * data[i][1] > T{ 0.0 } ? T{ 1.0 } : T{ -1.0 };
+    }
+
+    plssvm::parameter<T> params;
+    params.print_info = false;
+    params.kernel = plssvm::kernel_type::polynomial;
+    params.degree = 2;
+    params.gamma = 1.0;
+    params.coef0 = 1.0;
+    params.data_ptr = std::make_shared<const plssvm::aos_matrix<T>>(data);
+    params.value_ptr = std::make_shared<const std::vector<T>>(labels);
+    return params;
+}
+
 /**
  * @brief Defines a macro like
  *        <a href="https://chromium.googlesource.com/external/github.com/google/googletest/+/HEAD/googletest/docs/advanced.md">googletest</a>'s